@@ -0,0 +1,144 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+// Packs a directory of assets into a single asset archive, which games mount using
+// cer::mount_asset_archive().
+//
+// Usage: cerlibAssetPacker <assets directory> <archive filename> [--no-compression]
+
+#include "contentmanagement/AssetArchive.hpp"
+#include "contentmanagement/FileSystem.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <fmt/format.h>
+#include <fstream>
+#include <string_view>
+
+namespace fs = std::filesystem;
+
+static void pack(const fs::path& directory, const fs::path& archive_path, bool compress)
+{
+    if (!fs::is_directory(directory))
+    {
+        throw std::invalid_argument{
+            fmt::format("'{}' is not a directory.", directory.generic_string())};
+    }
+
+    // The archive is written to a temporary file first, which then replaces the archive.
+    // A game that has the archive mapped keeps reading the old file instead of one that is
+    // being overwritten.
+    auto temp_path = archive_path;
+    temp_path += ".tmp";
+
+    const auto is_archive = [&](const fs::path& path) {
+        return (fs::exists(archive_path) && fs::equivalent(path, archive_path)) ||
+               (fs::exists(temp_path) && fs::equivalent(path, temp_path));
+    };
+
+    auto names = cer::List<std::string>{};
+
+    for (const auto& entry : fs::recursive_directory_iterator{directory})
+    {
+        // The archive might be written into the directory it packs.
+        if (!entry.is_regular_file() || is_archive(entry.path()))
+        {
+            continue;
+        }
+
+        names.push_back(fs::relative(entry.path(), directory).generic_string());
+    }
+
+    // The order of directory iteration is unspecified, but archives should be reproducible.
+    std::ranges::sort(names);
+
+    auto contents = cer::List<cer::List<std::byte>>{};
+    auto files    = cer::List<cer::details::AssetArchiveFile>{};
+    auto size     = size_t(0);
+
+    contents.reserve(names.size());
+    files.reserve(names.size());
+
+    for (const auto& name : names)
+    {
+        const auto& data =
+            contents.emplace_back(cer::filesystem::load_file_data_from_disk(
+                (directory / name).string()));
+
+        files.push_back({.name = name, .data = data});
+        size += data.size();
+    }
+
+    const auto archive = cer::details::AssetArchive::pack(files, compress);
+
+    {
+        auto ofs = std::ofstream{temp_path, std::ios::binary};
+
+        if (!ofs)
+        {
+            throw std::runtime_error{
+                fmt::format("Failed to open file '{}' for writing.", temp_path.generic_string())};
+        }
+
+        ofs.write(reinterpret_cast<const char*>(archive.data()), std::streamsize(archive.size()));
+        ofs.close();
+
+        if (!ofs)
+        {
+            fs::remove(temp_path);
+            throw std::runtime_error{
+                fmt::format("Failed to write file '{}'.", temp_path.generic_string())};
+        }
+    }
+
+    fs::rename(temp_path, archive_path);
+
+    fmt::print("Packed {} files ({} bytes) into '{}' ({} bytes)\n",
+               files.size(),
+               size,
+               archive_path.generic_string(),
+               archive.size());
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    auto paths    = cer::List<std::string_view>{};
+    auto compress = true;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const auto arg = std::string_view{argv[i]};
+
+        if (arg == "--no-compression")
+        {
+            compress = false;
+        }
+        else
+        {
+            paths.push_back(arg);
+        }
+    }
+
+    if (paths.size() != 2)
+    {
+        fmt::print(stderr,
+                   "Usage: cerlibAssetPacker <assets directory> <archive filename> "
+                   "[--no-compression]\n");
+
+        return 1;
+    }
+
+    try
+    {
+        pack(paths[0], paths[1], compress);
+    }
+    catch (const std::exception& ex)
+    {
+        fmt::print(stderr, "Error: {}\n", ex.what());
+        return 1;
+    }
+
+    return 0;
+}
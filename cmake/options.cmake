@@ -52,6 +52,12 @@ option(
   ${is_root_directory}
 )
 
+option(
+  CERLIB_BUILD_ASSET_PACKER
+  "Build the asset packer tool, which creates asset archives"
+  ${is_root_directory}
+)
+
 option(
   CERLIB_ENABLE_VERBOSE_LOGGING
   "Enable verbose logging during debug mode"
@@ -70,6 +76,12 @@ if (ANDROID)
   endif ()
 endif ()
 
+# The asset packer runs on the build machine.
+if ((ANDROID OR EMSCRIPTEN) AND CERLIB_BUILD_ASSET_PACKER)
+  cerlib_log("Disabling the asset packer implicitly due to the target platform")
+  set(CERLIB_BUILD_ASSET_PACKER OFF)
+endif ()
+
 option(
   CERLIB_ENABLE_TESTS
   "Enable unit testing"
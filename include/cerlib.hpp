@@ -6,10 +6,12 @@
 
 #include <cerlib/Audio.hpp>
 #include <cerlib/BlendState.hpp>
+#include <cerlib/CanvasReadback.hpp>
 #include <cerlib/Circle.hpp>
 #include <cerlib/Color.hpp>
 #include <cerlib/Content.hpp>
 #include <cerlib/Defer.hpp>
+#include <cerlib/DrawList.hpp>
 #include <cerlib/Drawing.hpp>
 #include <cerlib/Event.hpp>
 #include <cerlib/Font.hpp>
@@ -6,13 +6,73 @@
 
 #include <cerlib/SoundTypes.hpp>
 #include <cerlib/details/ObjectMacros.hpp>
+#include <cstdint>
 #include <optional>
+#include <span>
+#include <string_view>
 
 namespace cer
 {
 class Sound;
 class SoundChannel;
 
+/**
+ * Defines how a game produces audio.
+ *
+ * @ingroup Audio
+ */
+enum class AudioMode
+{
+    /**
+     * No audio device is created. Audio API calls have no effect.
+     */
+    Disabled = 0,
+
+    /**
+     * Audio is mixed in the background and played on the system's audio device.
+     */
+    Device = 1,
+
+    /**
+     * Audio is mixed, but never played. Instead, the game renders audio explicitly
+     * using render_audio() or render_audio_to_file(), as fast as the mixer allows.
+     * The audio clock only advances by the amount of audio that is rendered.
+     *
+     * This is useful to run headless, e.g. in automated tests, or to benchmark the
+     * mixer. The offline mode can also be enabled for a game that uses
+     * AudioMode::Device by setting the environment variable CERLIB_OFFLINE_AUDIO to 1.
+     */
+    Offline = 2,
+};
+
+/**
+ * Represents statistics of the audio mixer.
+ *
+ * @ingroup Audio
+ */
+struct AudioMixerStats
+{
+    /** The number of sample frames that were mixed in total. */
+    uint64_t mixed_frames = 0;
+
+    /** The number of voice sample frames that were mixed in total, i.e. the number of
+     * active voices times the number of frames, summed over all mixing passes. */
+    uint64_t mixed_voice_frames = 0;
+
+    /** The total time spent mixing, in seconds. */
+    double mix_duration = 0.0;
+
+    /** The mixer's throughput, in voice sample frames per second. */
+    double voice_frames_per_second = 0.0;
+
+    /** The number of mixing passes that took longer than the duration of the audio they
+     * produced. With a real audio device, each of these is an audible dropout. */
+    uint64_t deadline_misses = 0;
+
+    /** The number of threads that mix voices, including the audio thread itself. */
+    uint32_t mix_thread_count = 0;
+};
+
 /**
  * Gets a value indicating whether the audio device has been initialized.
  * This is the case if the game was initialized with audio enabled and a suitable audio
@@ -25,6 +85,90 @@ class SoundChannel;
  */
 auto is_audio_device_initialized() -> bool;
 
+/**
+ * Gets the mode in which the game produces audio.
+ *
+ * If the game was initialized with audio enabled, but no suitable audio device was
+ * found, AudioMode::Disabled is returned.
+ *
+ * @ingroup Audio
+ */
+auto audio_mode() -> AudioMode;
+
+/**
+ * Gets the sample rate of the audio mixer, in Hz.
+ * If the audio device is not initialized, zero is returned.
+ *
+ * @ingroup Audio
+ */
+auto audio_sample_rate() -> uint32_t;
+
+/**
+ * Gets the number of channels the audio mixer produces, e.g. 2 for stereo.
+ * If the audio device is not initialized, zero is returned.
+ *
+ * @ingroup Audio
+ */
+auto audio_channel_count() -> uint32_t;
+
+/**
+ * Mixes the next portion of audio into a buffer.
+ *
+ * The number of rendered sample frames is the size of the destination divided by
+ * audio_channel_count(). The samples of a frame are stored next to each other
+ * (interleaved). Rendering advances the audio clock by the duration of the rendered
+ * audio, which means that fades and delayed sounds progress accordingly.
+ *
+ * @param destination The buffer that receives the mixed samples.
+ *
+ * @throw std::logic_error If the game does not use AudioMode::Offline.
+ * @throw std::invalid_argument If the size of destination is not a multiple of the
+ * channel count.
+ *
+ * @ingroup Audio
+ */
+void render_audio(std::span<float> destination);
+
+/**
+ * Mixes the next portion of audio into a WAV file.
+ *
+ * The file stores 32-bit floating-point samples at the mixer's sample rate and channel
+ * count. Otherwise, this behaves like render_audio().
+ *
+ * @param filename The name of the file to write.
+ * @param duration The duration of audio to render.
+ *
+ * @throw std::logic_error If the game does not use AudioMode::Offline.
+ * @throw std::invalid_argument If duration is negative.
+ * @throw std::runtime_error If the file could not be written.
+ *
+ * @ingroup Audio
+ */
+void render_audio_to_file(std::string_view filename, SoundTime duration);
+
+/**
+ * Gets statistics about the work the audio mixer has done so far.
+ *
+ * @ingroup Audio
+ */
+auto audio_mixer_stats() -> AudioMixerStats;
+
+/**
+ * Sets the number of threads that mix voices, including the audio thread itself.
+ *
+ * By default, all voices are mixed on the audio thread. Additional threads render
+ * voices in parallel, which helps games that play many voices at once, at the cost of
+ * occupying more cores. Idle mix threads sleep until there are voices to render.
+ * At most 4 threads are used; larger values are clamped.
+ *
+ * @param count The number of mixing threads.
+ *
+ * @throw std::invalid_argument If count is zero.
+ *
+ * @ingroup Audio
+ */
+void set_audio_mix_thread_count(uint32_t count);
+
 /**
  * Plays a sound.
  *
@@ -0,0 +1,94 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <cerlib/List.hpp>
+#include <cerlib/details/ObjectMacros.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace cer
+{
+namespace details
+{
+class CanvasReadbackImpl;
+}
+
+/**
+ * Represents pixel data of a canvas that is being read in the background.
+ *
+ * A readback is started using cer::read_canvas_data_async(). Unlike
+ * cer::read_canvas_data(), starting it does not wait for the GPU to finish drawing to
+ * the canvas. Instead, the GPU copies the data once it gets to it, which usually takes
+ * a frame or two. Until then, the canvas can be drawn to and read from again.
+ *
+ * Use is_ready() to check whether the data has arrived, and read() or read_into() to
+ * obtain it. Reading the data before it's ready waits for it.
+ *
+ * Both use the graphics API, so they may only be called on the thread that runs the
+ * game. In pipelined mode, this excludes update() and draw(), where they throw a
+ * std::logic_error. A readback may be released on any thread; the GPU resources behind
+ * it are then freed on the game's thread.
+ *
+ * Example:
+ * @code{.cpp}
+ * // When taking a screenshot:
+ * m_screenshot = cer::read_canvas_data_async(canvas, 0, 0, canvas.width(), canvas.height());
+ *
+ * // A few frames later:
+ * if (m_screenshot && m_screenshot.is_ready())
+ * {
+ *     const auto pixels = m_screenshot.read();
+ *     m_screenshot = {};
+ * }
+ * @endcode
+ *
+ * @ingroup Graphics
+ */
+class CanvasReadback
+{
+    CERLIB_DECLARE_OBJECT(CanvasReadback);
+
+  public:
+    /**
+     * Gets a value indicating whether the data has arrived, meaning that reading it does
+     * not wait.
+     *
+     * @throw std::logic_error If called from update() or draw() in pipelined mode.
+     */
+    auto is_ready() const -> bool;
+
+    /** Gets the width of the area that is read, in pixels. */
+    auto width() const -> uint32_t;
+
+    /** Gets the height of the area that is read, in pixels. */
+    auto height() const -> uint32_t;
+
+    /** Gets the size of the pixel data, in bytes. */
+    auto size_in_bytes() const -> size_t;
+
+    /**
+     * Writes the pixel data to a user-specified data pointer, waiting for it if it
+     * hasn't arrived yet.
+     *
+     * The data is laid out the same way as the data of cer::read_canvas_data_into().
+     *
+     * @param destination A pointer to the buffer that receives the data. It must be at
+     * least size_in_bytes() bytes large.
+     *
+     * @throw std::logic_error If called from update() or draw() in pipelined mode.
+     */
+    void read_into(void* destination) const;
+
+    /**
+     * Gets the pixel data, waiting for it if it hasn't arrived yet.
+     *
+     * @remark This is a convenience version of the read_into() function.
+     *
+     * @throw std::logic_error If called from update() or draw() in pipelined mode.
+     */
+    auto read() const -> List<std::byte>;
+};
+} // namespace cer
@@ -99,13 +99,13 @@ auto fastrand_color(std::optional<float> alpha = std::nullopt) -> Color;
  */
 auto fastrand_color(const ColorInterval& interval) -> Color;
 
-auto operator+(const Color& lhs, const Color& rhs) -> Color;
+constexpr auto operator+(const Color& lhs, const Color& rhs) -> Color;
 
-auto operator-(const Color& lhs, const Color& rhs) -> Color;
+constexpr auto operator-(const Color& lhs, const Color& rhs) -> Color;
 
-auto operator*(const Color& lhs, float rhs) -> Color;
+constexpr auto operator*(const Color& lhs, float rhs) -> Color;
 
-auto operator*(float lhs, const Color& rhs) -> Color;
+constexpr auto operator*(float lhs, const Color& rhs) -> Color;
 } // namespace cer
 
 namespace cer
@@ -170,4 +170,44 @@ static constexpr Color yellow{1.0f, 1.0f, 0.0f, 1.0f};
  * A fully transparent black.
  */
 static constexpr Color transparent{0.0f, 0.0f, 0.0f, 0.0f};
+
+constexpr auto operator+(const Color& lhs, const Color& rhs) -> Color
+{
+    return {
+        lhs.r + rhs.r,
+        lhs.g + rhs.g,
+        lhs.b + rhs.b,
+        lhs.a + rhs.a,
+    };
+}
+
+constexpr auto operator-(const Color& lhs, const Color& rhs) -> Color
+{
+    return {
+        lhs.r - rhs.r,
+        lhs.g - rhs.g,
+        lhs.b - rhs.b,
+        lhs.a - rhs.a,
+    };
+}
+
+constexpr auto operator*(const Color& lhs, float rhs) -> Color
+{
+    return {
+        lhs.r * rhs,
+        lhs.g * rhs,
+        lhs.b * rhs,
+        lhs.a * rhs,
+    };
+}
+
+constexpr auto operator*(float lhs, const Color& rhs) -> Color
+{
+    return {
+        lhs * rhs.r,
+        lhs * rhs.g,
+        lhs * rhs.b,
+        lhs * rhs.a,
+    };
+}
 } // namespace cer
@@ -33,8 +33,15 @@ class ContentManager;
  */
 struct AssetData
 {
-    std::unique_ptr<std::byte[]> data;
-    size_t                       size{};
+    /**
+     * The bytes of the asset.
+     *
+     * Depending on the platform and the size of the asset, this is either a buffer that the
+     * file was read into, or a read-only memory mapping of the file. Either way, the bytes stay
+     * valid for as long as a copy of this pointer exists.
+     */
+    std::shared_ptr<const std::byte[]> data;
+    size_t                             size{};
 
     auto as_span() const -> std::span<const std::byte>
     {
@@ -127,6 +134,66 @@ void set_asset_loading_prefix(std::string_view prefix);
  */
 auto asset_loading_prefix() -> std::string;
 
+/**
+ * Mounts an asset archive that was created using the cerlib asset packer.
+ *
+ * Assets are then looked up in the archive first, and only loaded from their files if the
+ * archive doesn't contain them. If multiple mounted archives contain an asset, the archive
+ * that was mounted last wins.
+ *
+ * The names in an archive are relative to the directory that was packed, using forward
+ * slashes. This means that the same asset names work for loose files and archives, including
+ * the prefix that is set using `set_asset_loading_prefix()`.
+ *
+ * @param filename The filename of the archive, which is loaded like any other asset file.
+ *
+ * @throw std::invalid_argument If the archive is already mounted.
+ * @throw std::runtime_error If the file is not a valid asset archive.
+ *
+ * @ingroup Content
+ */
+void mount_asset_archive(std::string_view filename);
+
+/**
+ * Unmounts an asset archive that was mounted using `mount_asset_archive()`.
+ *
+ * Assets that were already loaded from the archive stay valid.
+ *
+ * @param filename The filename of the archive, as it was passed to `mount_asset_archive()`.
+ *
+ * @throw std::invalid_argument If the archive is not mounted.
+ *
+ * @ingroup Content
+ */
+void unmount_asset_archive(std::string_view filename);
+
+/**
+ * Enables or disables hot reloading of assets.
+ *
+ * When enabled, images, shaders and sounds are reloaded whenever their files change.
+ * Existing objects that refer to them stay valid and use the new contents from then on.
+ * Changed files are decoded in the background, and swapped in at the start of the next
+ * frame. Parameter values of a reloaded shader are kept if the parameter still exists with
+ * the same type. Playing instances of a reloaded sound are stopped.
+ *
+ * Hot reloading is meant for development, and is only supported on Linux. Fonts, custom
+ * assets and assets that were loaded from asset archives are not reloaded.
+ *
+ * @param value True to enable hot reloading; false to disable it. It is disabled by
+ * default.
+ *
+ * @ingroup Content
+ */
+void set_asset_hot_reloading_enabled(bool value);
+
+/**
+ * Gets a value indicating whether hot reloading of assets is enabled.
+ * For further information, see `set_asset_hot_reloading_enabled()`.
+ *
+ * @ingroup Content
+ */
+auto is_asset_hot_reloading_enabled() -> bool;
+
 /**
  * Registers a function as a custom asset loader for a specific type ID.
  *
@@ -0,0 +1,117 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <cerlib/details/ObjectMacros.hpp>
+#include <cstdint>
+
+namespace cer
+{
+namespace details
+{
+class DrawListImpl;
+}
+
+/**
+ * Represents a recorded list of drawing commands that can be drawn any number of times.
+ *
+ * While a draw list is recording, all drawing functions that are called on the recording
+ * thread, such as draw_sprite(), draw_string(), fill_rectangle(), set_canvas(),
+ * set_transformation(), set_blend_state(), set_sampler() and set_sprite_shader(), are
+ * stored in the list instead of being drawn. Drawing the list using draw_list() then
+ * performs the same calls, in the same order.
+ *
+ * This is useful for static scenery that is expensive to issue call by call, and for
+ * building a scene on another thread and drawing it later on the main thread.
+ * Recording does not touch the graphics device, so it may happen on any thread and
+ * outside of draw(). When a list is shared between threads, the caller has to
+ * synchronize access to it, and cerlib has to be built with CERLIB_ATOMIC_REFCOUNTING.
+ *
+ * While recording, state queries such as current_canvas() and current_sprite_shader()
+ * report what has been recorded into the list so far. current_canvas_size() reports
+ * zero unless a canvas was set, and frame_stats() reports empty statistics.
+ * Canvas data cannot be read while recording.
+ *
+ * State changes made by a list stay in effect after it is drawn, as if its calls were
+ * made directly. Strings are shaped when the list is drawn, not when they are recorded.
+ *
+ * Example:
+ * @code{.cpp}
+ * auto scenery = cer::DrawList::create();
+ *
+ * scenery.begin_recording();
+ * for (const auto& tile : tiles)
+ *     cer::draw_sprite(tile.image, tile.position);
+ * scenery.end_recording();
+ *
+ * // Later, in draw():
+ * cer::draw_list(scenery);
+ * @endcode
+ *
+ * @ingroup Graphics
+ */
+class DrawList
+{
+    CERLIB_DECLARE_OBJECT(DrawList);
+
+  public:
+    /**
+     * Creates a new, empty draw list.
+     */
+    static auto create() -> DrawList;
+
+    /**
+     * Clears the list and starts recording the drawing functions that are subsequently
+     * called on the calling thread.
+     *
+     * Lists may be recorded while another list is recording on the same thread, in which
+     * case the calls are recorded into the most recently started list.
+     *
+     * @throw std::logic_error If the list is already recording.
+     */
+    void begin_recording();
+
+    /**
+     * Stops recording into the list.
+     *
+     * @throw std::logic_error If the list is not the most recently started list on the
+     * calling thread.
+     */
+    void end_recording();
+
+    /**
+     * Gets a value indicating whether the list is currently recording.
+     */
+    auto is_recording() const -> bool;
+
+    /**
+     * Gets the number of commands that are stored in the list.
+     */
+    auto command_count() const -> uint32_t;
+
+    /**
+     * Removes all commands from the list.
+     *
+     * @throw std::logic_error If the list is currently recording.
+     */
+    void clear();
+};
+
+/**
+ * Draws all commands that are recorded in a draw list.
+ *
+ * If a draw list is currently recording on the calling thread, the list is recorded
+ * into it by reference, i.e. changes made to the drawn list afterwards are visible when
+ * the recording list is drawn.
+ *
+ * @param list The list to draw.
+ *
+ * @throw std::logic_error If the list is currently recording, or if it draws the list
+ * that is currently recording, directly or through other lists.
+ *
+ * @ingroup Graphics
+ */
+void draw_list(const DrawList& list);
+} // namespace cer
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cerlib/CanvasReadback.hpp>
 #include <cerlib/Image.hpp>
 #include <cerlib/List.hpp>
 #include <cerlib/Matrix.hpp>
@@ -105,6 +106,12 @@ struct Sprite
  */
 struct TextUnderline
 {
+    /** Default comparison */
+    auto operator==(const TextUnderline&) const -> bool = default;
+
+    /** Default comparison */
+    auto operator!=(const TextUnderline&) const -> bool = default;
+
     /** The optional thickness of the line. If not specified, an ideal thickness is
      * calculated. */
     std::optional<float> thickness;
@@ -120,6 +127,12 @@ struct TextUnderline
  */
 struct TextStrikethrough
 {
+    /** Default comparison */
+    auto operator==(const TextStrikethrough&) const -> bool = default;
+
+    /** Default comparison */
+    auto operator!=(const TextStrikethrough&) const -> bool = default;
+
     /** The optional thickness of the line. If not specified, an ideal thickness is
      * calculated. */
     std::optional<float> thickness;
@@ -142,8 +155,32 @@ using TextDecoration = std::variant<TextUnderline, TextStrikethrough>;
  */
 struct FrameStats
 {
-    /** The number of draw calls that were performed in total. */
+    /**
+     * The number of draw calls that were performed in total.
+     *
+     * Consecutive sprites share a draw call even if they use different images, up to a
+     * limit of 16 images (8 on some systems). While a sprite shader is set, sprites only
+     * share a draw call if they use the same image.
+     */
     uint32_t draw_calls = 0;
+
+    /** The number of draw_string() calls that reused an already shaped string. */
+    uint32_t text_cache_hits = 0;
+
+    /** The number of draw_string() calls that had to shape their string. */
+    uint32_t text_cache_misses = 0;
+
+    /** The number of draw_text() calls that drew a retained text from its GPU buffer. */
+    uint32_t retained_text_draws = 0;
+
+    /** The number of times that the GPU buffer of a retained text had to be rebuilt. */
+    uint32_t retained_text_updates = 0;
+
+    /** The number of acquire_canvas() calls that reused a pooled canvas. */
+    uint32_t canvas_pool_hits = 0;
+
+    /** The number of acquire_canvas() calls that had to create a canvas. */
+    uint32_t canvas_pool_misses = 0;
 };
 
 /**
@@ -271,6 +308,22 @@ void draw_string(std::string_view                     text,
                  Color                                color      = white,
                  const std::optional<TextDecoration>& decoration = std::nullopt);
 
+/**
+ * Sets the maximum number of shaped strings that draw_string() keeps cached.
+ *
+ * Strings that are drawn repeatedly with the same font, size and decoration are only
+ * shaped once, as long as they stay within the cache. Once the cache is full, the
+ * least recently drawn string is evicted. Use the text_cache_hits and
+ * text_cache_misses values of frame_stats() to find a suitable capacity.
+ *
+ * The default capacity is 256 strings. A capacity of zero disables the cache.
+ *
+ * @param capacity The maximum number of cached strings.
+ *
+ * @ingroup Graphics
+ */
+void set_text_cache_capacity(uint32_t capacity);
+
 /**
  * Draws 2D text from a pre-created Text object.
  *
@@ -318,6 +371,75 @@ auto frame_stats() -> FrameStats;
  */
 auto current_canvas_size() -> Vector2;
 
+/**
+ * Gets a canvas from the canvas pool, creating one if the pool has none to spare.
+ *
+ * The pool is meant for canvases that are only needed for a short while, such as the
+ * intermediate canvases of post-processing effects. Creating a canvas every frame is
+ * expensive, while acquiring one from the pool usually isn't.
+ *
+ * A canvas is returned to the pool as soon as the last reference to it is released.
+ * It may then be handed out again by a later call with the same size, format and window.
+ * Its contents are not cleared; set a canvas clear color if the contents matter.
+ * Canvases that stay in the pool for too long are destroyed, see
+ * cer::set_canvas_pool_max_idle_frames(). Use the canvas_pool_hits and
+ * canvas_pool_misses values of frame_stats() to see how well canvases are reused.
+ *
+ * Example:
+ * @code{.cpp}
+ * void MyGame::draw(const cer::Window& window)
+ * {
+ *     const auto scene = cer::acquire_canvas(width, height, format, window);
+ *
+ *     cer::set_canvas(scene);
+ *     draw_scene();
+ *     cer::set_canvas({});
+ *
+ *     cer::set_sprite_shader(m_blur_shader);
+ *     cer::draw_sprite(scene, {0, 0});
+ *     cer::set_sprite_shader({});
+ * } // scene is returned to the pool here.
+ * @endcode
+ *
+ * @param width The width of the canvas, in pixels.
+ * @param height The height of the canvas, in pixels.
+ * @param format The format of the canvas.
+ * @param window The window in which the canvas is going to be used.
+ *
+ * @throw std::logic_error If called while the frame is being recorded for pipelined
+ * rendering, or from update() in pipelined mode.
+ *
+ * @ingroup Graphics
+ */
+auto acquire_canvas(uint32_t width, uint32_t height, ImageFormat format, const Window& window)
+    -> Image;
+
+/**
+ * Sets the number of frames after which a canvas that is no longer used is removed from
+ * the canvas pool and destroyed.
+ *
+ * The default is 60 frames.
+ *
+ * @param frame_count The number of frames.
+ *
+ * @throw std::logic_error If called from update() or draw() in pipelined mode.
+ *
+ * @ingroup Graphics
+ */
+void set_canvas_pool_max_idle_frames(uint32_t frame_count);
+
+/**
+ * Destroys all canvases of the canvas pool that are currently not used.
+ *
+ * This is useful when the pooled canvases won't be needed again, for example after the
+ * resolution of the game has changed.
+ *
+ * @throw std::logic_error If called from update() or draw() in pipelined mode.
+ *
+ * @ingroup Graphics
+ */
+void trim_canvas_pool();
+
 /**
  * Gets the pixel data that is currently stored in a canvas.
  *
@@ -362,6 +484,28 @@ void read_canvas_data_into(const Image& canvas,
 auto read_canvas_data(const Image& canvas, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
     -> List<std::byte>;
 
+/**
+ * Starts reading the pixel data that is currently stored in a canvas, without waiting
+ * for the GPU to finish drawing to it.
+ *
+ * This is preferable to cer::read_canvas_data() when the data is not needed right away,
+ * for example when taking screenshots or generating thumbnails, because reading a canvas
+ * directly stalls until the GPU has caught up with all drawing so far.
+ *
+ * @param canvas The canvas image to read data from.
+ * @param x The x-coordinate within the canvas to start reading from.
+ * @param y The y-coordinate within the canvas to start reading from.
+ * @param width The width of the area within the canvas to read, in pixels.
+ * @param height The height of the area within the canvas to read, in pixels.
+ *
+ * @return A handle that receives the pixel data once it has arrived.
+ *
+ * @ingroup Graphics
+ */
+auto read_canvas_data_async(
+    const Image& canvas, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+    -> CanvasReadback;
+
 /**
  * Saves the pixel data of a canvas to a file.
  *
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cerlib/Audio.hpp>
 #include <cerlib/Event.hpp>
 #include <cerlib/Image.hpp>
 #include <cerlib/Logging.hpp>
@@ -87,6 +88,72 @@ struct GameTime
 
     /** The time that has elapsed since the game started running, in fractional seconds */
     double total_time{};
+
+    /**
+     * When a fixed update rate is set, the fraction of an update step (in the range [0, 1))
+     * that has accumulated but not been simulated yet. Use it to interpolate between the
+     * previous and the current state when drawing. Zero when no fixed update rate is set.
+     */
+    double interpolation_alpha{};
+};
+
+/**
+ * Represents options that control how the game loop calls update() and draw().
+ *
+ * By default, update() is called exactly once per frame with the real elapsed time,
+ * and frames are not limited other than by the window's vertical sync.
+ *
+ * @ingroup Game
+ */
+struct GameLoopOptions
+{
+    /** Default comparison */
+    auto operator==(const GameLoopOptions&) const -> bool = default;
+
+    /** Default comparison */
+    auto operator!=(const GameLoopOptions&) const -> bool = default;
+
+    /**
+     * If set, update() is called at this fixed rate (in Hz) with a constant elapsed time,
+     * as many times per frame as needed to catch up with real time. Frames that are
+     * faster than the update rate may not call update() at all.
+     */
+    std::optional<double> fixed_update_rate;
+
+    /**
+     * The maximum number of fixed update steps per frame. If the game falls further
+     * behind, the remaining time is dropped instead of being caught up later, which
+     * prevents the game from spiraling into ever longer frames.
+     */
+    uint32_t max_update_steps = 8;
+
+    /**
+     * If set, frames are paced to this rate (in Hz). The game loop sleeps for most of
+     * the remaining frame time and spins for the last part to hit the frame deadline
+     * precisely.
+     */
+    std::optional<double> target_fps;
+
+    /**
+     * If true, update() and draw() of the next frame run on a worker thread while the
+     * current frame is rendered on the main thread. The drawing functions that draw()
+     * calls are recorded and rendered one frame later, which overlaps the game's logic
+     * with sprite batching and submission at the cost of one frame of latency.
+     *
+     * Since update() and draw() no longer run on the main thread, they must not create
+     * windows or graphics resources (images, canvases, shaders, fonts and text objects),
+     * and must not read canvas data; do so in load_content() instead. Parameters of shaders
+     * that are in use should not be changed, since they are read when the frame is rendered.
+     * draw_imgui() still runs on the main thread, concurrently with update().
+     *
+     * Because objects are shared between both threads, pipelining requires cerlib to be
+     * built with the CERLIB_ATOMIC_REFCOUNTING option; otherwise, enabling it throws an
+     * exception. Graphics resources whose last reference is released by update() or draw()
+     * are destroyed on the main thread at the start of the next frame.
+     *
+     * Has no effect on the web, where the game runs on a single thread.
+     */
+    bool pipelined = false;
 };
 
 /**
@@ -114,6 +181,15 @@ class Game
      */
     explicit Game(bool enable_audio);
 
+    /**
+     * The game's constructor, intended to be called by deriving classes.
+     *
+     * @param audio_mode Specifies how the game produces audio. Passing AudioMode::Device
+     * is equivalent to Game(true), passing AudioMode::Disabled is equivalent to
+     * Game(false).
+     */
+    explicit Game(AudioMode audio_mode);
+
   public:
     Game(const Game&) = delete;
 
@@ -154,6 +230,26 @@ class Game
 
     auto gamepads() -> List<Gamepad>;
 
+    /**
+     * Gets the options of the game loop.
+     */
+    auto loop_options() -> GameLoopOptions;
+
+    /**
+     * Sets the options of the game loop.
+     *
+     * @param options The options to use, starting with the next frame.
+     */
+    void set_loop_options(const GameLoopOptions& options);
+
+    /**
+     * Gets the timing information of the current frame.
+     *
+     * This is the time that was last passed to update(), with an interpolation alpha
+     * that is valid for drawing the current frame, even if update() was not called in it.
+     */
+    auto current_time() -> GameTime;
+
   protected:
     virtual void load_content();
 
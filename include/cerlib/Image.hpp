@@ -39,6 +39,30 @@ enum class ImageFormat
 
     /** 128-bit RGBA floating-point, 32 bits per channel */
     R32G32B32A32_Float = 4,
+
+    /** Block-compressed RGB with 1-bit alpha, 4 bits per pixel (also known as DXT1) */
+    BC1_UNorm = 5,
+
+    /** Block-compressed RGB in sRGB space with 1-bit alpha, 4 bits per pixel */
+    BC1_Srgb = 6,
+
+    /** Block-compressed RGBA, 8 bits per pixel (also known as DXT5) */
+    BC3_UNorm = 7,
+
+    /** Block-compressed RGBA in sRGB space, 8 bits per pixel */
+    BC3_Srgb = 8,
+
+    /** Block-compressed RGB, 4 bits per pixel */
+    ETC2_RGB8_UNorm = 9,
+
+    /** Block-compressed RGB in sRGB space, 4 bits per pixel */
+    ETC2_RGB8_Srgb = 10,
+
+    /** Block-compressed RGBA, 8 bits per pixel (also known as ETC2 EAC) */
+    ETC2_RGBA8_UNorm = 11,
+
+    /** Block-compressed RGBA in sRGB space, 8 bits per pixel */
+    ETC2_RGBA8_Srgb = 12,
 };
 
 /**
@@ -58,6 +82,27 @@ enum class ImageFileFormat
     Bmp = 3,
 };
 
+/**
+ * Defines how an image is prepared when it's loaded from a file.
+ *
+ * @ingroup Graphics
+ */
+struct ImageLoadOptions
+{
+    /**
+     * If true, a chain of mipmaps is generated for the image, each half the size of the
+     * previous one. Samplers with a `MipFilter` other than `MipFilter::None` then sample
+     * the mipmap that fits the drawn size, which is faster and avoids aliasing when the
+     * image is drawn much smaller than its actual size.
+     *
+     * Mipmaps need about a third more memory. DDS and KTX2 files always use the mipmaps
+     * they contain instead.
+     */
+    bool generate_mipmaps = false;
+
+    auto operator==(const ImageLoadOptions&) const -> bool = default;
+};
+
 /**
  * Represents a 2D image.
  *
@@ -71,31 +116,41 @@ class Image : public GraphicsResource
     /**
      * Creates a 2D image from raw data.
      *
+     * Block-compressed data is stored as it is when the system supports the format.
+     * Otherwise it's decoded once, and the image gets the uncompressed format that
+     * corresponds to it.
+     *
      * @param width The width of the image, in pixels.
      * @param height The height of the image, in pixels.
      * @param format The pixel format of the image.
-     * @param data The initial data of the image.
+     * @param data The initial data of the image, image_slice_pitch() bytes.
      */
     explicit Image(uint32_t width, uint32_t height, ImageFormat format, const void* data);
 
     /**
      * Loads a 2D image from memory.
      * Supported file formats are:
-     *  - jpg, bmp, png, tga, gif, hdr, dds
+     *  - jpg, bmp, png, tga, gif, hdr, dds, ktx2
+     *
+     * DDS and KTX2 files may contain block-compressed images, which need 4 to 8 times
+     * less memory.
      *
      * @param memory The data to load.
+     * @param options How the image is prepared.
      */
-    explicit Image(std::span<const std::byte> memory);
+    explicit Image(std::span<const std::byte> memory, const ImageLoadOptions& options = {});
 
     /**
      * Lazily loads an Image object from the storage.
      *
      * @param asset_name The name of the image in the asset storage.
+     * @param options How the image is prepared. Loading the same asset with different
+     * options results in different images.
      *
      * @throw std::runtime_error If the asset does not exist or could not be read or
      * loaded.
      */
-    explicit Image(std::string_view asset_name);
+    explicit Image(std::string_view asset_name, const ImageLoadOptions& options = {});
 
     /**
      * Creates a 2D image to be used as a canvas.
@@ -128,13 +183,16 @@ class Image : public GraphicsResource
     /** Gets the underlying pixel format of the image. */
     auto format() const -> ImageFormat;
 
+    /** Gets the number of mipmaps of the image, including the full-size image itself. */
+    auto mipmap_count() const -> uint32_t;
+
     /** Gets the clear color of the image when it is set as a canvas. */
     auto canvas_clear_color() const -> std::optional<Color>;
 
     /** Sets the clear color of the image when it is set as a canvas. */
     void set_canvas_clear_color(std::optional<Color> value);
 
-    /** Gets the size of the image's pixel data, in bytes. */
+    /** Gets the size of the image's pixel data, including its mipmaps, in bytes. */
     auto size_in_bytes() const -> uint32_t;
 };
 
@@ -147,9 +205,21 @@ class Image : public GraphicsResource
  */
 auto image_format_bits_per_pixel(ImageFormat format) -> uint32_t;
 
+/**
+ * Gets a value indicating whether an image format stores its pixels in compressed
+ * blocks of 4x4 pixels.
+ *
+ * @param format The image format.
+ *
+ * @ingroup Graphics
+ */
+auto image_format_is_block_compressed(ImageFormat format) -> bool;
+
 /**
  * Gets the number of bytes in a row of a specific image format.
  *
+ * For block-compressed formats, this is the number of bytes in a row of blocks.
+ *
  * @param width The row width, in pixels.
  * @param format The image format.
  *
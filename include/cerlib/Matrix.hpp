@@ -5,10 +5,13 @@
 #pragma once
 
 #include <limits>
+#include <optional>
+#include <span>
 
 namespace cer
 {
 struct Vector2;
+struct Rectangle;
 
 /**
  * Represents a floating-point (single-precision) 4x4, row-major matrix.
@@ -64,37 +67,37 @@ struct Matrix
     /**
      * Gets a pointer to the beginning of the matrix's data.
      */
-    auto data() const -> const float*;
+    constexpr auto data() const -> const float*;
 
     /**
      * Gets the beginning iterator of the matrix.
      */
-    auto begin() -> float*;
+    constexpr auto begin() -> float*;
 
     /**
      * Gets the beginning iterator of the matrix.
      */
-    auto begin() const -> const float*;
+    constexpr auto begin() const -> const float*;
 
     /**
      * Gets the beginning iterator of the matrix.
      */
-    auto cbegin() const -> const float*;
+    constexpr auto cbegin() const -> const float*;
 
     /**
      * Gets the end iterator of the matrix.
      */
-    auto end() -> float*;
+    constexpr auto end() -> float*;
 
     /**
      * Gets the end iterator of the matrix.
      */
-    auto end() const -> const float*;
+    constexpr auto end() const -> const float*;
 
     /**
      * Gets the end iterator of the matrix.
      */
-    auto cend() const -> const float*;
+    constexpr auto cend() const -> const float*;
 
     /** Default comparison */
     auto operator==(const Matrix&) const -> bool = default;
@@ -127,7 +130,7 @@ struct Matrix
  *
  * @ingroup Math
  */
-auto transpose(const Matrix& matrix) -> Matrix;
+constexpr auto transpose(const Matrix& matrix) -> Matrix;
 
 /**
  * Creates a translation matrix.
@@ -136,7 +139,7 @@ auto transpose(const Matrix& matrix) -> Matrix;
  *
  * @ingroup Math
  */
-auto translate(Vector2 translation) -> Matrix;
+constexpr auto translate(Vector2 translation) -> Matrix;
 
 /**
  * Creates a scaling matrix.
@@ -145,7 +148,7 @@ auto translate(Vector2 translation) -> Matrix;
  *
  * @ingroup Math
  */
-auto scale(Vector2 scale) -> Matrix;
+constexpr auto scale(Vector2 scale) -> Matrix;
 
 /**
  * Creates a matrix that rotates around the Z-axis.
@@ -171,9 +174,75 @@ auto are_equal_within(const Matrix& lhs,
                       const Matrix& rhs,
                       float         threshold = std::numeric_limits<float>::epsilon()) -> bool;
 
-auto operator*(const Matrix& lhs, const Matrix& rhs) -> Matrix;
+/**
+ * Calculates the inverse of a matrix.
+ *
+ * @param matrix The matrix to invert.
+ *
+ * @return The inverse of the matrix, or an empty value if the matrix is not
+ * invertible.
+ *
+ * @ingroup Math
+ */
+auto inverse(const Matrix& matrix) -> std::optional<Matrix>;
+
+/**
+ * Transforms a 2D point by a matrix.
+ *
+ * The point is treated as (x, y, 0, 1). The projective part of the matrix is ignored,
+ * which is exact for any combination of translate(), scale() and rotate().
+ *
+ * @param point The point to transform.
+ * @param matrix The transformation to apply.
+ *
+ * @ingroup Math
+ */
+constexpr auto transform_point(Vector2 point, const Matrix& matrix) -> Vector2;
+
+/**
+ * Transforms a range of 2D points by a matrix.
+ *
+ * This produces the same results as calling transform_point() for every point, but
+ * processes multiple points at once.
+ *
+ * @param points The points to transform.
+ * @param matrix The transformation to apply.
+ * @param destination The span that receives the transformed points. It may refer to
+ * the same memory as points, in which case the points are transformed in place.
+ *
+ * @throw std::invalid_argument If destination is smaller than points.
+ *
+ * @ingroup Math
+ */
+void transform_points(std::span<const Vector2> points,
+                      const Matrix&            matrix,
+                      std::span<Vector2>       destination);
+
+/**
+ * Transforms a range of rectangles by a matrix.
+ *
+ * Each resulting rectangle is the axis-aligned bounding rectangle of the four
+ * transformed corners of its source rectangle. This is useful to determine the
+ * on-screen area of transformed objects, e.g. for visibility tests.
+ *
+ * @param rects The rectangles to transform.
+ * @param matrix The transformation to apply.
+ * @param destination The span that receives the transformed rectangles. It may refer
+ * to the same memory as rects, in which case the rectangles are transformed in place.
+ *
+ * @throw std::invalid_argument If destination is smaller than rects.
+ *
+ * @ingroup Math
+ */
+void transform_rects(std::span<const Rectangle> rects,
+                     const Matrix&              matrix,
+                     std::span<Rectangle>       destination);
+
+constexpr auto operator*(const Matrix& lhs, const Matrix& rhs) -> Matrix;
 } // namespace cer
 
+#include <cerlib/Vector2.hpp>
+
 namespace cer
 {
 constexpr Matrix::Matrix(float m11,
@@ -218,4 +287,140 @@ constexpr Matrix::Matrix(float diagonal_value)
     , m44(diagonal_value)
 {
 }
+
+constexpr auto Matrix::data() const -> const float*
+{
+    return &m11;
+}
+
+constexpr auto Matrix::begin() -> float*
+{
+    return &m11;
+}
+
+constexpr auto Matrix::begin() const -> const float*
+{
+    return &m11;
+}
+
+constexpr auto Matrix::cbegin() const -> const float*
+{
+    return &m11;
+}
+
+constexpr auto Matrix::end() -> float*
+{
+    return &m11 + 16;
+}
+
+constexpr auto Matrix::end() const -> const float*
+{
+    return &m11 + 16;
+}
+
+constexpr auto Matrix::cend() const -> const float*
+{
+    return &m11 + 16;
+}
+
+constexpr auto operator*(const Matrix& lhs, const Matrix& rhs) -> Matrix
+{
+    return {
+        (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21) + (lhs.m13 * rhs.m31) + (lhs.m14 * rhs.m41),
+        (lhs.m11 * rhs.m12) + (lhs.m12 * rhs.m22) + (lhs.m13 * rhs.m32) + (lhs.m14 * rhs.m42),
+        (lhs.m11 * rhs.m13) + (lhs.m12 * rhs.m23) + (lhs.m13 * rhs.m33) + (lhs.m14 * rhs.m43),
+        (lhs.m11 * rhs.m14) + (lhs.m12 * rhs.m24) + (lhs.m13 * rhs.m34) + (lhs.m14 * rhs.m44),
+        (lhs.m21 * rhs.m11) + (lhs.m22 * rhs.m21) + (lhs.m23 * rhs.m31) + (lhs.m24 * rhs.m41),
+        (lhs.m21 * rhs.m12) + (lhs.m22 * rhs.m22) + (lhs.m23 * rhs.m32) + (lhs.m24 * rhs.m42),
+        (lhs.m21 * rhs.m13) + (lhs.m22 * rhs.m23) + (lhs.m23 * rhs.m33) + (lhs.m24 * rhs.m43),
+        (lhs.m21 * rhs.m14) + (lhs.m22 * rhs.m24) + (lhs.m23 * rhs.m34) + (lhs.m24 * rhs.m44),
+        (lhs.m31 * rhs.m11) + (lhs.m32 * rhs.m21) + (lhs.m33 * rhs.m31) + (lhs.m34 * rhs.m41),
+        (lhs.m31 * rhs.m12) + (lhs.m32 * rhs.m22) + (lhs.m33 * rhs.m32) + (lhs.m34 * rhs.m42),
+        (lhs.m31 * rhs.m13) + (lhs.m32 * rhs.m23) + (lhs.m33 * rhs.m33) + (lhs.m34 * rhs.m43),
+        (lhs.m31 * rhs.m14) + (lhs.m32 * rhs.m24) + (lhs.m33 * rhs.m34) + (lhs.m34 * rhs.m44),
+        (lhs.m41 * rhs.m11) + (lhs.m42 * rhs.m21) + (lhs.m43 * rhs.m31) + (lhs.m44 * rhs.m41),
+        (lhs.m41 * rhs.m12) + (lhs.m42 * rhs.m22) + (lhs.m43 * rhs.m32) + (lhs.m44 * rhs.m42),
+        (lhs.m41 * rhs.m13) + (lhs.m42 * rhs.m23) + (lhs.m43 * rhs.m33) + (lhs.m44 * rhs.m43),
+        (lhs.m41 * rhs.m14) + (lhs.m42 * rhs.m24) + (lhs.m43 * rhs.m34) + (lhs.m44 * rhs.m44),
+    };
+}
+
+constexpr auto transpose(const Matrix& matrix) -> Matrix
+{
+    // NOLINTBEGIN
+    return {
+        matrix.m11,
+        matrix.m21,
+        matrix.m31,
+        matrix.m41,
+        matrix.m12,
+        matrix.m22,
+        matrix.m32,
+        matrix.m42,
+        matrix.m13,
+        matrix.m23,
+        matrix.m33,
+        matrix.m43,
+        matrix.m14,
+        matrix.m24,
+        matrix.m34,
+        matrix.m44,
+    };
+    // NOLINTEND
+}
+
+constexpr auto translate(Vector2 translation) -> Matrix
+{
+    const float x = translation.x;
+    const float y = translation.y;
+
+    return {
+        1,
+        0,
+        0,
+        0,
+        0,
+        1,
+        0,
+        0,
+        0,
+        0,
+        1,
+        0,
+        x,
+        y,
+        0,
+        1,
+    };
+}
+
+constexpr auto scale(Vector2 scale) -> Matrix
+{
+    return {
+        scale.x,
+        0,
+        0,
+        0,
+        0,
+        scale.y,
+        0,
+        0,
+        0,
+        0,
+        1,
+        0,
+        0,
+        0,
+        0,
+        1,
+    };
+}
+
+constexpr auto transform_point(Vector2 point, const Matrix& matrix) -> Vector2
+{
+    return {
+        (point.x * matrix.m11) + (point.y * matrix.m21) + matrix.m41,
+        (point.x * matrix.m12) + (point.y * matrix.m22) + matrix.m42,
+    };
+}
 } // namespace cer
@@ -13,6 +13,7 @@ namespace cer
 namespace details
 {
 class GraphicsDevice;
+class DrawCommandList;
 }
 
 /**
@@ -34,6 +35,7 @@ class GraphicsDevice;
 class ParticleSystem
 {
     friend details::GraphicsDevice;
+    friend details::DrawCommandList;
 
   public:
     ParticleSystem();
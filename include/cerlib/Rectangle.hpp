@@ -30,60 +30,60 @@ struct Rectangle
     constexpr Rectangle(Vector2 position, float width, float height);
 
     /** Gets the left border coordinate of the rectangle (equivalent to x). */
-    auto left() const -> float;
+    constexpr auto left() const -> float;
 
     /** Gets the top border coordinate of the rectangle (equivalent to y). */
-    auto top() const -> float;
+    constexpr auto top() const -> float;
 
     /** Gets the right border coordinate of the rectangle (equivalent to x + width). */
-    auto right() const -> float;
+    constexpr auto right() const -> float;
 
     /** Gets the bottom border coordinate of the rectangle (equivalent to y + height). */
-    auto bottom() const -> float;
+    constexpr auto bottom() const -> float;
 
     /** Gets the center point of the rectangle. */
-    auto center() const -> Vector2;
+    constexpr auto center() const -> Vector2;
 
     /** Gets the top-left corner of the rectangle. */
-    auto top_left() const -> Vector2;
+    constexpr auto top_left() const -> Vector2;
 
     /** Gets the top-center point of the rectangle. */
-    auto top_center() const -> Vector2;
+    constexpr auto top_center() const -> Vector2;
 
     /** Gets the top-right corner of the rectangle. */
-    auto top_right() const -> Vector2;
+    constexpr auto top_right() const -> Vector2;
 
     /** Gets the bottom-left corner of the rectangle. */
-    auto bottom_left() const -> Vector2;
+    constexpr auto bottom_left() const -> Vector2;
 
     /** Gets the bottom-center point of the rectangle. */
-    auto bottom_center() const -> Vector2;
+    constexpr auto bottom_center() const -> Vector2;
 
     /** Gets the bottom-right corner of the rectangle. */
-    auto bottom_right() const -> Vector2;
+    constexpr auto bottom_right() const -> Vector2;
 
     /** Scales all components of the rectangle by a specific factor. */
-    auto scaled(const Vector2& scale) const -> Rectangle;
+    constexpr auto scaled(const Vector2& scale) const -> Rectangle;
 
     /** Gets a value indicating whether the rectangle contains a specific point. */
-    auto contains(const Vector2& vector) const -> bool;
+    constexpr auto contains(const Vector2& vector) const -> bool;
 
     /** Gets a value indicating whether the rectangle fully contains a specific rectangle.
      */
-    auto contains(const Rectangle& other) const -> bool;
+    constexpr auto contains(const Rectangle& other) const -> bool;
 
     /**
      * Gets a version of the rectangle that is inflated by a specific amount.
      * @param amount The amount by which to inflate the rectangle.
      */
-    auto inflated(float amount) const -> Rectangle;
+    constexpr auto inflated(float amount) const -> Rectangle;
 
     /**
      * Gets a version of the rectangle that is moved by a specific amount.
      *
      * @param offset The amount by which to move the rectangle.
      */
-    auto offset(const Vector2& offset) const -> Rectangle;
+    constexpr auto offset(const Vector2& offset) const -> Rectangle;
 
     /**
      * Gets a value indicating whether the rectangle intersects with a specific
@@ -91,7 +91,7 @@ struct Rectangle
      *
      * @param other The rectangle to test for intersection.
      */
-    auto intersects(const Rectangle& other) const -> bool;
+    constexpr auto intersects(const Rectangle& other) const -> bool;
 
     /**
      * Gets a value indicating whether the rectangle intersects with a specific
@@ -138,12 +138,12 @@ struct Rectangle
     /**
      * Gets the top-left corner of the rectangle as a vector.
      */
-    auto position() const -> Vector2;
+    constexpr auto position() const -> Vector2;
 
     /**
      * Gets the size of the rectangle as a vector.
      */
-    auto size() const -> Vector2;
+    constexpr auto size() const -> Vector2;
 
     /** Default comparison */
     auto operator==(const Rectangle&) const -> bool = default;
@@ -206,4 +206,120 @@ constexpr Rectangle::Rectangle(Vector2 position, float width, float height)
     , height(height)
 {
 }
+
+constexpr auto Rectangle::left() const -> float
+{
+    return x;
+}
+
+constexpr auto Rectangle::top() const -> float
+{
+    return y;
+}
+
+constexpr auto Rectangle::right() const -> float
+{
+    return x + width;
+}
+
+constexpr auto Rectangle::bottom() const -> float
+{
+    return y + height;
+}
+
+constexpr auto Rectangle::center() const -> Vector2
+{
+    return {x + (width / 2), y + (height / 2)};
+}
+
+constexpr auto Rectangle::top_left() const -> Vector2
+{
+    return {x, y};
+}
+
+constexpr auto Rectangle::top_center() const -> Vector2
+{
+    return {x + (width / 2), y};
+}
+
+constexpr auto Rectangle::top_right() const -> Vector2
+{
+    return {x + width, y};
+}
+
+constexpr auto Rectangle::bottom_left() const -> Vector2
+{
+    return {x, y + height};
+}
+
+constexpr auto Rectangle::bottom_center() const -> Vector2
+{
+    return {x + (width / 2), y + height};
+}
+
+constexpr auto Rectangle::bottom_right() const -> Vector2
+{
+    return {x + width, y + height};
+}
+
+constexpr auto Rectangle::scaled(const Vector2& scale) const -> Rectangle
+{
+    return {x * scale.x, y * scale.y, width * scale.x, height * scale.y};
+}
+
+constexpr auto Rectangle::contains(const Vector2& vector) const -> bool
+{
+    if (x <= vector.x && vector.x < x + width && y <= vector.y)
+    {
+        return vector.y < y + height;
+    }
+
+    return false;
+}
+
+constexpr auto Rectangle::contains(const Rectangle& other) const -> bool
+{
+    if (x <= other.x && other.x + other.width <= x + width && y <= other.y)
+    {
+        return other.y + other.height <= y + height;
+    }
+
+    return false;
+}
+
+constexpr auto Rectangle::inflated(float amount) const -> Rectangle
+{
+    return {
+        x - amount,
+        y - amount,
+        width + (amount * 2),
+        height + (amount * 2),
+    };
+}
+
+constexpr auto Rectangle::offset(const Vector2& offset) const -> Rectangle
+{
+    return {
+        x + offset.x,
+        y + offset.y,
+        width,
+        height,
+    };
+}
+
+constexpr auto Rectangle::intersects(const Rectangle& other) const -> bool
+{
+    return other.left() < right() && left() < other.right() && other.top() < bottom() &&
+           top() < other.bottom();
+}
+
+constexpr auto Rectangle::position() const -> Vector2
+{
+    return {x, y};
+}
+
+constexpr auto Rectangle::size() const -> Vector2
+{
+    return {width, height};
+}
 } // namespace cer
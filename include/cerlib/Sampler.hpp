@@ -22,6 +22,28 @@ enum class ImageFilter
     Point,
 };
 
+/**
+ * Defines how a texture's mipmaps are selected and blended when it is sampled in a
+ * shader.
+ *
+ * Mipmaps only exist for images that were loaded with
+ * `ImageLoadOptions::generate_mipmaps`, or from DDS files that contain them. Images
+ * without mipmaps are sampled as if the mip filter was `MipFilter::None`.
+ *
+ * @ingroup Graphics
+ */
+enum class MipFilter
+{
+    /** Always sample the full-size image */
+    None = 1,
+
+    /** Sample the mipmap that is closest to the drawn size */
+    Point,
+
+    /** Interpolate between the two mipmaps that are closest to the drawn size */
+    Linear,
+};
+
 /**
  * Defines how a texture's data is wrapped when it is sampled in a shader.
  *
@@ -109,6 +131,9 @@ struct Sampler
     /** */
     SamplerBorderColor border_color = SamplerBorderColor::OpaqueBlack;
 
+    /** How mipmaps are sampled. Images without mipmaps ignore this. */
+    MipFilter mip_filter = MipFilter::None;
+
     /** Default comparison */
     auto operator==(const Sampler&) const -> bool = default;
 
@@ -143,4 +168,26 @@ static constexpr auto linear_clamp = Sampler{
     .address_u = ImageAddressMode::ClampToEdgeTexels,
     .address_v = ImageAddressMode::ClampToEdgeTexels,
 };
+
+/**
+ * Linear filtering that blends between mipmaps, which avoids aliasing when images are
+ * drawn much smaller than their actual size.
+ */
+static constexpr auto trilinear_repeat = Sampler{
+    .filter     = ImageFilter::Linear,
+    .address_u  = ImageAddressMode::Repeat,
+    .address_v  = ImageAddressMode::Repeat,
+    .mip_filter = MipFilter::Linear,
+};
+
+/**
+ * Linear filtering that blends between mipmaps, which avoids aliasing when images are
+ * drawn much smaller than their actual size.
+ */
+static constexpr auto trilinear_clamp = Sampler{
+    .filter     = ImageFilter::Linear,
+    .address_u  = ImageAddressMode::ClampToEdgeTexels,
+    .address_v  = ImageAddressMode::ClampToEdgeTexels,
+    .mip_filter = MipFilter::Linear,
+};
 } // namespace cer
\ No newline at end of file
@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <cerlib/SoundTypes.hpp>
 #include <cerlib/details/ObjectMacros.hpp>
 #include <span>
+#include <string_view>
 
 namespace cer
 {
@@ -30,18 +32,21 @@ class Sound
      * `.wav` or `.mp3`. After the sound is created, the data may be released.
      *
      * @param data The data to load the sound from. The sound will create its own copy of the data.
+     * @param options Defines how the sound is prepared for playback.
      */
-    explicit Sound(std::span<const std::byte> data);
+    explicit Sound(std::span<const std::byte> data, const SoundLoadOptions& options = {});
 
     /**
      * Lazily loads a Sound object from the storage.
      *
      * @param asset_name The name of the sound in the asset storage.
+     * @param options Defines how the sound is prepared for playback. Loading the same
+     * asset with different options results in different sounds.
      *
      * @throw std::runtime_error If the asset does not exist or could not be read or
      * loaded.
      */
-    explicit Sound(std::string_view asset_name);
+    explicit Sound(std::string_view asset_name, const SoundLoadOptions& options = {});
 
     /** Stops playing the sound and all of its derived channels. */
     void stop();
@@ -35,4 +35,59 @@ enum class SoundInaudibleBehavior
      */
     KeepTickingIfInaudible = 3,
 };
+
+/**
+ * Defines how the decoded samples of a sound are stored in memory.
+ *
+ * @ingroup Audio
+ */
+enum class SoundSampleFormat
+{
+    /**
+     * 32-bit floating point samples. This is the format that the mixer works with.
+     */
+    Float32 = 1,
+
+    /**
+     * 16-bit integer samples, which are converted to floating point during playback.
+     * Takes half the memory of Float32, at a slight loss of precision.
+     */
+    Int16 = 2,
+
+    /**
+     * IMA-ADPCM compressed samples, which take 4 bits each and are decoded during
+     * playback. Takes roughly an eighth of the memory of Float32, at an audible loss of
+     * quality for quiet or very detailed sounds. Well suited for short sound effects.
+     */
+    Adpcm = 3,
+};
+
+/**
+ * Defines how a sound is prepared when it's loaded.
+ *
+ * The default options keep the sound as it was decoded.
+ *
+ * @ingroup Audio
+ */
+struct SoundLoadOptions
+{
+    /**
+     * If true, the sound is resampled to the sample rate of the audio device once,
+     * when it's loaded. Playing it at its normal speed then requires no resampling
+     * during mixing.
+     */
+    bool resample_to_device_rate = false;
+
+    /**
+     * The format in which the samples of the sound are stored.
+     */
+    SoundSampleFormat sample_format = SoundSampleFormat::Float32;
+
+    /**
+     * If true, all channels of the sound are mixed down to a single channel.
+     */
+    bool downmix_to_mono = false;
+
+    auto operator==(const SoundLoadOptions&) const -> bool = default;
+};
 } // namespace cer
@@ -42,5 +42,23 @@ class Text
                   const Font&                          font,
                   uint32_t                             font_size,
                   const std::optional<TextDecoration>& decoration = std::nullopt);
+
+    /** Gets a value indicating whether the text keeps its vertex data on the GPU. */
+    auto is_retained() const -> bool;
+
+    /**
+     * Sets whether the text keeps its final vertex data in a GPU buffer.
+     *
+     * A retained text is not queued glyph by glyph when drawn. Instead, its buffer is
+     * bound and drawn directly, using one draw call per font page. The vertex data is
+     * only regenerated when the font's glyph atlas changes; the drawing color is applied
+     * when drawing. Retained text uses the same shader and sampler as cer::draw_string().
+     *
+     * This is beneficial for large, static texts such as UI labels.
+     * Retaining is disabled by default.
+     *
+     * @param value If true, the text is retained on the GPU.
+     */
+    void set_retained(bool value);
 };
 } // namespace cer
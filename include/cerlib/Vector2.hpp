@@ -66,7 +66,7 @@ auto length(const Vector2& vector) -> float;
  *
  * @ingroup Math
  */
-auto length_squared(const Vector2& vector) -> float;
+constexpr auto length_squared(const Vector2& vector) -> float;
 
 /**
  * Calculates the normalized version of a 2D vector.
@@ -156,7 +156,7 @@ auto fastrand_angle_vector2() -> Vector2;
  *
  * @ingroup Math
  */
-auto dot(const Vector2& lhs, const Vector2& rhs) -> float;
+constexpr auto dot(const Vector2& lhs, const Vector2& rhs) -> float;
 
 /**
  * Calculates the distance between two 2D vectors.
@@ -170,7 +170,7 @@ auto distance(const Vector2& lhs, const Vector2& rhs) -> float;
  *
  * @ingroup Math
  */
-auto distance_squared(const Vector2& lhs, const Vector2& rhs) -> float;
+constexpr auto distance_squared(const Vector2& lhs, const Vector2& rhs) -> float;
 
 /**
  * Performs a linear interpolation between two 2D vectors.
@@ -181,7 +181,7 @@ auto distance_squared(const Vector2& lhs, const Vector2& rhs) -> float;
  *
  * @ingroup Math
  */
-auto lerp(const Vector2& start, const Vector2& end, float t) -> Vector2;
+constexpr auto lerp(const Vector2& start, const Vector2& end, float t) -> Vector2;
 
 /**
  * Performs a smoothstep interpolation from one 2D vector to another.
@@ -192,7 +192,7 @@ auto lerp(const Vector2& start, const Vector2& end, float t) -> Vector2;
  *
  * @ingroup Math
  */
-auto smoothstep(const Vector2& start, const Vector2& end, float t) -> Vector2;
+constexpr auto smoothstep(const Vector2& start, const Vector2& end, float t) -> Vector2;
 
 /**
  * Clamps a 2D vector into a specific range.
@@ -203,7 +203,7 @@ auto smoothstep(const Vector2& start, const Vector2& end, float t) -> Vector2;
  *
  * @ingroup Math
  */
-auto clamp(const Vector2& value, const Vector2& min, const Vector2& max) -> Vector2;
+constexpr auto clamp(const Vector2& value, const Vector2& min, const Vector2& max) -> Vector2;
 
 /**
  * Gets a value indicating whether all components of a 2D vector are exactly
@@ -244,7 +244,7 @@ auto are_equal_within(const Vector2& lhs,
  *
  * @ingroup Math
  */
-auto min(const Vector2& lhs, const Vector2& rhs) -> Vector2;
+constexpr auto min(const Vector2& lhs, const Vector2& rhs) -> Vector2;
 
 /**
  * Calculates the larger of two 2D vectors.
@@ -260,7 +260,7 @@ auto min(const Vector2& lhs, const Vector2& rhs) -> Vector2;
  *
  * @ingroup Math
  */
-auto max(const Vector2& lhs, const Vector2& rhs) -> Vector2;
+constexpr auto max(const Vector2& lhs, const Vector2& rhs) -> Vector2;
 
 /**
  * Calculates the normal of a 2D line.
@@ -277,98 +277,98 @@ auto line_normal(const Vector2& start, const Vector2& end) -> Vector2;
  *
  * @ingroup Math
  */
-auto operator+(const Vector2& lhs, const Vector2& rhs) -> Vector2;
+constexpr auto operator+(const Vector2& lhs, const Vector2& rhs) -> Vector2;
 
 /**
  * Subtracts two 2D vectors.
  *
  * @ingroup Math
  */
-auto operator-(const Vector2& lhs, const Vector2& rhs) -> Vector2;
+constexpr auto operator-(const Vector2& lhs, const Vector2& rhs) -> Vector2;
 
 /**
  * Multiplies two 2D vectors.
  *
  * @ingroup Math
  */
-auto operator*(const Vector2& lhs, const Vector2& rhs) -> Vector2;
+constexpr auto operator*(const Vector2& lhs, const Vector2& rhs) -> Vector2;
 
 /**
  * Multiplies a 2D vector by a number.
  *
  * @ingroup Math
  */
-auto operator*(const Vector2& lhs, float rhs) -> Vector2;
+constexpr auto operator*(const Vector2& lhs, float rhs) -> Vector2;
 
 /**
  * Multiplies a 2D vector by a number.
  *
  * @ingroup Math
  */
-auto operator*(float lhs, const Vector2& rhs) -> Vector2;
+constexpr auto operator*(float lhs, const Vector2& rhs) -> Vector2;
 
 /**
  * Divides a 2D vector by another 2D vector.
  *
  * @ingroup Math
  */
-auto operator/(const Vector2& lhs, const Vector2& rhs) -> Vector2;
+constexpr auto operator/(const Vector2& lhs, const Vector2& rhs) -> Vector2;
 
 /**
  * Divides a 2D vector by a number.
  *
  * @ingroup Math
  */
-auto operator/(const Vector2& lhs, float rhs) -> Vector2;
+constexpr auto operator/(const Vector2& lhs, float rhs) -> Vector2;
 
 /**
  * Adds a 2D vector to another 2D vector.
  *
  * @ingroup Math
  */
-auto operator+=(Vector2& vector, const Vector2& rhs) -> Vector2&;
+constexpr auto operator+=(Vector2& vector, const Vector2& rhs) -> Vector2&;
 
 /**
  * Subtracts a 2D vector from another 2D vector.
  *
  * @ingroup Math
  */
-auto operator-=(Vector2& vector, const Vector2& rhs) -> Vector2&;
+constexpr auto operator-=(Vector2& vector, const Vector2& rhs) -> Vector2&;
 
 /**
  * Scales a 2D vector by another 2D vector.
  *
  * @ingroup Math
  */
-auto operator*=(Vector2& vector, const Vector2& rhs) -> Vector2&;
+constexpr auto operator*=(Vector2& vector, const Vector2& rhs) -> Vector2&;
 
 /**
  * Scales a 2D vector by a number.
  *
  * @ingroup Math
  */
-auto operator*=(Vector2& vector, float rhs) -> Vector2&;
+constexpr auto operator*=(Vector2& vector, float rhs) -> Vector2&;
 
 /**
  * Divides a 2D vector by another 2D vector.
  *
  * @ingroup Math
  */
-auto operator/=(Vector2& vector, const Vector2& rhs) -> Vector2&;
+constexpr auto operator/=(Vector2& vector, const Vector2& rhs) -> Vector2&;
 
 /**
  * Divides a 2D vector by a number.
  *
  * @ingroup Math
  */
-auto operator/=(Vector2& vector, float rhs) -> Vector2&;
+constexpr auto operator/=(Vector2& vector, float rhs) -> Vector2&;
 
 /**
  * Negates a 2D vector.
  *
  * @ingroup Math
  */
-auto operator-(const Vector2& value) -> Vector2;
+constexpr auto operator-(const Vector2& value) -> Vector2;
 } // namespace cer
 
 template <>
@@ -406,6 +406,8 @@ class std::numeric_limits<cer::Vector2>
     }
 };
 
+#include <cerlib/Math.hpp>
+
 namespace cer
 {
 constexpr Vector2::Vector2() = default;
@@ -421,4 +423,162 @@ constexpr Vector2::Vector2(float x, float y)
     , y(y)
 {
 }
+
+constexpr auto length_squared(const Vector2& vector) -> float
+{
+    return (vector.x * vector.x) + (vector.y * vector.y);
+}
+
+constexpr auto dot(const Vector2& lhs, const Vector2& rhs) -> float
+{
+    return (lhs.x * rhs.x) + (lhs.y * rhs.y);
+}
+
+constexpr auto distance_squared(const Vector2& lhs, const Vector2& rhs) -> float
+{
+    return length_squared(rhs - lhs);
+}
+
+constexpr auto lerp(const Vector2& start, const Vector2& end, float t) -> Vector2
+{
+    return {
+        lerp(start.x, end.x, t),
+        lerp(start.y, end.y, t),
+    };
+}
+
+constexpr auto smoothstep(const Vector2& start, const Vector2& end, float t) -> Vector2
+{
+    return {
+        smoothstep(start.x, end.x, t),
+        smoothstep(start.y, end.y, t),
+    };
+}
+
+constexpr auto clamp(const Vector2& value, const Vector2& min, const Vector2& max) -> Vector2
+{
+    return {
+        clamp(value.x, min.x, max.x),
+        clamp(value.y, min.y, max.y),
+    };
+}
+
+constexpr auto min(const Vector2& lhs, const Vector2& rhs) -> Vector2
+{
+    return {
+        min(lhs.x, rhs.x),
+        min(lhs.y, rhs.y),
+    };
+}
+
+constexpr auto max(const Vector2& lhs, const Vector2& rhs) -> Vector2
+{
+    return {
+        max(lhs.x, rhs.x),
+        max(lhs.y, rhs.y),
+    };
+}
+
+constexpr auto operator+=(Vector2& vector, const Vector2& rhs) -> Vector2&
+{
+    vector.x += rhs.x;
+    vector.y += rhs.y;
+    return vector;
+}
+
+constexpr auto operator-=(Vector2& vector, const Vector2& rhs) -> Vector2&
+{
+    vector.x -= rhs.x;
+    vector.y -= rhs.y;
+    return vector;
+}
+
+constexpr auto operator*=(Vector2& vector, const Vector2& rhs) -> Vector2&
+{
+    vector.x *= rhs.x;
+    vector.y *= rhs.y;
+    return vector;
+}
+
+constexpr auto operator*=(Vector2& vector, float rhs) -> Vector2&
+{
+    vector.x *= rhs;
+    vector.y *= rhs;
+    return vector;
+}
+
+constexpr auto operator/=(Vector2& vector, const Vector2& rhs) -> Vector2&
+{
+    vector.x /= rhs.x;
+    vector.y /= rhs.y;
+    return vector;
+}
+
+constexpr auto operator/=(Vector2& vector, float rhs) -> Vector2&
+{
+    vector.x /= rhs;
+    vector.y /= rhs;
+    return vector;
+}
+
+constexpr auto operator-(const Vector2& value) -> Vector2
+{
+    return {
+        -value.x,
+        -value.y,
+    };
+}
+
+constexpr auto operator+(const Vector2& lhs, const Vector2& rhs) -> Vector2
+{
+    return {
+        lhs.x + rhs.x,
+        lhs.y + rhs.y,
+    };
+}
+
+constexpr auto operator-(const Vector2& lhs, const Vector2& rhs) -> Vector2
+{
+    return {
+        lhs.x - rhs.x,
+        lhs.y - rhs.y,
+    };
+}
+
+constexpr auto operator*(const Vector2& lhs, const Vector2& rhs) -> Vector2
+{
+    return {
+        lhs.x * rhs.x,
+        lhs.y * rhs.y,
+    };
+}
+
+constexpr auto operator*(const Vector2& lhs, float rhs) -> Vector2
+{
+    return {
+        lhs.x * rhs,
+        lhs.y * rhs,
+    };
+}
+
+constexpr auto operator*(float lhs, const Vector2& rhs) -> Vector2
+{
+    return rhs * lhs;
+}
+
+constexpr auto operator/(const Vector2& lhs, const Vector2& rhs) -> Vector2
+{
+    return {
+        lhs.x / rhs.x,
+        lhs.y / rhs.y,
+    };
+}
+
+constexpr auto operator/(const Vector2& lhs, float rhs) -> Vector2
+{
+    return {
+        lhs.x / rhs,
+        lhs.y / rhs,
+    };
+}
 } // namespace cer
@@ -72,7 +72,7 @@ auto length(const Vector3& vector) -> float;
  *
  * @ingroup Math
  */
-auto length_squared(const Vector3& vector) -> float;
+constexpr auto length_squared(const Vector3& vector) -> float;
 
 /**
  * Calculates the normalized version of a 3D vector.
@@ -154,14 +154,14 @@ auto random_vector3(float min = 0.0f, float max = 1.0f) -> Vector3;
  *
  * @ingroup Math
  */
-auto dot(const Vector3& lhs, const Vector3& rhs) -> float;
+constexpr auto dot(const Vector3& lhs, const Vector3& rhs) -> float;
 
 /**
  * Calculates the cross product of two 3D vectors.
  *
  * @ingroup Math
  */
-auto cross(const Vector3& lhs, const Vector3& rhs) -> Vector3;
+constexpr auto cross(const Vector3& lhs, const Vector3& rhs) -> Vector3;
 
 /**
  * Calculates the distance between two 3D vectors.
@@ -181,7 +181,7 @@ auto distance(const Vector3& lhs, const Vector3& rhs) -> float;
  *
  * @ingroup Math
  */
-auto distance_squared(const Vector3& lhs, const Vector3& rhs) -> float;
+constexpr auto distance_squared(const Vector3& lhs, const Vector3& rhs) -> float;
 
 /**
  * Performs a linear interpolation from one 3D vector to another.
@@ -191,7 +191,7 @@ auto distance_squared(const Vector3& lhs, const Vector3& rhs) -> float;
  *
  * @ingroup Math
  */
-auto lerp(const Vector3& start, const Vector3& end, float t) -> Vector3;
+constexpr auto lerp(const Vector3& start, const Vector3& end, float t) -> Vector3;
 
 /**
  * Performs a smoothstep interpolation from one 3D vector to another.
@@ -202,7 +202,7 @@ auto lerp(const Vector3& start, const Vector3& end, float t) -> Vector3;
  *
  * @ingroup Math
  */
-auto smoothstep(const Vector3& start, const Vector3& end, float t) -> Vector3;
+constexpr auto smoothstep(const Vector3& start, const Vector3& end, float t) -> Vector3;
 
 /**
  * Clamps a 3D vector into a specific range.
@@ -213,7 +213,7 @@ auto smoothstep(const Vector3& start, const Vector3& end, float t) -> Vector3;
  *
  * @ingroup Math
  */
-auto clamp(const Vector3& value, const Vector3& min, const Vector3& max) -> Vector3;
+constexpr auto clamp(const Vector3& value, const Vector3& min, const Vector3& max) -> Vector3;
 
 /**
  * Gets a value indicating whether all components of a 3D vector are exactly
@@ -254,7 +254,7 @@ auto are_equal_within(const Vector3& lhs,
  *
  * @ingroup Math
  */
-auto min(const Vector3& lhs, const Vector3& rhs) -> Vector3;
+constexpr auto min(const Vector3& lhs, const Vector3& rhs) -> Vector3;
 
 /**
  * Calculates the larger of two 3D vectors.
@@ -270,105 +270,105 @@ auto min(const Vector3& lhs, const Vector3& rhs) -> Vector3;
  *
  * @ingroup Math
  */
-auto max(const Vector3& lhs, const Vector3& rhs) -> Vector3;
+constexpr auto max(const Vector3& lhs, const Vector3& rhs) -> Vector3;
 
 /**
  * Adds two 3D vectors.
  *
  * @ingroup Math
  */
-auto operator+(const Vector3& lhs, const Vector3& rhs) -> Vector3;
+constexpr auto operator+(const Vector3& lhs, const Vector3& rhs) -> Vector3;
 
 /**
  * Subtracts two 3D vectors.
  *
  * @ingroup Math
  */
-auto operator-(const Vector3& lhs, const Vector3& rhs) -> Vector3;
+constexpr auto operator-(const Vector3& lhs, const Vector3& rhs) -> Vector3;
 
 /**
  * Multiplies two 3D vectors.
  *
  * @ingroup Math
  */
-auto operator*(const Vector3& lhs, const Vector3& rhs) -> Vector3;
+constexpr auto operator*(const Vector3& lhs, const Vector3& rhs) -> Vector3;
 
 /**
  * Multiplies a 3D vector by a number.
  *
  * @ingroup Math
  */
-auto operator*(const Vector3& lhs, float rhs) -> Vector3;
+constexpr auto operator*(const Vector3& lhs, float rhs) -> Vector3;
 
 /**
  * Multiplies a 3D vector by a number.
  *
  * @ingroup Math
  */
-auto operator*(float lhs, const Vector3& rhs) -> Vector3;
+constexpr auto operator*(float lhs, const Vector3& rhs) -> Vector3;
 
 /**
  * Divides a 3D vector by another 3D vector.
  *
  * @ingroup Math
  */
-auto operator/(const Vector3& lhs, const Vector3& rhs) -> Vector3;
+constexpr auto operator/(const Vector3& lhs, const Vector3& rhs) -> Vector3;
 
 /**
  * Divides a 3D vector by a number.
  *
  * @ingroup Math
  */
-auto operator/(const Vector3& lhs, float rhs) -> Vector3;
+constexpr auto operator/(const Vector3& lhs, float rhs) -> Vector3;
 
 /**
  * Adds a 3D vector to another 3D vector.
  *
  * @ingroup Math
  */
-auto operator+=(Vector3& vector, const Vector3& rhs) -> Vector3&;
+constexpr auto operator+=(Vector3& vector, const Vector3& rhs) -> Vector3&;
 
 /**
  * Subtracts a 3D vector from another 3D vector.
  *
  * @ingroup Math
  */
-auto operator-=(Vector3& vector, const Vector3& rhs) -> Vector3&;
+constexpr auto operator-=(Vector3& vector, const Vector3& rhs) -> Vector3&;
 
 /**
  * Scales a 3D vector by another 3D vector.
  *
  * @ingroup Math
  */
-auto operator*=(Vector3& vector, const Vector3& rhs) -> Vector3&;
+constexpr auto operator*=(Vector3& vector, const Vector3& rhs) -> Vector3&;
 
 /**
  * Scales a 3D vector by a number.
  *
  * @ingroup Math
  */
-auto operator*=(Vector3& vector, float rhs) -> Vector3&;
+constexpr auto operator*=(Vector3& vector, float rhs) -> Vector3&;
 
 /**
  * Divides a 3D vector by another 3D vector.
  *
  * @ingroup Math
  */
-auto operator/=(Vector3& vector, const Vector3& rhs) -> Vector3&;
+constexpr auto operator/=(Vector3& vector, const Vector3& rhs) -> Vector3&;
 
 /**
  * Divides a 3D vector by a number.
  *
  * @ingroup Math
  */
-auto operator/=(Vector3& vector, float rhs) -> Vector3&;
+constexpr auto operator/=(Vector3& vector, float rhs) -> Vector3&;
 
 /**
  * Negates a 3D vector.
  *
  * @ingroup Math
  */
-auto operator-(const Vector3& value) -> Vector3;
+constexpr auto operator-(const Vector3& value) -> Vector3;
 } // namespace cer
 
 template <>
@@ -406,6 +406,8 @@ class std::numeric_limits<cer::Vector3>
     }
 };
 
+#include <cerlib/Math.hpp>
+
 namespace cer
 {
 constexpr Vector3::Vector3() = default;
@@ -423,4 +425,189 @@ constexpr Vector3::Vector3(float x, float y, float z)
     , z(z)
 {
 }
+
+constexpr auto length_squared(const Vector3& vector) -> float
+{
+    return vector.x * vector.x + vector.y * vector.y + vector.z * vector.z;
+}
+
+constexpr auto dot(const Vector3& lhs, const Vector3& rhs) -> float
+{
+    return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
+}
+
+constexpr auto cross(const Vector3& lhs, const Vector3& rhs) -> Vector3
+{
+    return {
+        lhs.y * rhs.z - rhs.y * lhs.z,
+        lhs.z * rhs.x - rhs.z * lhs.x,
+        lhs.x * rhs.y - rhs.x * lhs.y,
+    };
+}
+
+constexpr auto distance_squared(const Vector3& lhs, const Vector3& rhs) -> float
+{
+    return length_squared(rhs - lhs);
+}
+
+constexpr auto lerp(const Vector3& start, const Vector3& end, float t) -> Vector3
+{
+    return {
+        lerp(start.x, end.x, t),
+        lerp(start.y, end.y, t),
+        lerp(start.z, end.z, t),
+    };
+}
+
+constexpr auto smoothstep(const Vector3& start, const Vector3& end, float t) -> Vector3
+{
+    return {
+        smoothstep(start.x, end.x, t),
+        smoothstep(start.y, end.y, t),
+        smoothstep(start.z, end.z, t),
+    };
+}
+
+constexpr auto clamp(const Vector3& value, const Vector3& min, const Vector3& max) -> Vector3
+{
+    return {
+        clamp(value.x, min.x, max.x),
+        clamp(value.y, min.y, max.y),
+        clamp(value.z, min.z, max.z),
+    };
+}
+
+constexpr auto min(const Vector3& lhs, const Vector3& rhs) -> Vector3
+{
+    return {
+        min(lhs.x, rhs.x),
+        min(lhs.y, rhs.y),
+        min(lhs.z, rhs.z),
+    };
+}
+
+constexpr auto max(const Vector3& lhs, const Vector3& rhs) -> Vector3
+{
+    return {
+        max(lhs.x, rhs.x),
+        max(lhs.y, rhs.y),
+        max(lhs.z, rhs.z),
+    };
+}
+
+constexpr auto operator+=(Vector3& vector, const Vector3& rhs) -> Vector3&
+{
+    vector.x += rhs.x;
+    vector.y += rhs.y;
+    vector.z += rhs.z;
+    return vector;
+}
+
+constexpr auto operator-=(Vector3& vector, const Vector3& rhs) -> Vector3&
+{
+    vector.x -= rhs.x;
+    vector.y -= rhs.y;
+    vector.z -= rhs.z;
+    return vector;
+}
+
+constexpr auto operator*=(Vector3& vector, const Vector3& rhs) -> Vector3&
+{
+    vector.x *= rhs.x;
+    vector.y *= rhs.y;
+    vector.z *= rhs.z;
+    return vector;
+}
+
+constexpr auto operator*=(Vector3& vector, float rhs) -> Vector3&
+{
+    vector.x *= rhs;
+    vector.y *= rhs;
+    vector.z *= rhs;
+    return vector;
+}
+
+constexpr auto operator/=(Vector3& vector, const Vector3& rhs) -> Vector3&
+{
+    vector.x /= rhs.x;
+    vector.y /= rhs.y;
+    vector.z /= rhs.z;
+    return vector;
+}
+
+constexpr auto operator/=(Vector3& vector, float rhs) -> Vector3&
+{
+    vector.x /= rhs;
+    vector.y /= rhs;
+    vector.z /= rhs;
+    return vector;
+}
+
+constexpr auto operator-(const Vector3& value) -> Vector3
+{
+    return {
+        -value.x,
+        -value.y,
+        -value.z,
+    };
+}
+
+constexpr auto operator+(const Vector3& lhs, const Vector3& rhs) -> Vector3
+{
+    return {
+        lhs.x + rhs.x,
+        lhs.y + rhs.y,
+        lhs.z + rhs.z,
+    };
+}
+
+constexpr auto operator-(const Vector3& lhs, const Vector3& rhs) -> Vector3
+{
+    return {
+        lhs.x - rhs.x,
+        lhs.y - rhs.y,
+        lhs.z - rhs.z,
+    };
+}
+
+constexpr auto operator*(const Vector3& lhs, const Vector3& rhs) -> Vector3
+{
+    return {
+        lhs.x * rhs.x,
+        lhs.y * rhs.y,
+        lhs.z * rhs.z,
+    };
+}
+
+constexpr auto operator*(const Vector3& lhs, float rhs) -> Vector3
+{
+    return {
+        lhs.x * rhs,
+        lhs.y * rhs,
+        lhs.z * rhs,
+    };
+}
+
+constexpr auto operator*(float lhs, const Vector3& rhs) -> Vector3
+{
+    return rhs * lhs;
+}
+
+constexpr auto operator/(const Vector3& lhs, const Vector3& rhs) -> Vector3
+{
+    return {
+        lhs.x / rhs.x,
+        lhs.y / rhs.y,
+        lhs.z / rhs.z,
+    };
+}
+
+constexpr auto operator/(const Vector3& lhs, float rhs) -> Vector3
+{
+    return {
+        lhs.x / rhs,
+        lhs.y / rhs,
+        lhs.z / rhs,
+    };
+}
 } // namespace cer
@@ -96,7 +96,7 @@ auto length(const Vector4& vector) -> float;
  *
  * @ingroup Math
  */
-auto length_squared(const Vector4& vector) -> float;
+constexpr auto length_squared(const Vector4& vector) -> float;
 
 /**
  * Calculates the normalized version of a 4D vector.
@@ -178,7 +178,7 @@ auto random_vector4(float min = 0.0f, float max = 1.0f) -> Vector4;
  *
  * @ingroup Math
  */
-auto dot(const Vector4& lhs, const Vector4& rhs) -> float;
+constexpr auto dot(const Vector4& lhs, const Vector4& rhs) -> float;
 
 /**
  * Calculates the distance between two 4D vectors.
@@ -198,7 +198,7 @@ auto distance(const Vector4& lhs, const Vector4& rhs) -> float;
  *
  * @ingroup Math
  */
-auto distance_squared(const Vector4& lhs, const Vector4& rhs) -> float;
+constexpr auto distance_squared(const Vector4& lhs, const Vector4& rhs) -> float;
 
 /**
  * Performs a linear interpolation from one 4D vector to another.
@@ -209,7 +209,7 @@ auto distance_squared(const Vector4& lhs, const Vector4& rhs) -> float;
  *
  * @ingroup Math
  */
-auto lerp(const Vector4& start, const Vector4& end, float t) -> Vector4;
+constexpr auto lerp(const Vector4& start, const Vector4& end, float t) -> Vector4;
 
 /**
  * Performs a smoothstep interpolation from one 4D vector to another.
@@ -220,7 +220,7 @@ auto lerp(const Vector4& start, const Vector4& end, float t) -> Vector4;
  *
  * @ingroup Math
  */
-auto smoothstep(const Vector4& start, const Vector4& end, float t) -> Vector4;
+constexpr auto smoothstep(const Vector4& start, const Vector4& end, float t) -> Vector4;
 
 /**
  * Clamps a 4D vector into a specific range.
@@ -231,7 +231,7 @@ auto smoothstep(const Vector4& start, const Vector4& end, float t) -> Vector4;
  *
  * @ingroup Math
  */
-auto clamp(const Vector4& value, const Vector4& min, const Vector4& max) -> Vector4;
+constexpr auto clamp(const Vector4& value, const Vector4& min, const Vector4& max) -> Vector4;
 
 /**
  * Gets a value indicating whether all components of a 4D vector are exactly
@@ -272,7 +272,7 @@ auto are_equal_within(const Vector4& lhs,
  *
  * @ingroup Math
  */
-auto min(const Vector4& lhs, const Vector4& rhs) -> Vector4;
+constexpr auto min(const Vector4& lhs, const Vector4& rhs) -> Vector4;
 
 /**
  * Calculates the larger of two 4D vectors.
@@ -288,105 +288,105 @@ auto min(const Vector4& lhs, const Vector4& rhs) -> Vector4;
  *
  * @ingroup Math
  */
-auto max(const Vector4& lhs, const Vector4& rhs) -> Vector4;
+constexpr auto max(const Vector4& lhs, const Vector4& rhs) -> Vector4;
 
 /**
  * Adds two 4D vectors.
  *
  * @ingroup Math
  */
-auto operator+(const Vector4& lhs, const Vector4& rhs) -> Vector4;
+constexpr auto operator+(const Vector4& lhs, const Vector4& rhs) -> Vector4;
 
 /**
  * Subtracts two 4D vectors.
  *
  * @ingroup Math
  */
-auto operator-(const Vector4& lhs, const Vector4& rhs) -> Vector4;
+constexpr auto operator-(const Vector4& lhs, const Vector4& rhs) -> Vector4;
 
 /**
  * Multiplies two 4D vectors.
  *
  * @ingroup Math
  */
-auto operator*(const Vector4& lhs, const Vector4& rhs) -> Vector4;
+constexpr auto operator*(const Vector4& lhs, const Vector4& rhs) -> Vector4;
 
 /**
  * Multiplies a 4D vector by a number.
  *
  * @ingroup Math
  */
-auto operator*(const Vector4& lhs, float rhs) -> Vector4;
+constexpr auto operator*(const Vector4& lhs, float rhs) -> Vector4;
 
 /**
  * Multiplies a 4D vector by a number.
  *
  * @ingroup Math
  */
-auto operator*(float lhs, const Vector4& rhs) -> Vector4;
+constexpr auto operator*(float lhs, const Vector4& rhs) -> Vector4;
 
 /**
  * Divides a 4D vector by another 4D vector.
  *
  * @ingroup Math
  */
-auto operator/(const Vector4& lhs, const Vector4& rhs) -> Vector4;
+constexpr auto operator/(const Vector4& lhs, const Vector4& rhs) -> Vector4;
 
 /**
  * Divides a 4D vector by a number.
  *
  * @ingroup Math
  */
-auto operator/(const Vector4& lhs, float rhs) -> Vector4;
+constexpr auto operator/(const Vector4& lhs, float rhs) -> Vector4;
 
 /**
  * Adds a 4D vector to another 4D vector.
  *
  * @ingroup Math
  */
-auto operator+=(Vector4& vector, const Vector4& rhs) -> Vector4&;
+constexpr auto operator+=(Vector4& vector, const Vector4& rhs) -> Vector4&;
 
 /**
  * Subtracts a 4D vector from another 4D vector.
  *
  * @ingroup Math
  */
-auto operator-=(Vector4& vector, const Vector4& rhs) -> Vector4&;
+constexpr auto operator-=(Vector4& vector, const Vector4& rhs) -> Vector4&;
 
 /**
  * Scales a 4D vector by another 4D vector.
  *
  * @ingroup Math
  */
-auto operator*=(Vector4& vector, const Vector4& rhs) -> Vector4&;
+constexpr auto operator*=(Vector4& vector, const Vector4& rhs) -> Vector4&;
 
 /**
  * Scales a 4D vector by a number.
  *
  * @ingroup Math
  */
-auto operator*=(Vector4& vector, float rhs) -> Vector4&;
+constexpr auto operator*=(Vector4& vector, float rhs) -> Vector4&;
 
 /**
  * Divides a 4D vector by another 4D vector.
  *
  * @ingroup Math
  */
-auto operator/=(Vector4& vector, const Vector4& rhs) -> Vector4&;
+constexpr auto operator/=(Vector4& vector, const Vector4& rhs) -> Vector4&;
 
 /**
  * Divides a 4D vector by a number.
  *
  * @ingroup Math
  */
-auto operator/=(Vector4& vector, float rhs) -> Vector4&;
+constexpr auto operator/=(Vector4& vector, float rhs) -> Vector4&;
 
 /**
  * Negates a 4D vector.
  *
  * @ingroup Math
  */
-auto operator-(const Vector4& value) -> Vector4;
+constexpr auto operator-(const Vector4& value) -> Vector4;
 } // namespace cer
 
 template <>
@@ -424,6 +424,7 @@ class std::numeric_limits<cer::Vector4>
     }
 };
 
+#include <cerlib/Math.hpp>
 #include <cerlib/Vector2.hpp>
 #include <cerlib/Vector3.hpp>
 
@@ -470,4 +471,198 @@ constexpr Vector4::Vector4(Vector3 xyz, float w)
     , w(w)
 {
 }
+
+constexpr auto length_squared(const Vector4& vector) -> float
+{
+    return vector.x * vector.x + vector.y * vector.y + vector.z * vector.z + vector.w * vector.w;
+}
+
+constexpr auto dot(const Vector4& lhs, const Vector4& rhs) -> float
+{
+    return (lhs.x * rhs.x) + (lhs.y * rhs.y) + (lhs.z * rhs.z) + (lhs.w * rhs.w);
+}
+
+constexpr auto distance_squared(const Vector4& lhs, const Vector4& rhs) -> float
+{
+    return length_squared(rhs - lhs);
+}
+
+constexpr auto lerp(const Vector4& start, const Vector4& end, float t) -> Vector4
+{
+    return {
+        lerp(start.x, end.x, t),
+        lerp(start.y, end.y, t),
+        lerp(start.z, end.z, t),
+        lerp(start.w, end.w, t),
+    };
+}
+
+constexpr auto smoothstep(const Vector4& start, const Vector4& end, float t) -> Vector4
+{
+    return {
+        smoothstep(start.x, end.x, t),
+        smoothstep(start.y, end.y, t),
+        smoothstep(start.z, end.z, t),
+        smoothstep(start.w, end.w, t),
+    };
+}
+
+constexpr auto clamp(const Vector4& value, const Vector4& min, const Vector4& max) -> Vector4
+{
+    return {
+        clamp(value.x, min.x, max.x),
+        clamp(value.y, min.y, max.y),
+        clamp(value.z, min.z, max.z),
+        clamp(value.w, min.w, max.w),
+    };
+}
+
+constexpr auto min(const Vector4& lhs, const Vector4& rhs) -> Vector4
+{
+    return {
+        min(lhs.x, rhs.x),
+        min(lhs.y, rhs.y),
+        min(lhs.z, rhs.z),
+        min(lhs.w, rhs.w),
+    };
+}
+
+constexpr auto max(const Vector4& lhs, const Vector4& rhs) -> Vector4
+{
+    return {
+        max(lhs.x, rhs.x),
+        max(lhs.y, rhs.y),
+        max(lhs.z, rhs.z),
+        max(lhs.w, rhs.w),
+    };
+}
+
+constexpr auto operator+=(Vector4& vector, const Vector4& rhs) -> Vector4&
+{
+    vector.x += rhs.x;
+    vector.y += rhs.y;
+    vector.z += rhs.z;
+    vector.w += rhs.w;
+    return vector;
+}
+
+constexpr auto operator-=(Vector4& vector, const Vector4& rhs) -> Vector4&
+{
+    vector.x -= rhs.x;
+    vector.y -= rhs.y;
+    vector.z -= rhs.z;
+    vector.w -= rhs.w;
+    return vector;
+}
+
+constexpr auto operator*=(Vector4& vector, const Vector4& rhs) -> Vector4&
+{
+    vector.x *= rhs.x;
+    vector.y *= rhs.y;
+    vector.z *= rhs.z;
+    vector.w *= rhs.w;
+    return vector;
+}
+
+constexpr auto operator*=(Vector4& vector, float rhs) -> Vector4&
+{
+    vector.x *= rhs;
+    vector.y *= rhs;
+    vector.z *= rhs;
+    vector.w *= rhs;
+    return vector;
+}
+
+constexpr auto operator/=(Vector4& vector, const Vector4& rhs) -> Vector4&
+{
+    vector.x /= rhs.x;
+    vector.y /= rhs.y;
+    vector.z /= rhs.z;
+    vector.w /= rhs.w;
+    return vector;
+}
+
+constexpr auto operator/=(Vector4& vector, float rhs) -> Vector4&
+{
+    vector.x /= rhs;
+    vector.y /= rhs;
+    vector.z /= rhs;
+    vector.w /= rhs;
+    return vector;
+}
+
+constexpr auto operator-(const Vector4& value) -> Vector4
+{
+    return {
+        -value.x,
+        -value.y,
+        -value.z,
+        -value.w,
+    };
+}
+
+constexpr auto operator+(const Vector4& lhs, const Vector4& rhs) -> Vector4
+{
+    return {
+        lhs.x + rhs.x,
+        lhs.y + rhs.y,
+        lhs.z + rhs.z,
+        lhs.w + rhs.w,
+    };
+}
+
+constexpr auto operator-(const Vector4& lhs, const Vector4& rhs) -> Vector4
+{
+    return {
+        lhs.x - rhs.x,
+        lhs.y - rhs.y,
+        lhs.z - rhs.z,
+        lhs.w - rhs.w,
+    };
+}
+
+constexpr auto operator*(const Vector4& lhs, const Vector4& rhs) -> Vector4
+{
+    return {
+        lhs.x * rhs.x,
+        lhs.y * rhs.y,
+        lhs.z * rhs.z,
+        lhs.w * rhs.w,
+    };
+}
+
+constexpr auto operator*(const Vector4& lhs, float rhs) -> Vector4
+{
+    return {
+        lhs.x * rhs,
+        lhs.y * rhs,
+        lhs.z * rhs,
+        lhs.w * rhs,
+    };
+}
+
+constexpr auto operator*(float lhs, const Vector4& rhs) -> Vector4
+{
+    return rhs * lhs;
+}
+
+constexpr auto operator/(const Vector4& lhs, const Vector4& rhs) -> Vector4
+{
+    return {
+        lhs.x / rhs.x,
+        lhs.y / rhs.y,
+        lhs.z / rhs.z,
+        lhs.w / rhs.w,
+    };
+}
+
+constexpr auto operator/(const Vector4& lhs, float rhs) -> Vector4
+{
+    return {
+        lhs.x / rhs,
+        lhs.y / rhs,
+        lhs.z / rhs,
+        lhs.w / rhs,
+    };
+}
 } // namespace cer
@@ -0,0 +1,199 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "audio/Adpcm.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+namespace cer::details
+{
+static constexpr auto s_step_table = std::array<int16_t, 89>{
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,    19,    21,    23,
+    25,    28,    31,    34,    37,    41,    45,    50,    55,    60,    66,    73,    80,
+    88,    97,    107,   118,   130,   143,   157,   173,   190,   209,   230,   253,   279,
+    307,   337,   371,   408,   449,   494,   544,   598,   658,   724,   796,   876,   963,
+    1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,  2272,  2499,  2749,  3024,  3327,
+    3660,  4026,  4428,  4871,  5358,  5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487,
+    12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+};
+
+// Only the magnitude of a code affects the next step index.
+static constexpr auto s_index_table = std::array<int8_t, 8>{-1, -1, -1, -1, 2, 4, 6, 8};
+
+namespace
+{
+// The predictor delta and the next step index for every step index and 3-bit magnitude,
+// which turns the decoder's bit tests and index clamping into two lookups.
+struct AdpcmTables
+{
+    std::array<std::array<int16_t, 8>, 89> delta{};
+    std::array<std::array<uint8_t, 8>, 89> next_index{};
+};
+
+constexpr auto make_adpcm_tables() -> AdpcmTables
+{
+    auto tables = AdpcmTables{};
+
+    for (size_t index = 0; index < s_step_table.size(); ++index)
+    {
+        const auto step = int(s_step_table[index]);
+
+        for (size_t code = 0; code < 8; ++code)
+        {
+            auto delta = step >> 3;
+
+            if ((code & 4) != 0)
+            {
+                delta += step;
+            }
+
+            if ((code & 2) != 0)
+            {
+                delta += step >> 1;
+            }
+
+            if ((code & 1) != 0)
+            {
+                delta += step >> 2;
+            }
+
+            tables.delta[index][code] = int16_t(delta);
+            tables.next_index[index][code] =
+                uint8_t(std::clamp(int(index) + s_index_table[code], 0, 88));
+        }
+    }
+
+    return tables;
+}
+
+constexpr auto s_adpcm_tables = make_adpcm_tables();
+
+struct AdpcmState
+{
+    int predictor{};
+    int index{};
+
+    // Applies a code to the state, exactly like the decoder does. Returns the new sample.
+    auto apply(int code) -> int
+    {
+        const auto magnitude = size_t(code & 7);
+        const auto delta     = int(s_adpcm_tables.delta[size_t(index)][magnitude]);
+
+        predictor = std::clamp((code & 8) != 0 ? predictor - delta : predictor + delta,
+                               -32768,
+                               32767);
+
+        index = s_adpcm_tables.next_index[size_t(index)][magnitude];
+
+        return predictor;
+    }
+
+    auto encode(int sample) -> int
+    {
+        const auto step = int(s_step_table[size_t(index)]);
+
+        auto diff = sample - predictor;
+        auto code = 0;
+
+        if (diff < 0)
+        {
+            code = 8;
+            diff = -diff;
+        }
+
+        if (diff >= step)
+        {
+            code |= 4;
+            diff -= step;
+        }
+
+        if (diff >= step >> 1)
+        {
+            code |= 2;
+            diff -= step >> 1;
+        }
+
+        if (diff >= step >> 2)
+        {
+            code |= 1;
+        }
+
+        apply(code);
+
+        return code;
+    }
+};
+} // namespace
+
+auto adpcm_block_count(size_t sample_count) -> size_t
+{
+    return (sample_count + adpcm_block_sample_count - 1) / adpcm_block_sample_count;
+}
+
+void adpcm_encode(const float* src, size_t sample_count, uint8_t* dst)
+{
+    auto state = AdpcmState{};
+
+    // Start with a step that fits the first samples, instead of adapting to them over the
+    // first few codes, which would be audible as a click in sounds that start loud.
+    if (sample_count > 1)
+    {
+        const auto first_delta = int(std::abs(src[1] - src[0]) * 32767.0f);
+
+        while (state.index < 88 && s_step_table[size_t(state.index)] < first_delta)
+        {
+            ++state.index;
+        }
+    }
+
+    for (size_t first = 0; first < sample_count; first += adpcm_block_sample_count)
+    {
+        const auto predictor = int16_t(state.predictor);
+
+        std::memcpy(dst, &predictor, sizeof(predictor));
+        dst[2] = uint8_t(state.index);
+        dst[3] = 0;
+
+        auto* codes = dst + adpcm_block_header_size;
+
+        const auto sample = [&](size_t index) {
+            const auto value = first + index < sample_count ? src[first + index] : 0.0f;
+            return int(std::lrint(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+        };
+
+        for (size_t i = 0; i < adpcm_block_sample_count; i += 2)
+        {
+            const auto low  = state.encode(sample(i));
+            const auto high = state.encode(sample(i + 1));
+
+            codes[i / 2] = uint8_t(low | (high << 4));
+        }
+
+        dst += adpcm_block_size;
+    }
+}
+
+void adpcm_decode_block(const uint8_t* block, float* dst)
+{
+    auto predictor = int16_t();
+    std::memcpy(&predictor, block, sizeof(predictor));
+
+    auto state = AdpcmState{
+        .predictor = predictor,
+        .index     = std::min(int(block[2]), 88),
+    };
+
+    const auto* codes = block + adpcm_block_header_size;
+
+    for (size_t i = 0; i < adpcm_block_sample_count; i += 2)
+    {
+        const auto code = codes[i / 2];
+
+        dst[i]     = float(state.apply(code & 0xf)) * (1.0f / 32767.0f);
+        dst[i + 1] = float(state.apply(code >> 4)) * (1.0f / 32767.0f);
+    }
+}
+} // namespace cer::details
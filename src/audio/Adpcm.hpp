@@ -0,0 +1,31 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cer::details
+{
+// IMA-ADPCM, which stores every sample as a 4-bit code.
+//
+// Samples are encoded in blocks of adpcm_block_sample_count. Each block starts with the
+// decoder state, so that blocks can be decoded independently of each other, which is what
+// seeking and looping need.
+static constexpr size_t adpcm_block_sample_count = 256;
+static constexpr size_t adpcm_block_header_size  = 4;
+static constexpr size_t adpcm_block_size =
+    adpcm_block_header_size + (adpcm_block_sample_count / 2);
+
+// Number of blocks that sample_count samples are encoded into.
+auto adpcm_block_count(size_t sample_count) -> size_t;
+
+// Encodes sample_count samples into adpcm_block_count(sample_count) blocks, which dst must
+// have room for. The last block is padded with silence.
+void adpcm_encode(const float* src, size_t sample_count, uint8_t* dst);
+
+// Decodes all adpcm_block_sample_count samples of a single block.
+void adpcm_decode_block(const uint8_t* block, float* dst);
+} // namespace cer::details
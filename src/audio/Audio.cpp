@@ -82,3 +82,57 @@ void cer::fade_global_volume(float to_volume, SoundTime fade_duration)
     LOAD_AUDIO_ENGINE_IMPL_OR_RETURN;
     impl.fade_global_volume(to_volume, fade_duration);
 }
+
+auto cer::audio_mode() -> AudioMode
+{
+    LOAD_AUDIO_ENGINE_IMPL_OR_RETURN_VALUE(AudioMode::Disabled);
+    return impl.backend() == AudioBackend::NullDriver ? AudioMode::Offline : AudioMode::Device;
+}
+
+auto cer::audio_sample_rate() -> uint32_t
+{
+    LOAD_AUDIO_ENGINE_IMPL_OR_RETURN_VALUE(0);
+    return uint32_t(impl.backend_sample_rate());
+}
+
+auto cer::audio_channel_count() -> uint32_t
+{
+    LOAD_AUDIO_ENGINE_IMPL_OR_RETURN_VALUE(0);
+    return uint32_t(impl.backend_channels());
+}
+
+void cer::render_audio(std::span<float> destination)
+{
+    details::GameImpl::instance().audio_device().render_offline(destination);
+}
+
+void cer::render_audio_to_file(std::string_view filename, SoundTime duration)
+{
+    if (duration < 0.0)
+    {
+        throw std::invalid_argument{"The duration must not be negative."};
+    }
+
+    auto& device = details::GameImpl::instance().audio_device();
+
+    const auto frame_count = size_t(std::llround(duration * double(device.backend_sample_rate())));
+
+    device.render_offline_to_file(filename, frame_count);
+}
+
+auto cer::audio_mixer_stats() -> AudioMixerStats
+{
+    LOAD_AUDIO_ENGINE_IMPL_OR_RETURN_VALUE(AudioMixerStats{});
+    return impl.mixer_stats();
+}
+
+void cer::set_audio_mix_thread_count(uint32_t count)
+{
+    if (count == 0)
+    {
+        throw std::invalid_argument{"The number of mix threads must not be zero."};
+    }
+
+    LOAD_AUDIO_ENGINE_IMPL_OR_RETURN;
+    impl.set_mix_worker_count(count - 1);
+}
@@ -6,16 +6,23 @@
 
 #include "SoundChannelImpl.hpp"
 #include "SoundImpl.hpp"
+#include "audio/Bus.hpp"
 #include "audio/FFT.hpp"
 #include "audio/Misc.hpp"
+#include "audio/Resampler.hpp"
 #include "audio/Thread.hpp"
 #include "cerlib/Logging.hpp"
 #include "cerlib/SoundChannel.hpp"
+#include "dr_wav.h"
+#include "math/Float4.hpp"
 #include "soloud_internal.hpp"
 #include <algorithm>
 #include <cfloat> // _controlfp
+#include <chrono>
 #include <cmath> // sin
 #include <cstring>
+#include <fstream>
+#include <thread>
 
 
 #ifdef SOLOUD_SSE_INTRINSICS
@@ -27,8 +34,13 @@
 
 namespace cer
 {
-AudioDevice::AudioDevice(EngineFlags flags, size_t sample_rate, size_t buffer_size, size_t channels)
+AudioDevice::AudioDevice(EngineFlags  flags,
+                         size_t       sample_rate,
+                         size_t       buffer_size,
+                         size_t       channels,
+                         AudioBackend backend)
     : m_flags(flags)
+    , m_backend(backend)
 {
     assert(channels != 3 && channels != 5 && channels != 7);
     assert(channels <= max_channels);
@@ -43,11 +55,21 @@ AudioDevice::AudioDevice(EngineFlags flags, size_t sample_rate, size_t buffer_si
         .channel_count = channels,
     };
 
+    if (backend == AudioBackend::NullDriver)
+    {
+        audio_null_init(args);
+    }
+    else
+    {
 #if defined(CERLIB_AUDIO_BACKEND_SDL2)
-    audio_sdl2_init(args);
+        audio_sdl2_init(args);
 #elif defined(CERLIB_AUDIO_BACKEND_SDL3)
-    audio_sdl3_init(args);
+        audio_sdl3_init(args);
 #endif
+    }
+
+    // Voices are mixed on the audio thread alone, unless the game opts into mix workers.
+    set_mix_worker_count(0);
 }
 
 AudioDevice::~AudioDevice() noexcept
@@ -190,76 +212,79 @@ auto AudioDevice::play(AudioSource& sound, float volume, float pan, bool paused,
     // so let's not do it inside the audio thread mutex.
     sound.engine = this;
 
-    const auto instance = sound.create_instance();
+    auto instance = sound.create_instance();
 
-    lock_audio_mutex_internal();
+    const auto play_index = [&] {
+        const auto lock = std::scoped_lock{m_producer_mutex};
 
-    const auto ch = find_free_voice_internal();
+        if (sound.audio_source_id == 0u)
+        {
+            sound.audio_source_id = m_audio_source_id;
+            m_audio_source_id++;
+        }
 
-    if (ch == size_t(-1))
-    {
-        unlock_audio_mutex_internal();
-        return 7; // TODO: this was "UNKNOWN_ERROR"
-    }
+        const auto index = m_play_index;
 
-    if (sound.audio_source_id == 0u)
-    {
-        sound.audio_source_id = m_audio_source_id;
-        m_audio_source_id++;
-    }
+        m_play_index++;
 
-    m_voice[ch]                  = instance;
-    m_voice[ch]->audio_source_id = sound.audio_source_id;
-    m_voice[ch]->bus_handle      = bus;
-    m_voice[ch]->init(sound, m_play_index);
+        // 20 bits, skip the last one (top bits full = voice group)
+        if (m_play_index == 0xfffff)
+        {
+            m_play_index = 0;
+        }
 
-    m_3d_data[ch] = AudioSourceInstance3dData{sound};
+        return index;
+    }();
 
-    m_play_index++;
-
-    // 20 bits, skip the last one (top bits full = voice group)
-    if (m_play_index == 0xfffff)
-    {
-        m_play_index = 0;
-    }
+    // The instance isn't visible to the mixer yet, so it can be set up without the lock.
+    instance->audio_source_id = sound.audio_source_id;
+    instance->bus_handle      = bus;
+    instance->init(sound, play_index);
 
     if (paused)
     {
-        m_voice[ch]->flags.is_paused = true;
+        instance->flags.is_paused = true;
     }
 
-    set_voice_pan_internal(ch, pan);
-    if (volume < 0)
-    {
-        set_voice_volume_internal(ch, sound.volume);
-    }
-    else
+    for (size_t i = 0; i < filters_per_stream; ++i)
     {
-        set_voice_volume_internal(ch, volume);
+        if (sound.filter[i] != nullptr)
+        {
+            instance->filter[i] = sound.filter[i]->create_instance();
+        }
     }
 
-    // Fix initial voice volume ramp up
-    for (size_t i = 0; i < max_channels; ++i)
+    auto ch = reserve_voice_internal();
+
+    if (ch == size_t(-1))
     {
-        m_voice[ch]->current_channel_volume[i] =
-            m_voice[ch]->channel_volume[i] * m_voice[ch]->overall_volume;
-    }
+        // All voices are busy; stopping the oldest one needs the mixer's state.
+        lock_audio_mutex_internal();
+        ch = find_free_voice_internal();
+
+        if (ch != size_t(-1))
+        {
+            m_voice_reserved[ch].store(true, std::memory_order_relaxed);
+        }
 
-    set_voice_relative_play_speed_internal(ch, 1);
+        unlock_audio_mutex_internal();
 
-    for (size_t i = 0; i < filters_per_stream; ++i)
-    {
-        if (sound.filter[i] != nullptr)
+        if (ch == size_t(-1))
         {
-            m_voice[ch]->filter[i] = sound.filter[i]->create_instance();
+            return 7; // TODO: this was "UNKNOWN_ERROR"
         }
     }
 
-    m_active_voice_dirty = true;
+    m_3d_data[ch] = AudioSourceInstance3dData{sound};
 
-    unlock_audio_mutex_internal();
+    post_command_internal(PlayCommand{
+        .instance = std::move(instance),
+        .voice    = ch,
+        .volume   = volume < 0 ? sound.volume : volume,
+        .pan      = pan,
+    });
 
-    return get_handle_from_voice_internal(ch);
+    return (ch + 1) | (play_index << 12);
 }
 
 auto AudioDevice::play_clocked(
@@ -312,7 +337,7 @@ auto AudioDevice::seek(SoundHandle voice_handle, SoundTime seconds) -> bool
 
 void AudioDevice::stop(SoundHandle voice_handle)
 {
-    foreach_voice(voice_handle, [this](int ch) {
+    post_voice_command(voice_handle, [this](int ch) {
         stop_voice_internal(ch);
     });
 }
@@ -381,7 +406,7 @@ void AudioDevice::schedule_pause(SoundHandle voice_handle, SoundTime time)
         return;
     }
 
-    foreach_voice(voice_handle, [this, time](int ch) {
+    post_voice_command(voice_handle, [this, time](int ch) {
         m_voice[ch]->pause_scheduler.set(1, 0, time, m_voice[ch]->stream_time);
     });
 }
@@ -394,53 +419,75 @@ void AudioDevice::schedule_stop(SoundHandle voice_handle, SoundTime time)
         return;
     }
 
-    foreach_voice(voice_handle, [this, time](int ch) {
+    post_voice_command(voice_handle, [this, time](int ch) {
         m_voice[ch]->stop_scheduler.set(1, 0, time, m_voice[ch]->stream_time);
     });
 }
 
 void AudioDevice::fade_volume(SoundHandle voice_handle, float to, SoundTime time)
 {
-    const auto from = volume(voice_handle);
-
-    if (time <= 0.0 || to == from)
+    if (time <= 0.0)
     {
         set_volume(voice_handle, to);
         return;
     }
 
-    foreach_voice(voice_handle, [this, from, to, time](int ch) {
-        m_voice[ch]->volume_fader.set(from, to, time, m_voice[ch]->stream_time);
+    // The start value is read when the command runs, so that fading doesn't have to wait
+    // for the audio mutex.
+    post_voice_command(voice_handle, [this, to, time](int ch) {
+        if (auto& voice = *m_voice[ch]; to == voice.set_volume)
+        {
+            voice.volume_fader.active = 0;
+            set_voice_volume_internal(ch, to);
+        }
+        else
+        {
+            voice.volume_fader.set(voice.set_volume, to, time, voice.stream_time);
+        }
     });
 }
 
 void AudioDevice::fade_pan(SoundHandle voice_handle, float to, SoundTime time)
 {
-    const auto from = pan(voice_handle);
-
-    if (time <= 0.0 || to == from)
+    if (time <= 0.0)
     {
         set_pan(voice_handle, to);
         return;
     }
 
-    foreach_voice(voice_handle, [this, time, from, to](int ch) {
-        m_voice[ch]->pan_fader.set(from, to, time, m_voice[ch]->stream_time);
+    post_voice_command(voice_handle, [this, to, time](int ch) {
+        if (auto& voice = *m_voice[ch]; to == voice.pan)
+        {
+            set_voice_pan_internal(ch, to);
+        }
+        else
+        {
+            voice.pan_fader.set(voice.pan, to, time, voice.stream_time);
+        }
     });
 }
 
 void AudioDevice::fade_relative_play_speed(SoundHandle voice_handle, float to, SoundTime time)
 {
-    const auto from = relative_play_speed(voice_handle);
-
-    if (time <= 0.0 || to == from)
+    if (time <= 0.0)
     {
         set_relative_play_speed(voice_handle, to);
         return;
     }
 
-    foreach_voice(voice_handle, [this, from, to, time](int ch) {
-        m_voice[ch]->relative_play_speed_fader.set(from, to, time, m_voice[ch]->stream_time);
+    post_voice_command(voice_handle, [this, to, time](int ch) {
+        if (auto& voice = *m_voice[ch]; to == voice.set_relative_play_speed)
+        {
+            voice.relative_play_speed_fader.active = 0;
+            set_voice_relative_play_speed_internal(ch, to);
+        }
+        else
+        {
+            voice.relative_play_speed_fader.set(voice.set_relative_play_speed,
+                                                to,
+                                                time,
+                                                voice.stream_time);
+        }
     });
 }
 
@@ -466,7 +513,7 @@ void AudioDevice::oscillate_volume(SoundHandle voice_handle, float from, float t
         return;
     }
 
-    foreach_voice(voice_handle, [this, from, to, aTime](int ch) {
+    post_voice_command(voice_handle, [this, from, to, aTime](int ch) {
         m_voice[ch]->volume_fader.setLFO(from, to, aTime, m_voice[ch]->stream_time);
     });
 }
@@ -479,7 +526,7 @@ void AudioDevice::oscillate_pan(SoundHandle voice_handle, float aFrom, float aTo
         return;
     }
 
-    foreach_voice(voice_handle, [this, aFrom, aTo, aTime](int ch) {
+    post_voice_command(voice_handle, [this, aFrom, aTo, aTime](int ch) {
         m_voice[ch]->pan_fader.setLFO(aFrom, aTo, aTime, m_voice[ch]->stream_time);
     });
 }
@@ -495,7 +542,7 @@ void AudioDevice::oscillate_relative_play_speed(SoundHandle voice_handle,
         return;
     }
 
-    foreach_voice(voice_handle, [this, aFrom, aTo, aTime](int ch) {
+    post_voice_command(voice_handle, [this, aFrom, aTo, aTime](int ch) {
         m_voice[ch]->relative_play_speed_fader.setLFO(aFrom, aTo, aTime, m_voice[ch]->stream_time);
     });
 }
@@ -963,108 +1010,6 @@ void AudioDevice::clip_internal(const AlignedFloatBuffer& buffer,
 }
 #endif
 
-static constexpr auto s_fixpoint_frac_bits = 20;
-static constexpr auto s_fixpoint_frac_mul  = 1 << s_fixpoint_frac_bits;
-static constexpr auto s_fixpoint_frac_mask = (1 << s_fixpoint_frac_bits) - 1;
-
-static auto catmull_rom(float t, float p0, float p1, float p2, float p3) -> float
-{
-    return 0.5f * (2 * p1 + (-p0 + p2) * t + (2 * p0 - 5 * p1 + 4 * p2 - p3) * t * t +
-                   (-p0 + 3 * p1 - 3 * p2 + p3) * t * t * t);
-}
-
-static void resample_catmull_rom(const float* aSrc,
-                                 const float* aSrc1,
-                                 float*       aDst,
-                                 size_t       aSrcOffset,
-                                 size_t       aDstSampleCount,
-                                 size_t       aStepFixed)
-{
-    auto pos = aSrcOffset;
-
-    for (size_t i = 0; i < aDstSampleCount; ++i, pos += aStepFixed)
-    {
-        const auto p = pos >> s_fixpoint_frac_bits;
-        const auto f = pos & s_fixpoint_frac_mask;
-
-        auto s3 = 0.0f;
-
-        if (p < 3)
-        {
-            s3 = aSrc1[512 + p - 3];
-        }
-        else
-        {
-            s3 = aSrc[p - 3];
-        }
-
-        auto s2 = 0.0f;
-
-        if (p < 2)
-        {
-            s2 = aSrc1[512 + p - 2];
-        }
-        else
-        {
-            s2 = aSrc[p - 2];
-        }
-
-        auto s1 = 0.0f;
-
-        if (p < 1)
-        {
-            s1 = aSrc1[512 + p - 1];
-        }
-        else
-        {
-            s1 = aSrc[p - 1];
-        }
-
-        const auto s0 = aSrc[p];
-
-        aDst[i] = catmull_rom(f / float(s_fixpoint_frac_mul), s3, s2, s1, s0);
-    }
-}
-
-static void resample_linear(const float* aSrc,
-                            const float* aSrc1,
-                            float*       aDst,
-                            size_t       aSrcOffset,
-                            size_t       aDstSampleCount,
-                            size_t       aStepFixed)
-{
-    auto pos = aSrcOffset;
-
-    for (size_t i = 0; i < aDstSampleCount; ++i, pos += aStepFixed)
-    {
-        const auto p  = pos >> s_fixpoint_frac_bits;
-        const auto f  = pos & s_fixpoint_frac_mask;
-        auto       s1 = aSrc1[sample_granularity - 1];
-        const auto s2 = aSrc[p];
-        if (p != 0)
-        {
-            s1 = aSrc[p - 1];
-        }
-        aDst[i] = s1 + (s2 - s1) * f * (1 / (float)s_fixpoint_frac_mul);
-    }
-}
-
-static void resample_point(const float* src,
-                           const float* src1,
-                           float*       dst,
-                           size_t       src_offset,
-                           size_t       dst_sample_count,
-                           size_t       step_fixed)
-{
-    auto pos = src_offset;
-
-    for (size_t i = 0; i < dst_sample_count; ++i, pos += step_fixed)
-    {
-        const auto p = pos >> s_fixpoint_frac_bits;
-        dst[i]       = src[p];
-    }
-}
-
 void panAndExpand(std::shared_ptr<AudioSourceInstance>& voice,
                   float*                                buffer,
                   size_t                                samples_to_read,
@@ -1153,43 +1098,41 @@ void panAndExpand(std::shared_ptr<AudioSourceInstance>& voice,
                     }
                     break;
                 case 2: // 2->2
-#if defined(SOLOUD_SSE_INTRINSICS)
+#if CERLIB_SIMD_SSE || CERLIB_SIMD_NEON
                 {
-                    int c = 0;
-                    // if ((buffer_size & 3) == 0)
+                    size_t c = 0;
                     {
-                        size_t                 samplequads = samples_to_read / 4; // rounded down
-                        TinyAlignedFloatBuffer pan0;
-                        pan0[0] = pan[0] + pani[0];
-                        pan0[1] = pan[0] + pani[0] * 2;
-                        pan0[2] = pan[0] + pani[0] * 3;
-                        pan0[3] = pan[0] + pani[0] * 4;
-                        TinyAlignedFloatBuffer pan1;
-                        pan1[0] = pan[1] + pani[1];
-                        pan1[1] = pan[1] + pani[1] * 2;
-                        pan1[2] = pan[1] + pani[1] * 3;
-                        pan1[3] = pan[1] + pani[1] * 4;
+                        using namespace details;
+
+                        size_t samplequads = samples_to_read / 4; // rounded down
+
+                        Float4 p0 = set4(pan[0] + pani[0],
+                                         pan[0] + pani[0] * 2,
+                                         pan[0] + pani[0] * 3,
+                                         pan[0] + pani[0] * 4);
+                        Float4 p1 = set4(pan[1] + pani[1],
+                                         pan[1] + pani[1] * 2,
+                                         pan[1] + pani[1] * 3,
+                                         pan[1] + pani[1] * 4);
                         pani[0] *= 4;
                         pani[1] *= 4;
-                        __m128 pan0delta = _mm_load_ps1(&pani[0]);
-                        __m128 pan1delta = _mm_load_ps1(&pani[1]);
-                        __m128 p0        = _mm_load_ps(pan0.data());
-                        __m128 p1        = _mm_load_ps(pan1.data());
+                        Float4 pan0delta = splat4(pani[0]);
+                        Float4 pan1delta = splat4(pani[1]);
 
                         for (size_t j = 0; j < samplequads; ++j)
                         {
-                            __m128 f0 = _mm_load_ps(scratch + c);
-                            __m128 c0 = _mm_mul_ps(f0, p0);
-                            __m128 f1 = _mm_load_ps(scratch + c + buffer_size);
-                            __m128 c1 = _mm_mul_ps(f1, p1);
-                            __m128 o0 = _mm_load_ps(buffer + c);
-                            __m128 o1 = _mm_load_ps(buffer + c + buffer_size);
-                            c0        = _mm_add_ps(c0, o0);
-                            c1        = _mm_add_ps(c1, o1);
-                            _mm_store_ps(buffer + c, c0);
-                            _mm_store_ps(buffer + c + buffer_size, c1);
-                            p0 = _mm_add_ps(p0, pan0delta);
-                            p1 = _mm_add_ps(p1, pan1delta);
+                            Float4 f0 = load4(scratch + c);
+                            Float4 c0 = mul4(f0, p0);
+                            Float4 f1 = load4(scratch + c + buffer_size);
+                            Float4 c1 = mul4(f1, p1);
+                            Float4 o0 = load4(buffer + c);
+                            Float4 o1 = load4(buffer + c + buffer_size);
+                            c0        = add4(c0, o0);
+                            c1        = add4(c1, o1);
+                            store4(buffer + c, c0);
+                            store4(buffer + c + buffer_size, c1);
+                            p0 = add4(p0, pan0delta);
+                            p1 = add4(p1, pan1delta);
                             c += 4;
                         }
                     }
@@ -1218,42 +1161,40 @@ void panAndExpand(std::shared_ptr<AudioSourceInstance>& voice,
 #endif
                 break;
                 case 1: // 1->2
-#if defined(SOLOUD_SSE_INTRINSICS)
+#if CERLIB_SIMD_SSE || CERLIB_SIMD_NEON
                 {
-                    int c = 0;
-                    // if ((buffer_size & 3) == 0)
+                    size_t c = 0;
                     {
-                        size_t                 samplequads = samples_to_read / 4; // rounded down
-                        TinyAlignedFloatBuffer pan0;
-                        pan0[0] = pan[0] + pani[0];
-                        pan0[1] = pan[0] + pani[0] * 2;
-                        pan0[2] = pan[0] + pani[0] * 3;
-                        pan0[3] = pan[0] + pani[0] * 4;
-                        TinyAlignedFloatBuffer pan1;
-                        pan1[0] = pan[1] + pani[1];
-                        pan1[1] = pan[1] + pani[1] * 2;
-                        pan1[2] = pan[1] + pani[1] * 3;
-                        pan1[3] = pan[1] + pani[1] * 4;
+                        using namespace details;
+
+                        size_t samplequads = samples_to_read / 4; // rounded down
+
+                        Float4 p0 = set4(pan[0] + pani[0],
+                                         pan[0] + pani[0] * 2,
+                                         pan[0] + pani[0] * 3,
+                                         pan[0] + pani[0] * 4);
+                        Float4 p1 = set4(pan[1] + pani[1],
+                                         pan[1] + pani[1] * 2,
+                                         pan[1] + pani[1] * 3,
+                                         pan[1] + pani[1] * 4);
                         pani[0] *= 4;
                         pani[1] *= 4;
-                        __m128 pan0delta = _mm_load_ps1(&pani[0]);
-                        __m128 pan1delta = _mm_load_ps1(&pani[1]);
-                        __m128 p0        = _mm_load_ps(pan0.data());
-                        __m128 p1        = _mm_load_ps(pan1.data());
+                        Float4 pan0delta = splat4(pani[0]);
+                        Float4 pan1delta = splat4(pani[1]);
 
                         for (size_t j = 0; j < samplequads; ++j)
                         {
-                            __m128 f  = _mm_load_ps(scratch + c);
-                            __m128 c0 = _mm_mul_ps(f, p0);
-                            __m128 c1 = _mm_mul_ps(f, p1);
-                            __m128 o0 = _mm_load_ps(buffer + c);
-                            __m128 o1 = _mm_load_ps(buffer + c + buffer_size);
-                            c0        = _mm_add_ps(c0, o0);
-                            c1        = _mm_add_ps(c1, o1);
-                            _mm_store_ps(buffer + c, c0);
-                            _mm_store_ps(buffer + c + buffer_size, c1);
-                            p0 = _mm_add_ps(p0, pan0delta);
-                            p1 = _mm_add_ps(p1, pan1delta);
+                            Float4 f  = load4(scratch + c);
+                            Float4 c0 = mul4(f, p0);
+                            Float4 c1 = mul4(f, p1);
+                            Float4 o0 = load4(buffer + c);
+                            Float4 o1 = load4(buffer + c + buffer_size);
+                            c0        = add4(c0, o0);
+                            c1        = add4(c1, o1);
+                            store4(buffer + c, c0);
+                            store4(buffer + c + buffer_size, c1);
+                            p0 = add4(p0, pan0delta);
+                            p1 = add4(p1, pan1delta);
                             c += 4;
                         }
                     }
@@ -1641,339 +1582,486 @@ void AudioDevice::mix_bus_internal(float*    buffer,
         }
     }
 
+    const auto stop_if_ended = [this](size_t voice_index) {
+        // clear voice if the sound is over
+        // TODO: check this condition some day
+        if (const auto& voice = m_voice[voice_index];
+            !voice->flags.loops && !voice->flags.disable_autostop && voice->has_ended())
+        {
+            stop_voice_internal(voice_index);
+        }
+    };
+
+    // Buses mix their own voices, so they're always rendered on this thread. When there are
+    // mix workers, all other audible voices are left for the second pass below.
+    const auto defer_audible_voices = m_mix_pool != nullptr;
+
     // Accumulate sound sources
     for (size_t i = 0; i < m_active_voice_count; ++i)
     {
-        if (auto& voice = m_voice[m_active_voice[i]];
-            voice != nullptr && voice->bus_handle == bus && !voice->flags.is_paused &&
-            !voice->flags.inaudible)
+        const auto voice_index = m_active_voice[i];
+        auto&      voice       = m_voice[voice_index];
+
+        if (voice == nullptr || voice->bus_handle != bus || voice->flags.is_paused)
         {
-            float step = voice->sample_rate / sample_rate;
+            continue;
+        }
 
-            // avoid step overflow
-            if (step > (1 << (32 - s_fixpoint_frac_bits)))
+        if (!voice->flags.inaudible)
+        {
+            if (defer_audible_voices && dynamic_cast<BusInstance*>(voice.get()) == nullptr)
             {
-                step = 0;
+                continue;
             }
 
-            const auto step_fixed = int(floor(step * s_fixpoint_frac_mul));
-            auto       outofs     = size_t(0);
+            render_voice_internal(*voice,
+                                  scratch,
+                                  m_scratch.data(),
+                                  samples_to_read,
+                                  buffer_size,
+                                  sample_rate,
+                                  resampler);
 
-            if (voice->delay_samples)
-            {
-                if (voice->delay_samples > samples_to_read)
-                {
-                    outofs = samples_to_read;
-                    voice->delay_samples -= samples_to_read;
-                }
-                else
-                {
-                    outofs               = voice->delay_samples;
-                    voice->delay_samples = 0;
-                }
+            // Handle panning and channel expansion (and/or shrinking)
+            panAndExpand(voice, buffer, samples_to_read, buffer_size, scratch, channels);
 
-                // Clear scratch where we're skipping
-                for (size_t k = 0; k < voice->channel_count; k++)
-                {
-                    memset(scratch + k * buffer_size, 0, sizeof(float) * outofs);
-                }
-            }
+            stop_if_ended(voice_index);
+        }
+        else if (voice->flags.inaudible_tick)
+        {
+            // Inaudible but needs ticking. Do minimal work (keep counters up to date and ask
+            // audiosource for data)
+            tick_inaudible_voice_internal(*voice, samples_to_read, sample_rate);
+            stop_if_ended(voice_index);
+        }
+    }
 
-            while (step_fixed != 0 && outofs < samples_to_read)
-            {
-                if (voice->leftover_samples == 0)
-                {
-                    // Swap resample buffers (ping-pong)
-                    float* t                = voice->resample_data[0];
-                    voice->resample_data[0] = voice->resample_data[1];
-                    voice->resample_data[1] = t;
+    if (!defer_audible_voices)
+    {
+        return;
+    }
 
-                    // Get a block of source data
+    m_mix_voices.clear();
 
-                    auto read_count = size_t(0);
+    for (size_t i = 0; i < m_active_voice_count; ++i)
+    {
+        const auto voice_index = m_active_voice[i];
 
-                    if (!voice->has_ended() || voice->flags.loops)
-                    {
-                        read_count = voice->audio(voice->resample_data[0],
-                                                  sample_granularity,
-                                                  sample_granularity);
-                        if (read_count < sample_granularity)
-                        {
-                            if (voice->flags.loops)
-                            {
-                                while (read_count < sample_granularity &&
-                                       voice->seek(voice->loop_point,
-                                                   m_scratch.data(),
-                                                   m_scratch_size))
-                                {
-                                    voice->loop_count++;
-
-                                    const auto inc =
-                                        voice->audio(voice->resample_data[0] + read_count,
-                                                     sample_granularity - read_count,
-                                                     sample_granularity);
+        if (const auto& voice = m_voice[voice_index];
+            voice != nullptr && voice->bus_handle == bus && !voice->flags.is_paused &&
+            !voice->flags.inaudible && dynamic_cast<BusInstance*>(voice.get()) == nullptr)
+        {
+            m_mix_voices.push_back(voice_index);
+        }
+    }
 
-                                    read_count += inc;
-                                    if (inc == 0)
-                                        break;
-                                }
-                            }
-                        }
-                    }
+    if (m_mix_voices.size() >= min_parallel_mix_voice_count)
+    {
+        mix_voices_parallel_internal(buffer,
+                                     samples_to_read,
+                                     buffer_size,
+                                     sample_rate,
+                                     channels,
+                                     resampler);
+    }
+    else
+    {
+        for (const auto voice_index : m_mix_voices)
+        {
+            auto& voice = m_voice[voice_index];
 
-                    // Clear remaining of the resample data if the full scratch wasn't used
-                    if (read_count < sample_granularity)
-                    {
-                        for (size_t k = 0; k < voice->channel_count; k++)
-                        {
-                            memset(voice->resample_data[0] + read_count + sample_granularity * k,
-                                   0,
-                                   sizeof(float) * (sample_granularity - read_count));
-                        }
-                    }
+            render_voice_internal(*voice,
+                                  scratch,
+                                  m_scratch.data(),
+                                  samples_to_read,
+                                  buffer_size,
+                                  sample_rate,
+                                  resampler);
 
-                    // If we go past zero, crop to zero (a bit of a kludge)
-                    if (voice->src_offset < sample_granularity * s_fixpoint_frac_mul)
-                    {
-                        voice->src_offset = 0;
-                    }
-                    else
-                    {
-                        // We have new block of data, move pointer backwards
-                        voice->src_offset -= sample_granularity * s_fixpoint_frac_mul;
-                    }
+            panAndExpand(voice, buffer, samples_to_read, buffer_size, scratch, channels);
+        }
+    }
 
+    // Stopping voices modifies the voice list, so it only happens after all voices are
+    // rendered.
+    for (const auto voice_index : m_mix_voices)
+    {
+        stop_if_ended(voice_index);
+    }
+}
+
+void AudioDevice::render_voice_internal(AudioSourceInstance& voice,
+                                        float*               scratch,
+                                        float*               seek_scratch,
+                                        size_t               samples_to_read,
+                                        size_t               buffer_size,
+                                        float                sample_rate,
+                                        Resampler            resampler)
+{
+    float step = voice.sample_rate / sample_rate;
+
+    // avoid step overflow
+    if (step > (1 << (32 - s_fixpoint_frac_bits)))
+    {
+        step = 0;
+    }
+
+    const auto step_fixed = int(floor(step * s_fixpoint_frac_mul));
+    auto       outofs     = size_t(0);
+
+    const auto& kernels  = step_fixed == s_fixpoint_frac_mul ? details::unit_step_resample_kernels()
+                                                             : details::resample_kernels();
+    const auto  resample = kernels.get(resampler);
+
+    if (voice.delay_samples)
+    {
+        if (voice.delay_samples > samples_to_read)
+        {
+            outofs = samples_to_read;
+            voice.delay_samples -= samples_to_read;
+        }
+        else
+        {
+            outofs              = voice.delay_samples;
+            voice.delay_samples = 0;
+        }
+
+        // Clear scratch where we're skipping
+        for (size_t k = 0; k < voice.channel_count; k++)
+        {
+            memset(scratch + k * buffer_size, 0, sizeof(float) * outofs);
+        }
+    }
 
-                    // Run the per-stream filters to get our source data
+    while (step_fixed != 0 && outofs < samples_to_read)
+    {
+        if (voice.leftover_samples == 0)
+        {
+            // Swap resample buffers (ping-pong)
+            float* t               = voice.resample_data[0];
+            voice.resample_data[0] = voice.resample_data[1];
+            voice.resample_data[1] = t;
+
+            // Get a block of source data
+
+            auto read_count = size_t(0);
 
-                    for (size_t j = 0; j < filters_per_stream; ++j)
+            if (!voice.has_ended() || voice.flags.loops)
+            {
+                read_count =
+                    voice.audio(voice.resample_data[0], sample_granularity, sample_granularity);
+                if (read_count < sample_granularity)
+                {
+                    if (voice.flags.loops)
                     {
-                        if (voice->filter[j])
+                        while (read_count < sample_granularity &&
+                               voice.seek(voice.loop_point, seek_scratch, m_scratch_size))
                         {
-                            voice->filter[j]->filter(FilterArgs{
-                                .buffer      = voice->resample_data[0],
-                                .samples     = sample_granularity,
-                                .buffer_size = sample_granularity,
-                                .channels    = voice->channel_count,
-                                .sample_rate = voice->sample_rate,
-                                .time        = m_stream_time,
-                            });
+                            voice.loop_count++;
+
+                            const auto inc = voice.audio(voice.resample_data[0] + read_count,
+                                                         sample_granularity - read_count,
+                                                         sample_granularity);
+
+                            read_count += inc;
+                            if (inc == 0)
+                                break;
                         }
                     }
                 }
-                else
+            }
+
+            // Clear remaining of the resample data if the full scratch wasn't used
+            if (read_count < sample_granularity)
+            {
+                for (size_t k = 0; k < voice.channel_count; k++)
                 {
-                    voice->leftover_samples = 0;
+                    memset(voice.resample_data[0] + read_count + sample_granularity * k,
+                           0,
+                           sizeof(float) * (sample_granularity - read_count));
                 }
+            }
+
+            // If we go past zero, crop to zero (a bit of a kludge)
+            if (voice.src_offset < sample_granularity * s_fixpoint_frac_mul)
+            {
+                voice.src_offset = 0;
+            }
+            else
+            {
+                // We have new block of data, move pointer backwards
+                voice.src_offset -= sample_granularity * s_fixpoint_frac_mul;
+            }
 
-                // Figure out how many samples we can generate from this source data.
-                // The value may be zero.
 
-                size_t writesamples = 0;
+            // Run the per-stream filters to get our source data
 
-                if (voice->src_offset < sample_granularity * s_fixpoint_frac_mul)
+            for (size_t j = 0; j < filters_per_stream; ++j)
+            {
+                if (voice.filter[j])
                 {
-                    writesamples =
-                        ((sample_granularity * s_fixpoint_frac_mul) - voice->src_offset) /
-                            step_fixed +
-                        1;
-
-                    // avoid reading past the current buffer..
-                    if (((writesamples * step_fixed + voice->src_offset) >> s_fixpoint_frac_bits) >=
-                        sample_granularity)
-                        writesamples--;
+                    voice.filter[j]->filter(FilterArgs{
+                        .buffer      = voice.resample_data[0],
+                        .samples     = sample_granularity,
+                        .buffer_size = sample_granularity,
+                        .channels    = voice.channel_count,
+                        .sample_rate = voice.sample_rate,
+                        .time        = m_stream_time,
+                    });
                 }
+            }
+        }
+        else
+        {
+            voice.leftover_samples = 0;
+        }
 
+        // Figure out how many samples we can generate from this source data.
+        // The value may be zero.
 
-                // If this is too much for our output buffer, don't write that many:
-                if (writesamples + outofs > samples_to_read)
-                {
-                    voice->leftover_samples = (writesamples + outofs) - samples_to_read;
-                    writesamples            = samples_to_read - outofs;
-                }
+        size_t writesamples = 0;
+
+        if (voice.src_offset < sample_granularity * s_fixpoint_frac_mul)
+        {
+            writesamples =
+                ((sample_granularity * s_fixpoint_frac_mul) - voice.src_offset) / step_fixed + 1;
+
+            // avoid reading past the current buffer..
+            if (((writesamples * step_fixed + voice.src_offset) >> s_fixpoint_frac_bits) >=
+                sample_granularity)
+                writesamples--;
+        }
+
+
+        // If this is too much for our output buffer, don't write that many:
+        if (writesamples + outofs > samples_to_read)
+        {
+            voice.leftover_samples = (writesamples + outofs) - samples_to_read;
+            writesamples           = samples_to_read - outofs;
+        }
 
-                // Call resampler to generate the samples, once per channel
-                if (writesamples != 0u)
+        // Call resampler to generate the samples, once per channel
+        if (writesamples != 0u)
+        {
+            for (size_t j = 0; j < voice.channel_count; ++j)
+            {
+                resample(voice.resample_data[0] + sample_granularity * j,
+                         voice.resample_data[1] + sample_granularity * j,
+                         scratch + buffer_size * j + outofs,
+                         voice.src_offset,
+                         writesamples,
+                         step_fixed);
+            }
+        }
+
+        // Keep track of how many samples we've written so far
+        outofs += writesamples;
+
+        // Move source pointer onwards (writesamples may be zero)
+        voice.src_offset += writesamples * step_fixed;
+    }
+}
+
+void AudioDevice::tick_inaudible_voice_internal(AudioSourceInstance& voice,
+                                                size_t               samples_to_read,
+                                                float                sample_rate)
+{
+    auto step       = voice.sample_rate / sample_rate;
+    auto step_fixed = int(floor(step * s_fixpoint_frac_mul));
+    auto outofs     = size_t(0);
+
+    if (voice.delay_samples != 0u)
+    {
+        if (voice.delay_samples > samples_to_read)
+        {
+            outofs = samples_to_read;
+            voice.delay_samples -= samples_to_read;
+        }
+        else
+        {
+            outofs              = voice.delay_samples;
+            voice.delay_samples = 0;
+        }
+    }
+
+    while (step_fixed != 0 && outofs < samples_to_read)
+    {
+        if (voice.leftover_samples == 0)
+        {
+            // Swap resample buffers (ping-pong)
+            float* t               = voice.resample_data[0];
+            voice.resample_data[0] = voice.resample_data[1];
+            voice.resample_data[1] = t;
+
+            // Get a block of source data
+
+            if (!voice.has_ended() || voice.flags.loops)
+            {
+                auto readcount =
+                    voice.audio(voice.resample_data[0], sample_granularity, sample_granularity);
+                if (readcount < sample_granularity)
                 {
-                    for (size_t j = 0; j < voice->channel_count; ++j)
+                    if (voice.flags.loops)
                     {
-                        switch (resampler)
+                        while (readcount < sample_granularity &&
+                               voice.seek(voice.loop_point, m_scratch.data(), m_scratch_size))
                         {
-                            case Resampler::Point:
-                                resample_point(voice->resample_data[0] + sample_granularity * j,
-                                               voice->resample_data[1] + sample_granularity * j,
-                                               scratch + buffer_size * j + outofs,
-                                               voice->src_offset,
-                                               writesamples,
-                                               /*voice->mSamplerate,
-                                               aSamplerate,*/
-                                               step_fixed);
-                                break;
-                            case Resampler::CatmullRom:
-                                resample_catmull_rom(
-                                    voice->resample_data[0] + sample_granularity * j,
-                                    voice->resample_data[1] + sample_granularity * j,
-                                    scratch + buffer_size * j + outofs,
-                                    voice->src_offset,
-                                    writesamples,
-                                    /*voice->mSamplerate,
-                                    aSamplerate,*/
-                                    step_fixed);
-                                break;
-                            default:
-                                // case RESAMPLER_LINEAR:
-                                resample_linear(voice->resample_data[0] + sample_granularity * j,
-                                                voice->resample_data[1] + sample_granularity * j,
-                                                scratch + buffer_size * j + outofs,
-                                                voice->src_offset,
-                                                writesamples,
-                                                /*voice->mSamplerate,
-                                                aSamplerate,*/
-                                                step_fixed);
-                                break;
+                            voice.loop_count++;
+                            readcount += voice.audio(voice.resample_data[0] + readcount,
+                                                     sample_granularity - readcount,
+                                                     sample_granularity);
                         }
                     }
                 }
-
-                // Keep track of how many samples we've written so far
-                outofs += writesamples;
-
-                // Move source pointer onwards (writesamples may be zero)
-                voice->src_offset += writesamples * step_fixed;
             }
 
-            // Handle panning and channel expansion (and/or shrinking)
-            panAndExpand(voice, buffer, samples_to_read, buffer_size, scratch, channels);
-
-            // clear voice if the sound is over
-            // TODO: check this condition some day
-            if (!voice->flags.loops && !voice->flags.disable_autostop && voice->has_ended())
+            // If we go past zero, crop to zero (a bit of a kludge)
+            if (voice.src_offset < sample_granularity * s_fixpoint_frac_mul)
+            {
+                voice.src_offset = 0;
+            }
+            else
             {
-                stop_voice_internal(m_active_voice[i]);
+                // We have new block of data, move pointer backwards
+                voice.src_offset -= sample_granularity * s_fixpoint_frac_mul;
             }
+
+            // Skip filters
         }
-        else if (voice && voice->bus_handle == bus && !voice->flags.is_paused &&
-                 voice->flags.inaudible && voice->flags.inaudible_tick)
+        else
         {
-            // Inaudible but needs ticking. Do minimal work (keep counters up to date and ask
-            // audiosource for data)
-            auto step       = voice->sample_rate / sample_rate;
-            auto step_fixed = int(floor(step * s_fixpoint_frac_mul));
-            auto outofs     = size_t(0);
+            voice.leftover_samples = 0;
+        }
+
+        // Figure out how many samples we can generate from this source data.
+        // The value may be zero.
+
+        auto writesamples = size_t(0);
 
-            if (voice->delay_samples != 0u)
+        if (voice.src_offset < sample_granularity * s_fixpoint_frac_mul)
+        {
+            writesamples =
+                ((sample_granularity * s_fixpoint_frac_mul) - voice.src_offset) / step_fixed + 1;
+
+            // avoid reading past the current buffer..
+            if (((writesamples * step_fixed + voice.src_offset) >> s_fixpoint_frac_bits) >=
+                sample_granularity)
             {
-                if (voice->delay_samples > samples_to_read)
-                {
-                    outofs = samples_to_read;
-                    voice->delay_samples -= samples_to_read;
-                }
-                else
-                {
-                    outofs               = voice->delay_samples;
-                    voice->delay_samples = 0;
-                }
+                --writesamples;
             }
+        }
 
-            while (step_fixed != 0 && outofs < samples_to_read)
-            {
-                if (voice->leftover_samples == 0)
-                {
-                    // Swap resample buffers (ping-pong)
-                    float* t                = voice->resample_data[0];
-                    voice->resample_data[0] = voice->resample_data[1];
-                    voice->resample_data[1] = t;
 
-                    // Get a block of source data
+        // If this is too much for our output buffer, don't write that many:
+        if (writesamples + outofs > samples_to_read)
+        {
+            voice.leftover_samples = (writesamples + outofs) - samples_to_read;
+            writesamples           = samples_to_read - outofs;
+        }
 
-                    if (!voice->has_ended() || voice->flags.loops)
-                    {
-                        auto readcount = voice->audio(voice->resample_data[0],
-                                                      sample_granularity,
-                                                      sample_granularity);
-                        if (readcount < sample_granularity)
-                        {
-                            if (voice->flags.loops)
-                            {
-                                while (readcount < sample_granularity &&
-                                       voice->seek(voice->loop_point,
-                                                   m_scratch.data(),
-                                                   m_scratch_size))
-                                {
-                                    voice->loop_count++;
-                                    readcount += voice->audio(voice->resample_data[0] + readcount,
-                                                              sample_granularity - readcount,
-                                                              sample_granularity);
-                                }
-                            }
-                        }
-                    }
+        // Skip resampler
 
-                    // If we go past zero, crop to zero (a bit of a kludge)
-                    if (voice->src_offset < sample_granularity * s_fixpoint_frac_mul)
-                    {
-                        voice->src_offset = 0;
-                    }
-                    else
-                    {
-                        // We have new block of data, move pointer backwards
-                        voice->src_offset -= sample_granularity * s_fixpoint_frac_mul;
-                    }
+        // Keep track of how many samples we've written so far
+        outofs += writesamples;
 
-                    // Skip filters
-                }
-                else
-                {
-                    voice->leftover_samples = 0;
-                }
+        // Move source pointer onwards (writesamples may be zero)
+        voice.src_offset += writesamples * step_fixed;
+    }
+}
 
-                // Figure out how many samples we can generate from this source data.
-                // The value may be zero.
+void AudioDevice::mix_voices_parallel_internal(float*    buffer,
+                                               size_t    samples_to_read,
+                                               size_t    buffer_size,
+                                               float     sample_rate,
+                                               size_t    channels,
+                                               Resampler resampler)
+{
+    const auto voice_count = m_mix_voices.size();
+    const auto task_count  = std::min(m_mix_tasks.size(), voice_count);
 
-                auto writesamples = size_t(0);
+    // Each task gets a contiguous range of voices and sums them in order. Together with
+    // the fixed summation order below, this makes the output independent of which thread
+    // ends up running which task.
+    for (size_t i = 0; i < task_count; ++i)
+    {
+        auto& task = m_mix_tasks[i];
 
-                if (voice->src_offset < sample_granularity * s_fixpoint_frac_mul)
-                {
-                    writesamples =
-                        ((sample_granularity * s_fixpoint_frac_mul) - voice->src_offset) /
-                            step_fixed +
-                        1;
-
-                    // avoid reading past the current buffer..
-                    if (((writesamples * step_fixed + voice->src_offset) >> s_fixpoint_frac_bits) >=
-                        sample_granularity)
-                    {
-                        --writesamples;
-                    }
-                }
+        task.device          = this;
+        task.first_voice     = (voice_count * i) / task_count;
+        task.voice_count     = ((voice_count * (i + 1)) / task_count) - task.first_voice;
+        task.samples_to_read = samples_to_read;
+        task.buffer_size     = buffer_size;
+        task.sample_rate     = sample_rate;
+        task.channels        = channels;
+        task.resampler       = resampler;
+    }
 
+    m_pending_mix_tasks.store(task_count, std::memory_order_release);
 
-                // If this is too much for our output buffer, don't write that many:
-                if (writesamples + outofs > samples_to_read)
-                {
-                    voice->leftover_samples = (writesamples + outofs) - samples_to_read;
-                    writesamples            = samples_to_read - outofs;
-                }
+    for (size_t i = 1; i < task_count; ++i)
+    {
+        m_mix_pool->add_work(&m_mix_tasks[i]);
+    }
 
-                // Skip resampler
+    m_mix_tasks.front().work();
 
-                // Keep track of how many samples we've written so far
-                outofs += writesamples;
+    // Rather than waiting for idle workers to wake up, help with whatever is left.
+    while (m_pending_mix_tasks.load(std::memory_order_acquire) > 0)
+    {
+        if (auto* task = m_mix_pool->get_work())
+        {
+            task->work();
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
 
-                // Move source pointer onwards (writesamples may be zero)
-                voice->src_offset += writesamples * step_fixed;
-            }
+    for (size_t t = 0; t < task_count; ++t)
+    {
+        const auto* accumulation = m_mix_tasks[t].accumulation.data();
 
-            // clear voice if the sound is over
-            // TODO: check this condition some day
-            if (!voice->flags.loops && !voice->flags.disable_autostop && voice->has_ended())
+        for (size_t j = 0; j < channels; ++j)
+        {
+            for (size_t i = 0; i < samples_to_read; ++i)
             {
-                stop_voice_internal(m_active_voice[i]);
+                buffer[i + j * buffer_size] += accumulation[i + j * buffer_size];
             }
         }
     }
 }
 
+void AudioDevice::MixTask::work()
+{
+    for (size_t j = 0; j < channels; ++j)
+    {
+        std::fill_n(accumulation.data() + j * buffer_size, samples_to_read, 0.0f);
+    }
+
+    for (size_t i = first_voice; i < first_voice + voice_count; ++i)
+    {
+        auto& voice = device->m_voice[device->m_mix_voices[i]];
+
+        device->render_voice_internal(*voice,
+                                      voice_output.data(),
+                                      seek_scratch.data(),
+                                      samples_to_read,
+                                      buffer_size,
+                                      sample_rate,
+                                      resampler);
+
+        panAndExpand(voice,
+                     accumulation.data(),
+                     samples_to_read,
+                     buffer_size,
+                     voice_output.data(),
+                     channels);
+    }
+
+    device->m_pending_mix_tasks.fetch_sub(1, std::memory_order_acq_rel);
+}
+
 void AudioDevice::map_resample_buffers_internal()
 {
     assert(m_max_active_voices < 256);
@@ -2199,8 +2287,9 @@ void AudioDevice::mix_internal(size_t samples, size_t stride)
     }
 #endif
 
-    const auto buffertime   = samples / float(m_sample_rate);
-    auto       globalVolume = std::array<float, 2>{};
+    const auto mix_start_time = std::chrono::steady_clock::now();
+    const auto buffertime     = samples / float(m_sample_rate);
+    auto       globalVolume   = std::array<float, 2>{};
 
     m_stream_time += buffertime;
     m_last_clocked_time = 0;
@@ -2288,6 +2377,8 @@ void AudioDevice::mix_internal(size_t samples, size_t stride)
         calc_active_voices_internal();
     }
 
+    const auto mixed_voice_count = m_active_voice_count;
+
     mix_bus_internal(m_output_scratch.data(),
                      samples,
                      stride,
@@ -2369,6 +2460,21 @@ void AudioDevice::mix_internal(size_t samples, size_t stride)
             }
         }
     }
+
+    const auto mix_duration =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - mix_start_time);
+
+    lock_audio_mutex_internal();
+    m_mixer_stats.mixed_frames += samples;
+    m_mixer_stats.mixed_voice_frames += uint64_t(mixed_voice_count) * samples;
+    m_mixer_stats.mix_duration += mix_duration.count();
+
+    if (mix_duration.count() > double(buffertime))
+    {
+        ++m_mixer_stats.deadline_misses;
+    }
+
+    unlock_audio_mutex_internal();
 }
 
 void interlace_samples_float(
@@ -2424,6 +2530,10 @@ void AudioDevice::lock_audio_mutex_internal()
     }
     assert(!m_inside_audio_thread_mutex);
     m_inside_audio_thread_mutex = true;
+
+    // Whoever holds the lock sees every command that was posted before, so that e.g. a
+    // query right after play() finds the new voice.
+    process_commands_internal();
 }
 
 void AudioDevice::unlock_audio_mutex_internal()
@@ -2748,6 +2858,75 @@ auto AudioDevice::find_free_voice_internal() -> size_t
     return lowest_play_index;
 }
 
+auto AudioDevice::reserve_voice_internal() -> size_t
+{
+    for (size_t i = 0; i < cer::max_voice_count; ++i)
+    {
+        if (!m_voice_reserved[i].load(std::memory_order_relaxed) &&
+            !m_voice_reserved[i].exchange(true, std::memory_order_acquire))
+        {
+            return i;
+        }
+    }
+
+    return size_t(-1);
+}
+
+void AudioDevice::post_command_internal(AudioCommand command)
+{
+    const auto lock = std::scoped_lock{m_producer_mutex};
+
+    if (m_commands.try_push(std::move(command)))
+    {
+        return;
+    }
+
+    // The mixer is lagging behind. Taking the lock drains the queue, after which the
+    // command can run right away without breaking the order.
+    lock_audio_mutex_internal();
+    execute_command_internal(command);
+    unlock_audio_mutex_internal();
+}
+
+void AudioDevice::process_commands_internal()
+{
+    assert(m_inside_audio_thread_mutex);
+
+    while (auto command = m_commands.try_pop())
+    {
+        execute_command_internal(*command);
+    }
+}
+
+void AudioDevice::execute_command_internal(AudioCommand& command)
+{
+    if (auto* play = std::get_if<PlayCommand>(&command))
+    {
+        const auto ch = play->voice;
+
+        m_voice[ch]     = std::move(play->instance);
+        m_highest_voice = std::max(m_highest_voice, ch + 1);
+
+        set_voice_pan_internal(ch, play->pan);
+        set_voice_volume_internal(ch, play->volume);
+
+        // Fix initial voice volume ramp up
+        for (size_t i = 0; i < max_channels; ++i)
+        {
+            m_voice[ch]->current_channel_volume[i] =
+                m_voice[ch]->channel_volume[i] * m_voice[ch]->overall_volume;
+        }
+
+        set_voice_relative_play_speed_internal(ch, 1);
+
+        m_active_voice_dirty = true;
+    }
+    else
+    {
+        std::get<VoiceCommand>(command)(*this);
+    }
+}
+
 auto AudioDevice::get_loop_count(SoundHandle voice_handle) -> size_t
 {
     lock_audio_mutex_internal();
@@ -2780,6 +2959,149 @@ auto AudioDevice::backend_buffer_size() const -> size_t
     return m_buffer_size;
 }
 
+auto AudioDevice::backend() const -> AudioBackend
+{
+    return m_backend;
+}
+
+void AudioDevice::render_offline(std::span<float> destination)
+{
+    if (m_backend != AudioBackend::NullDriver)
+    {
+        throw std::logic_error{
+            "Audio can only be rendered explicitly when the game uses offline audio."};
+    }
+
+    if (destination.size() % m_channels != 0)
+    {
+        throw std::invalid_argument{
+            fmt::format("The size of the destination ({}) is not a multiple of the channel count "
+                        "({}).",
+                        destination.size(),
+                        m_channels)};
+    }
+
+    auto remaining_frames = destination.size() / m_channels;
+    auto dst              = destination.data();
+
+    while (remaining_frames > 0)
+    {
+        const auto frames = std::min(remaining_frames, m_buffer_size);
+        mix(dst, frames);
+        dst += frames * m_channels;
+        remaining_frames -= frames;
+    }
+}
+
+void AudioDevice::render_offline_to_file(std::string_view filename, size_t frame_count)
+{
+    if (m_backend != AudioBackend::NullDriver)
+    {
+        throw std::logic_error{
+            "Audio can only be rendered explicitly when the game uses offline audio."};
+    }
+
+    auto stream = std::ofstream{std::string{filename}, std::ios::binary | std::ios::trunc};
+
+    if (!stream)
+    {
+        throw std::runtime_error{fmt::format("Failed to open file '{}' for writing.", filename)};
+    }
+
+    const auto on_write = [](void* user_data, const void* data, size_t size) -> size_t {
+        auto& s = *static_cast<std::ofstream*>(user_data);
+        s.write(static_cast<const char*>(data), std::streamsize(size));
+        return s ? size : 0;
+    };
+
+    const auto on_seek = [](void* user_data, int offset, drwav_seek_origin origin) -> drwav_bool32 {
+        auto& s = *static_cast<std::ofstream*>(user_data);
+        s.seekp(offset, origin == drwav_seek_origin_start ? std::ios::beg : std::ios::cur);
+        return s ? DRWAV_TRUE : DRWAV_FALSE;
+    };
+
+    const auto format = drwav_data_format{
+        .container     = drwav_container_riff,
+        .format        = DR_WAVE_FORMAT_IEEE_FLOAT,
+        .channels      = drwav_uint32(m_channels),
+        .sampleRate    = drwav_uint32(m_sample_rate),
+        .bitsPerSample = 32,
+    };
+
+    auto wav = drwav{};
+
+    if (drwav_init_write(&wav, &format, on_write, on_seek, &stream, nullptr) == DRWAV_FALSE)
+    {
+        throw std::runtime_error{fmt::format("Failed to write a WAV header to '{}'.", filename)};
+    }
+
+    defer
+    {
+        drwav_uninit(&wav);
+    };
+
+    auto buffer = List<float>(m_buffer_size * m_channels);
+
+    while (frame_count > 0)
+    {
+        const auto frames = std::min(frame_count, m_buffer_size);
+
+        render_offline(std::span{buffer.data(), frames * m_channels});
+
+        if (drwav_write_pcm_frames(&wav, frames, buffer.data()) != frames)
+        {
+            throw std::runtime_error{fmt::format("Failed to write audio data to '{}'.", filename)};
+        }
+
+        frame_count -= frames;
+    }
+}
+
+auto AudioDevice::mixer_stats() -> AudioMixerStats
+{
+    lock_audio_mutex_internal();
+    auto stats = m_mixer_stats;
+    unlock_audio_mutex_internal();
+
+    if (stats.mix_duration > 0.0)
+    {
+        stats.voice_frames_per_second = double(stats.mixed_voice_frames) / stats.mix_duration;
+    }
+
+    return stats;
+}
+
+void AudioDevice::set_mix_worker_count(size_t count)
+{
+    count = std::min(count, max_mix_worker_count);
+
+    lock_audio_mutex_internal();
+
+    // Joins the previous workers. They're idle, since no mixing happens while we hold the
+    // audio mutex.
+    m_mix_pool.reset();
+    m_mix_tasks.clear();
+
+    if (count > 0)
+    {
+        m_mix_pool = std::make_unique<thread::Pool>();
+        m_mix_pool->init(count);
+
+        m_mix_tasks.resize(count + 1);
+
+        for (auto& task : m_mix_tasks)
+        {
+            task.voice_output = AlignedFloatBuffer{m_scratch_size * max_channels};
+            task.seek_scratch = AlignedFloatBuffer{m_scratch_size * max_channels};
+            task.accumulation = AlignedFloatBuffer{m_scratch_size * max_channels};
+        }
+    }
+
+    m_mixer_stats.mix_thread_count = uint32_t(count + 1);
+
+    unlock_audio_mutex_internal();
+}
+
 // Get speaker position in 3d space
 auto AudioDevice::speaker_position(size_t channel) const -> Vector3
 {
@@ -2804,7 +3126,7 @@ void AudioDevice::set_global_volume(float volume)
 
 void AudioDevice::set_relative_play_speed(SoundHandle voice_handle, float speed)
 {
-    foreach_voice(voice_handle, [this, speed](int ch) {
+    post_voice_command(voice_handle, [this, speed](int ch) {
         m_voice[ch]->relative_play_speed_fader.active = 0;
         set_voice_relative_play_speed_internal(ch, speed);
     });
@@ -2812,7 +3134,7 @@ void AudioDevice::set_relative_play_speed(SoundHandle voice_handle, float speed)
 
 void AudioDevice::set_sample_rate(SoundHandle voice_handle, float sample_rate)
 {
-    foreach_voice(voice_handle, [this, sample_rate](int ch) {
+    post_voice_command(voice_handle, [this, sample_rate](int ch) {
         m_voice[ch]->base_sample_rate = sample_rate;
         update_voice_relative_play_speed_internal(ch);
     });
@@ -2820,7 +3142,7 @@ void AudioDevice::set_sample_rate(SoundHandle voice_handle, float sample_rate)
 
 void AudioDevice::set_pause(SoundHandle voice_handle, bool pause)
 {
-    foreach_voice(voice_handle, [this, pause](int ch) {
+    post_voice_command(voice_handle, [this, pause](int ch) {
         set_voice_pause_internal(ch, pause);
     });
 }
@@ -2866,21 +3188,21 @@ void AudioDevice::set_pause_all(bool pause)
 
 void AudioDevice::set_protect_voice(SoundHandle voice_handle, bool protect)
 {
-    foreach_voice(voice_handle, [this, protect](int ch) {
+    post_voice_command(voice_handle, [this, protect](int ch) {
         m_voice[ch]->flags.is_protected = protect;
     });
 }
 
 void AudioDevice::set_pan(SoundHandle voice_handle, float pan)
 {
-    foreach_voice(voice_handle, [this, pan](int ch) {
+    post_voice_command(voice_handle, [this, pan](int ch) {
         set_voice_pan_internal(ch, pan);
     });
 }
 
 void AudioDevice::set_channel_volume(SoundHandle voice_handle, size_t channel, float volume)
 {
-    foreach_voice(voice_handle, [this, channel, volume](int ch) {
+    post_voice_command(voice_handle, [this, channel, volume](int ch) {
         auto& voice = m_voice[ch];
         if (voice->channel_count > channel)
         {
@@ -2893,7 +3215,7 @@ void AudioDevice::set_pan_absolute(SoundHandle voice_handle, float left_volume,
 {
     const auto center_volume = (left_volume + right_volume) / 2.0f;
 
-    foreach_voice(voice_handle, [&](int ch) {
+    post_voice_command(voice_handle, [this, left_volume, right_volume, center_volume](int ch) {
         auto& voice   = *m_voice[ch];
         auto& volumes = voice.channel_volume;
 
@@ -2929,7 +3251,7 @@ void AudioDevice::set_pan_absolute(SoundHandle voice_handle, float left_volume,
 
 void AudioDevice::set_inaudible_behavior(SoundHandle voice_handle, bool must_tick, bool kill)
 {
-    foreach_voice(voice_handle, [this, must_tick, kill](int ch) {
+    post_voice_command(voice_handle, [this, must_tick, kill](int ch) {
         auto& voice                = *m_voice[ch];
         voice.flags.inaudible_kill = kill;
         voice.flags.inaudible_tick = must_tick;
@@ -2938,28 +3260,28 @@ void AudioDevice::set_inaudible_behavior(SoundHandle voice_handle, bool must_tic
 
 void AudioDevice::set_loop_point(SoundHandle voice_handle, SoundTime loop_point)
 {
-    foreach_voice(voice_handle, [this, loop_point](int ch) {
+    post_voice_command(voice_handle, [this, loop_point](int ch) {
         m_voice[ch]->loop_point = loop_point;
     });
 }
 
 void AudioDevice::set_looping(SoundHandle voice_handle, bool looping)
 {
-    foreach_voice(voice_handle, [this, looping](int ch) {
+    post_voice_command(voice_handle, [this, looping](int ch) {
         m_voice[ch]->flags.loops = looping;
     });
 }
 
 void AudioDevice::set_auto_stop(SoundHandle voice_handle, bool auto_stop)
 {
-    foreach_voice(voice_handle, [this, auto_stop](int ch) {
+    post_voice_command(voice_handle, [this, auto_stop](int ch) {
         m_voice[ch]->flags.disable_autostop = !auto_stop;
     });
 }
 
 void AudioDevice::set_volume(SoundHandle voice_handle, float volume)
 {
-    foreach_voice(voice_handle, [this, volume](int ch) {
+    post_voice_command(voice_handle, [this, volume](int ch) {
         m_voice[ch]->volume_fader.active = 0;
         set_voice_volume_internal(ch, volume);
     });
@@ -2967,7 +3289,7 @@ void AudioDevice::set_volume(SoundHandle voice_handle, float volume)
 
 void AudioDevice::set_delay_samples(SoundHandle voice_handle, size_t samples)
 {
-    foreach_voice(voice_handle, [this, samples](int ch) {
+    post_voice_command(voice_handle, [this, samples](int ch) {
         m_voice[ch]->delay_samples = samples;
     });
 }
@@ -3927,6 +4249,7 @@ void AudioDevice::stop_voice_internal(size_t aVoice)
         // Delete via temporary variable to avoid recursion
         auto v = m_voice[aVoice];
         m_voice[aVoice].reset();
+        m_voice_reserved[aVoice].store(false, std::memory_order_release);
 
         for (size_t i = 0; i < m_max_active_voices; ++i)
         {
@@ -7,13 +7,24 @@
 #include "audio/AudioSource.hpp"
 #include "audio/Common.hpp"
 #include "audio/Misc.hpp"
+#include "audio/SpscQueue.hpp"
+#include "audio/Thread.hpp"
+#include "cerlib/Audio.hpp"
 #include "cerlib/Sound.hpp"
 #include "cerlib/SoundTypes.hpp"
 #include <cerlib/CopyMoveMacros.hpp>
 #include <cerlib/List.hpp>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <optional>
 #include <span>
+#include <string_view>
+#include <type_traits>
 #include <unordered_set>
+#include <variant>
 
 namespace cer
 {
@@ -23,10 +34,11 @@ class SoundChannel;
 class AudioDevice
 {
   public:
-    explicit AudioDevice(EngineFlags flags,
-                         size_t      sample_rate,
-                         size_t      buffer_size,
-                         size_t      channels);
+    explicit AudioDevice(EngineFlags  flags,
+                         size_t       sample_rate,
+                         size_t       buffer_size,
+                         size_t       channels,
+                         AudioBackend backend = AudioBackend::Auto);
 
     forbid_copy_and_move(AudioDevice);
 
@@ -70,6 +82,24 @@ class AudioDevice
     // Returns current backend buffer size
     auto backend_buffer_size() const -> size_t;
 
+    // Returns the backend that drives the mixer
+    auto backend() const -> AudioBackend;
+
+    // Mixes the next destination.size() / channels frames into an interleaved buffer.
+    // Only valid with the null driver.
+    void render_offline(std::span<float> destination);
+
+    // Mixes the next frame_count frames into a 32-bit float WAV file. Only valid with the
+    // null driver.
+    void render_offline_to_file(std::string_view filename, size_t frame_count);
+
+    // Returns statistics about all mixing passes so far
+    auto mixer_stats() -> AudioMixerStats;
+
+    // Sets the number of worker threads that render voices in addition to the audio thread.
+    // Zero mixes all voices on the audio thread.
+    void set_mix_worker_count(size_t count);
+
     // Set speaker position in 3d space
     void speaker_position(size_t channel, Vector3 value);
 
@@ -411,9 +441,40 @@ class AudioDevice
                           size_t    channels,
                           Resampler resampler);
 
+    // Get a voice's source data, run its filters and resample it into scratch.
+    // seek_scratch is used when looping voices have to seek.
+    void render_voice_internal(AudioSourceInstance& voice,
+                               float*               scratch,
+                               float*               seek_scratch,
+                               size_t               samples_to_read,
+                               size_t               buffer_size,
+                               float                sample_rate,
+                               Resampler            resampler);
+
+    // Advance an inaudible voice without rendering it
+    void tick_inaudible_voice_internal(AudioSourceInstance& voice,
+                                       size_t               samples_to_read,
+                                       float                sample_rate);
+
+    // Render and pan the voices in m_mix_voices on the mix worker pool. The per-task
+    // results are summed into buffer in task order.
+    void mix_voices_parallel_internal(float*    buffer,
+                                      size_t    samples_to_read,
+                                      size_t    buffer_size,
+                                      float     sample_rate,
+                                      size_t    channels,
+                                      Resampler resampler);
+
     // Find a free voice, stopping the oldest if no free voice is found.
     auto find_free_voice_internal() -> size_t;
 
+    // Reserve a free voice without taking the audio mutex. Only called on the game
+    // thread. Returns size_t(-1) if all voices are in use.
+    auto reserve_voice_internal() -> size_t;
+
+    // Apply the commands that the game thread has posted so far.
+    void process_commands_internal();
+
     // Converts handle to voice, if the handle is valid. Returns -1 if not.
     auto get_voice_from_handle_internal(SoundHandle voice_handle) const -> int;
 
@@ -464,12 +525,18 @@ class AudioDevice
 
     template <typename Action>
     void foreach_voice(SoundHandle voice_handle, const Action& action)
+    {
+        lock_audio_mutex_internal();
+        foreach_voice_internal(voice_handle, action);
+        unlock_audio_mutex_internal();
+    }
+
+    template <typename Action>
+    void foreach_voice_internal(SoundHandle voice_handle, const Action& action)
     {
         const auto  handles = std::array<SoundHandle, 2>{voice_handle, 0};
         const auto* handle  = voice_group_handle_to_array_internal(voice_handle);
 
-        lock_audio_mutex_internal();
-
         if (handle == nullptr)
         {
             handle = handles.data();
@@ -484,8 +551,14 @@ class AudioDevice
 
             ++handle;
         }
+    }
 
-        unlock_audio_mutex_internal();
+    // Like foreach_voice(), but runs the action on the mixer's side the next time it
+    // processes commands, instead of waiting for the audio mutex.
+    template <typename Action>
+    void post_voice_command(SoundHandle voice_handle, const Action& action)
+    {
+        post_command_internal(VoiceCommand{voice_handle, action});
     }
 
     template <typename Action>
@@ -611,16 +684,120 @@ class AudioDevice
 
     EngineFlags m_flags;
 
+    // The backend that drives the mixer
+    AudioBackend m_backend = AudioBackend::Auto;
+
+    // Accumulated mixer statistics. Protected by the audio thread mutex.
+    AudioMixerStats m_mixer_stats;
+
+    // Starts a voice that the game thread has reserved.
+    struct PlayCommand
+    {
+        std::shared_ptr<AudioSourceInstance> instance;
+        size_t                               voice{};
+        float                                volume{};
+        float                                pan{};
+    };
+
+    // Runs an action for every voice of a handle, as foreach_voice() does. The action is
+    // stored inline, so posting a command never allocates.
+    class VoiceCommand
+    {
+      public:
+        VoiceCommand() = default;
+
+        template <typename Action>
+        VoiceCommand(SoundHandle voice_handle, const Action& action)
+            : m_voice_handle(voice_handle)
+            , m_invoke([](AudioDevice& device, SoundHandle handle, const std::byte* storage) {
+                device.foreach_voice_internal(
+                    handle,
+                    *std::launder(reinterpret_cast<const Action*>(storage)));
+            })
+        {
+            static_assert(std::is_trivially_copyable_v<Action>,
+                          "voice command actions must capture by value");
+            static_assert(sizeof(Action) <= sizeof(m_storage));
+
+            new (m_storage.data()) Action(action);
+        }
+
+        void operator()(AudioDevice& device) const
+        {
+            m_invoke(device, m_voice_handle, m_storage.data());
+        }
+
+      private:
+        SoundHandle m_voice_handle{};
+        void (*m_invoke)(AudioDevice&, SoundHandle, const std::byte*) = nullptr;
+        alignas(std::max_align_t) std::array<std::byte, 32> m_storage{};
+    };
+
+    using AudioCommand = std::variant<PlayCommand, VoiceCommand>;
+
+    // Posts a command for the mixer. Falls back to taking the audio mutex when the queue
+    // is full.
+    void post_command_internal(AudioCommand command);
+
+    void execute_command_internal(AudioCommand& command);
+
+    // Commands from the game thread, drained whenever the audio mutex is taken.
+    // The audio API may be used from any thread, so pushes are serialized by
+    // m_producer_mutex, which then acts as the queue's single producer.
+    SpscQueue<AudioCommand, audio_command_queue_capacity> m_commands;
+
+    // Taken by threads that post commands or create voice handles. Never taken by the
+    // mixer, and always taken before the audio mutex.
+    std::mutex m_producer_mutex;
+
+    // Voices that are in use or reserved by the game thread for a pending play command.
+    // The game thread sets these; stopping a voice clears its flag.
+    std::array<std::atomic<bool>, cer::max_voice_count> m_voice_reserved{};
+
+    // A share of the voices of one bus, rendered by a single mix task.
+    class MixTask final : public thread::PoolTask
+    {
+      public:
+        void work() override;
+
+        AudioDevice* device = nullptr;
+        size_t       first_voice{};
+        size_t       voice_count{};
+        size_t       samples_to_read{};
+        size_t       buffer_size{};
+        float        sample_rate{};
+        size_t       channels{};
+        Resampler    resampler{};
+
+        // Scratch memory owned by this task, so that tasks never share buffers.
+        AlignedFloatBuffer voice_output;
+        AlignedFloatBuffer seek_scratch;
+        AlignedFloatBuffer accumulation;
+    };
+
+    // Persistent threads that help the audio thread render voices.
+    std::unique_ptr<thread::Pool> m_mix_pool;
+
+    // One task per mix thread; the audio thread runs the first one itself.
+    List<MixTask> m_mix_tasks;
+
+    // Audible voices (indices into m_voice) of the bus that is currently mixed in parallel
+    List<size_t> m_mix_voices;
+
+    // Number of mix tasks of the current pass that haven't finished yet
+    std::atomic<size_t> m_pending_mix_tasks{};
+
     // Global volume. Applied before clipping.
     float m_global_volume = 0.0f;
 
     // Post-clip scaler. Applied after clipping.
     float m_post_clip_scaler = 0.0f;
 
-    // Current play index. Used to create audio handles.
+    // Current play index. Used to create audio handles. Guarded by m_producer_mutex.
     size_t m_play_index = 0;
 
-    // Current sound source index. Used to create sound source IDs.
+    // Current sound source index. Used to create sound source IDs. Guarded by
+    // m_producer_mutex.
     size_t m_audio_source_id = 1;
 
     // Fader for the global volume.
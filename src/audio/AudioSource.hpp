@@ -26,6 +26,7 @@ freely, subject to the following restrictions:
 
 #include "audio/Fader.hpp"
 #include "audio/Filter.hpp"
+#include "audio/InstancePool.hpp"
 #include "cerlib/Vector3.hpp"
 #include <array>
 #include <memory>
@@ -335,5 +336,8 @@ class AudioSource
 
     // When looping, start playing from this time
     SoundTime loop_point = 0;
+
+    // Storage for the instances created by create_instance(), recycled across plays
+    std::shared_ptr<InstancePool> instance_pool = std::make_shared<InstancePool>();
 };
 }; // namespace cer
@@ -139,6 +139,6 @@ void BiquadResonantFilterInstance::filter_channel(const FilterChannelArgs& args)
 
 auto BiquadResonantFilter::create_instance() -> std::shared_ptr<FilterInstance>
 {
-    return std::make_shared<BiquadResonantFilterInstance>(this);
+    return make_pooled_instance<BiquadResonantFilterInstance>(instance_pool, this);
 }
 } // namespace cer
@@ -152,6 +152,9 @@ void Bus::find_bus_handle()
         return;
     }
 
+    // Taking the lock also applies a pending play command for the bus itself.
+    engine->lock_audio_mutex_internal();
+
     const auto highest_voice = engine->highest_voice();
     const auto voices        = engine->voices();
 
@@ -163,6 +166,8 @@ void Bus::find_bus_handle()
             m_channel_handle = engine->get_handle_from_voice_internal(i);
         }
     }
+
+    engine->unlock_audio_mutex_internal();
 }
 
 auto Bus::play(AudioSource& sound, float volume, float pan, bool paused) -> SoundHandle
@@ -52,6 +52,15 @@ static constexpr size_t max_voice_count = 1024;
 // 1)mono, 2)stereo 4)quad 6)5.1 8)7.1
 static constexpr size_t max_channels = 8;
 
+// Maximum number of worker threads that help the audio thread render voices
+static constexpr size_t max_mix_worker_count = 3;
+
+// Buses with fewer audible voices than this are mixed on the audio thread alone
+static constexpr size_t min_parallel_mix_voice_count = 8;
+
+// Number of commands the game thread can post before the mixer has to pick them up
+static constexpr size_t audio_command_queue_capacity = 4096;
+
 using mutexCallFunction    = void (*)(void*);
 using soloudCallFunction   = void (*)(AudioDevice*);
 using soloudResultFunction = bool (*)(AudioDevice*);
@@ -96,6 +105,15 @@ struct EngineFlags
     bool no_fpu_register_change : 1 = false;
 };
 
+// Backends that can drive the mixer
+enum class AudioBackend
+{
+    // The platform's audio backend (SDL)
+    Auto = 0,
+    // No audio output; the mixer only runs when mix() is called explicitly
+    NullDriver = 1,
+};
+
 // Default resampler for both main and bus mixers
 static constexpr auto default_resampler = Resampler::Linear;
 }; // namespace cer
@@ -0,0 +1,317 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "audio/FFT.hpp"
+#include "audio/Filter.hpp"
+#include "audio/SoundImpl.hpp"
+#include "cerlib/Sound.hpp"
+#include "math/Float4.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace cer
+{
+// The FFT works on complex numbers, so real signals of 2 * partition_size samples are
+// transformed with their imaginary parts set to zero. Their spectra are symmetric, which
+// is why only the partition_size + 1 bins of non-negative frequency are kept. Spectra are
+// stored as all real parts followed by all imaginary parts, each padded to a multiple of
+// four, so that they can be multiplied four bins at a time.
+static auto bin_count(size_t partition_size) -> size_t
+{
+    return (partition_size + 1 + 3) & ~size_t(3);
+}
+
+// Transforms the real samples in fft_buffer (interleaved with zero imaginary parts) and
+// stores the non-negative bins in spectrum.
+static void forward_transform(float* fft_buffer, size_t partition_size, float* spectrum)
+{
+    const auto bins = bin_count(partition_size);
+
+    FFT::fft(fft_buffer, partition_size * 4);
+
+    std::fill_n(spectrum, bins * 2, 0.0f);
+
+    for (size_t k = 0; k <= partition_size; ++k)
+    {
+        spectrum[k]        = fft_buffer[k * 2];
+        spectrum[bins + k] = fft_buffer[(k * 2) + 1];
+    }
+}
+
+// accumulator += lhs * rhs, for complex spectra in the layout of forward_transform().
+static void multiply_add_spectrum(float*       accumulator,
+                                  const float* lhs,
+                                  const float* rhs,
+                                  size_t       partition_size)
+{
+    using namespace details;
+
+    const auto bins = bin_count(partition_size);
+
+    for (size_t k = 0; k < bins; k += 4)
+    {
+        const auto lhs_re = load4(lhs + k);
+        const auto lhs_im = load4(lhs + bins + k);
+        const auto rhs_re = load4(rhs + k);
+        const auto rhs_im = load4(rhs + bins + k);
+
+        const auto re = sub4(mul4(lhs_re, rhs_re), mul4(lhs_im, rhs_im));
+        const auto im = add4(mul4(lhs_re, rhs_im), mul4(lhs_im, rhs_re));
+
+        store4(accumulator + k, add4(load4(accumulator + k), re));
+        store4(accumulator + bins + k, add4(load4(accumulator + bins + k), im));
+    }
+}
+
+ConvolutionFilterInstance::ConvolutionFilterInstance(ConvolutionFilter* parent)
+    : m_parent(parent)
+{
+    FilterInstance::init_params(1);
+}
+
+void ConvolutionFilterInstance::init_channels(size_t channel_count)
+{
+    // Like FFTFilterInstance, the channel count is only known once the first samples
+    // arrive.
+    const auto partition_size = m_parent->m_partition_size;
+    const auto spectrum_size  = m_parent->spectrum_size();
+
+    m_channel_count = channel_count;
+    m_input         = std::make_unique<float[]>(partition_size * 2 * channel_count);
+    m_output        = std::make_unique<float[]>(partition_size * channel_count);
+    m_input_spectra =
+        std::make_unique<float[]>(spectrum_size * m_parent->m_partition_count * channel_count);
+    m_fft_buffer    = std::make_unique<float[]>(partition_size * 4);
+    m_accumulator   = std::make_unique<float[]>(spectrum_size * channel_count);
+    m_fill          = 0;
+    m_spectrum_slot = 0;
+}
+
+void ConvolutionFilterInstance::filter(const FilterArgs& args)
+{
+    update_params(args.time);
+
+    if (args.channels != m_channel_count)
+    {
+        init_channels(args.channels);
+    }
+
+    const auto partition_size = m_parent->m_partition_size;
+    const auto wet            = m_params[ConvolutionFilter::WET];
+
+    auto offset = size_t(0);
+
+    while (offset < args.samples)
+    {
+        const auto count = std::min(partition_size - m_fill, args.samples - offset);
+
+        for (size_t ch = 0; ch < m_channel_count; ++ch)
+        {
+            // New samples go into the current partition, the second half of the input.
+            auto*       buffer = args.buffer + (ch * args.buffer_size) + offset;
+            auto*       input  = m_input.get() + (((ch * 2) + 1) * partition_size) + m_fill;
+            const auto* output = m_output.get() + (ch * partition_size) + m_fill;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                input[i] = buffer[i];
+                buffer[i] += (output[i] - buffer[i]) * wet;
+            }
+        }
+
+        m_fill += count;
+        offset += count;
+
+        if (m_fill == partition_size)
+        {
+            process_partition();
+
+            m_spectrum_slot = (m_spectrum_slot + 1) % m_parent->m_partition_count;
+            m_fill          = 0;
+        }
+    }
+}
+
+void ConvolutionFilterInstance::process_partition()
+{
+    const auto partition_size  = m_parent->m_partition_size;
+    const auto partition_count = m_parent->m_partition_count;
+    const auto spectrum_size   = m_parent->spectrum_size();
+    const auto bins            = bin_count(partition_size);
+
+    auto* fft = m_fft_buffer.get();
+
+    const auto input_spectra = [&](size_t channel) {
+        return m_input_spectra.get() + (channel * spectrum_size * partition_count);
+    };
+
+    for (size_t ch = 0; ch < m_channel_count; ++ch)
+    {
+        auto* input = m_input.get() + (ch * partition_size * 2);
+
+        for (size_t i = 0; i < partition_size * 2; ++i)
+        {
+            fft[i * 2]       = input[i];
+            fft[(i * 2) + 1] = 0.0f;
+        }
+
+        forward_transform(fft,
+                          partition_size,
+                          input_spectra(ch) + (m_spectrum_slot * spectrum_size));
+
+        // The current partition becomes the previous one for the next frame.
+        std::memcpy(input, input + partition_size, partition_size * sizeof(float));
+    }
+
+    std::fill_n(m_accumulator.get(), spectrum_size * m_channel_count, 0.0f);
+
+    // Input frame i partitions ago meets response partition i. The spectra don't fit into
+    // the cache for long responses, so a response partition that several channels share is
+    // applied to all of them while it's loaded.
+    for (size_t i = 0; i < partition_count; ++i)
+    {
+        const auto slot = (m_spectrum_slot + partition_count - i) % partition_count;
+
+        for (size_t ch = 0; ch < m_channel_count; ++ch)
+        {
+            const auto response_channel = ch % m_parent->m_channel_count;
+
+            const auto* response =
+                m_parent->m_spectra.get() +
+                (((response_channel * partition_count) + i) * spectrum_size);
+
+            multiply_add_spectrum(m_accumulator.get() + (ch * spectrum_size),
+                                  input_spectra(ch) + (slot * spectrum_size),
+                                  response,
+                                  partition_size);
+        }
+    }
+
+    for (size_t ch = 0; ch < m_channel_count; ++ch)
+    {
+        // Restore the negative frequencies from the symmetry of real signals.
+        const auto* acc_re = m_accumulator.get() + (ch * spectrum_size);
+        const auto* acc_im = acc_re + bins;
+
+        for (size_t k = 0; k <= partition_size; ++k)
+        {
+            fft[k * 2]       = acc_re[k];
+            fft[(k * 2) + 1] = acc_im[k];
+        }
+
+        for (size_t k = partition_size + 1; k < partition_size * 2; ++k)
+        {
+            fft[k * 2]       = acc_re[(partition_size * 2) - k];
+            fft[(k * 2) + 1] = -acc_im[(partition_size * 2) - k];
+        }
+
+        FFT::ifft(fft, partition_size * 4);
+
+        // Overlap-save: the first half wrapped around and is discarded.
+        auto* output = m_output.get() + (ch * partition_size);
+
+        for (size_t i = 0; i < partition_size; ++i)
+        {
+            output[i] = fft[(partition_size + i) * 2];
+        }
+    }
+}
+
+ConvolutionFilter::ConvolutionFilter(const Sound& impulse_response, size_t partition_size)
+    : m_partition_size(partition_size)
+{
+    if (!impulse_response)
+    {
+        throw std::invalid_argument{"No impulse response specified."};
+    }
+
+    if (partition_size < 4 || (partition_size & (partition_size - 1)) != 0)
+    {
+        throw std::invalid_argument{"The partition size must be a power of two."};
+    }
+
+    auto& source   = impulse_response.impl()->audio_source();
+    auto  instance = source.create_instance();
+
+    instance->init(source, 0);
+    instance->flags.loops = false;
+
+    m_channel_count = source.channel_count;
+
+    // Read the whole response, one channel after the other.
+    auto samples      = List<List<float>>(m_channel_count);
+    auto chunk        = List<float>(sample_granularity * m_channel_count);
+    auto sample_count = size_t(0);
+
+    while (!instance->has_ended())
+    {
+        const auto count = instance->audio(chunk.data(), sample_granularity, sample_granularity);
+
+        if (count == 0)
+        {
+            break;
+        }
+
+        for (size_t ch = 0; ch < m_channel_count; ++ch)
+        {
+            const auto* channel_chunk = chunk.data() + (ch * sample_granularity);
+            samples[ch].insert(samples[ch].end(), channel_chunk, channel_chunk + count);
+        }
+
+        sample_count += count;
+    }
+
+    m_partition_count = std::max((sample_count + partition_size - 1) / partition_size, size_t(1));
+    m_spectra = std::make_unique<float[]>(spectrum_size() * m_partition_count * m_channel_count);
+
+    auto fft = List<float>(partition_size * 4);
+
+    for (size_t ch = 0; ch < m_channel_count; ++ch)
+    {
+        for (size_t p = 0; p < m_partition_count; ++p)
+        {
+            std::ranges::fill(fft, 0.0f);
+
+            const auto first = p * partition_size;
+            const auto count = std::min(partition_size, sample_count - first);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                fft[i * 2] = samples[ch][first + i];
+            }
+
+            forward_transform(
+                fft.data(),
+                partition_size,
+                m_spectra.get() + (((ch * m_partition_count) + p) * spectrum_size()));
+        }
+    }
+}
+
+auto ConvolutionFilter::create_instance() -> std::shared_ptr<FilterInstance>
+{
+    return make_pooled_instance<ConvolutionFilterInstance>(instance_pool, this);
+}
+
+auto ConvolutionFilter::partition_size() const -> size_t
+{
+    return m_partition_size;
+}
+
+auto ConvolutionFilter::partition_count() const -> size_t
+{
+    return m_partition_count;
+}
+
+auto ConvolutionFilter::multiply_adds_per_sample() const -> double
+{
+    return double(m_partition_count * (m_partition_size + 1)) / double(m_partition_size);
+}
+
+auto ConvolutionFilter::spectrum_size() const -> size_t
+{
+    return bin_count(m_partition_size) * 2;
+}
+} // namespace cer
@@ -120,6 +120,6 @@ void DuckFilterInstance::filter(const FilterArgs& args)
 
 auto DuckFilter::create_instance() -> std::shared_ptr<FilterInstance>
 {
-    return std::make_shared<DuckFilterInstance>(this);
+    return make_pooled_instance<DuckFilterInstance>(instance_pool, this);
 }
 } // namespace cer
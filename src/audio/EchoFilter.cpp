@@ -78,6 +78,6 @@ void EchoFilterInstance::filter(const FilterArgs& args)
 
 auto EchoFilter::create_instance() -> std::shared_ptr<FilterInstance>
 {
-    return std::make_shared<EchoFilterInstance>(this);
+    return make_pooled_instance<EchoFilterInstance>(instance_pool, this);
 }
 } // namespace cer
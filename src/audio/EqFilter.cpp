@@ -87,6 +87,6 @@ EqFilter::EqFilter()
 
 auto EqFilter::create_instance() -> std::shared_ptr<FilterInstance>
 {
-    return std::make_shared<EqFilterInstance>(this);
+    return make_pooled_instance<EqFilterInstance>(instance_pool, this);
 }
 } // namespace cer
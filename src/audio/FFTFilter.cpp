@@ -281,6 +281,6 @@ void FFTFilterInstance::fft_filter_channel(const FilterChannelArgs& args)
 
 auto FFTFilter::create_instance() -> std::shared_ptr<FilterInstance>
 {
-    return std::make_shared<FFTFilterInstance>(this);
+    return make_pooled_instance<FFTFilterInstance>(instance_pool, this);
 }
 } // namespace cer
@@ -1,4 +1,6 @@
 set(audio_files
+  Adpcm.cpp
+  Adpcm.hpp
   Audio.cpp
   AudioDevice.cpp
   AudioDevice.hpp
@@ -14,6 +16,7 @@ set(audio_files
   Bus.cpp
   Bus.hpp
   Common.hpp
+  ConvolutionFilter.cpp
   dr_flac.h
   dr_impl.cpp
   dr_mp3.h
@@ -30,17 +33,24 @@ set(audio_files
   Filter.hpp
   FlangerFilter.cpp
   FreeverbFilter.cpp
+  InstancePool.cpp
+  InstancePool.hpp
   LofiFilter.cpp
   Misc.cpp
   Misc.hpp
   Noise.cpp
   Noise.hpp
+  NullBackend.cpp
   Queue.cpp
   Queue.hpp
+  Resampler.cpp
+  Resampler.hpp
+  ResamplerAvx2.cpp
   RobotizeFilter.cpp
   Sfxr.cpp
   Sfxr.hpp
   soloud_internal.hpp
+  SpscQueue.hpp
   Thread.cpp
   Thread.hpp
   Wav.cpp
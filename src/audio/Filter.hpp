@@ -26,11 +26,14 @@ freely, subject to the following restrictions:
 
 #include "audio/Common.hpp"
 #include "audio/Fader.hpp"
+#include "audio/InstancePool.hpp"
 #include <array>
 #include <memory>
 
 namespace cer
 {
+class Sound;
+
 struct FilterArgs
 {
     float*    buffer      = nullptr;
@@ -93,6 +96,9 @@ class Filter
     virtual ~Filter() noexcept = default;
 
     virtual auto create_instance() -> std::shared_ptr<FilterInstance> = 0;
+
+    // Storage for the instances created by create_instance(), recycled across plays
+    std::shared_ptr<InstancePool> instance_pool = std::make_shared<InstancePool>();
 };
 
 class FlangerFilter;
@@ -438,6 +444,94 @@ class EqFilter final : public FFTFilter
     std::array<float, 8> m_volume{};
 };
 
+class ConvolutionFilter;
+
+class ConvolutionFilterInstance final : public FilterInstance
+{
+  public:
+    explicit ConvolutionFilterInstance(ConvolutionFilter* parent);
+
+    void filter(const FilterArgs& args) override;
+
+  private:
+    void init_channels(size_t channel_count);
+
+    // Filters the partition that was just completed, for all channels.
+    void process_partition();
+
+    ConvolutionFilter* m_parent        = nullptr;
+    size_t             m_channel_count = 0;
+
+    // Per channel: the previous and the current partition of input samples.
+    std::unique_ptr<float[]> m_input;
+
+    // Per channel: the filtered partition that is currently being output.
+    std::unique_ptr<float[]> m_output;
+
+    // Per channel: the spectra of the last partition_count() input frames, as a ring.
+    std::unique_ptr<float[]> m_input_spectra;
+
+    std::unique_ptr<float[]> m_fft_buffer;
+    std::unique_ptr<float[]> m_accumulator;
+
+    // Number of samples of the current partition that were received so far
+    size_t m_fill = 0;
+
+    // The slot in m_input_spectra that the next input frame is written to
+    size_t m_spectrum_slot = 0;
+};
+
+// Convolves the signal with an impulse response, such as the recording of a room, using
+// uniformly partitioned overlap-save convolution.
+//
+// The response is split into partitions of partition_size() samples, whose spectra are
+// computed once. Each partition of input is then transformed once, multiplied with the
+// spectra of all response partitions and transformed back, which costs O(N log N) per
+// partition instead of O(N * response length). The output lags the input by one
+// partition.
+class ConvolutionFilter final : public Filter
+{
+    friend ConvolutionFilterInstance;
+
+  public:
+    enum FILTERATTRIBUTE
+    {
+        WET = 0
+    };
+
+    // The response is used at the sample rate of the signal it filters, so it should be
+    // loaded with SoundLoadOptions::resample_to_device_rate if its rate differs.
+    // A mono response is applied to every channel, otherwise channel i of the signal is
+    // convolved with channel i of the response.
+    // partition_size must be a power of two. Filters of voices and buses receive
+    // sample_granularity samples at a time, so that is the lowest latency that also
+    // avoids filtering partial partitions.
+    explicit ConvolutionFilter(const Sound& impulse_response,
+                               size_t       partition_size = sample_granularity);
+
+    auto create_instance() -> std::shared_ptr<FilterInstance> override;
+
+    auto partition_size() const -> size_t;
+
+    auto partition_count() const -> size_t;
+
+    // The number of complex multiply-adds per sample and channel, which grows with the
+    // length of the response. This is an operation count that leaves out the FFTs, not a
+    // measured cost.
+    auto multiply_adds_per_sample() const -> double;
+
+  private:
+    // Stride of one spectrum in m_spectra and ConvolutionFilterInstance::m_input_spectra.
+    auto spectrum_size() const -> size_t;
+
+    size_t m_partition_size  = 0;
+    size_t m_partition_count = 0;
+    size_t m_channel_count   = 0;
+
+    // The spectrum of every partition of the response, for each of its channels.
+    std::unique_ptr<float[]> m_spectra;
+};
+
 class BiquadResonantFilter;
 
 struct BQRStateData
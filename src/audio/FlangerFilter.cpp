@@ -79,6 +79,6 @@ FlangerFilter::FlangerFilter()
 
 auto FlangerFilter::create_instance() -> std::shared_ptr<FilterInstance>
 {
-    return std::make_shared<FlangerFilterInstance>(this);
+    return make_pooled_instance<FlangerFilterInstance>(instance_pool, this);
 }
 } // namespace cer
@@ -487,6 +487,6 @@ void FreeverbFilterInstance::filter(const FilterArgs& args)
 
 auto FreeverbFilter::create_instance() -> std::shared_ptr<FilterInstance>
 {
-    return std::make_shared<FreeverbFilterInstance>(this);
+    return make_pooled_instance<FreeverbFilterInstance>(instance_pool, this);
 }
 } // namespace cer
@@ -0,0 +1,86 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "audio/InstancePool.hpp"
+#include <algorithm>
+#include <new>
+
+namespace cer
+{
+InstancePool::~InstancePool() noexcept
+{
+    while (m_free_list != nullptr)
+    {
+        auto* next = m_free_list->next;
+        ::operator delete(m_free_list, std::align_val_t(m_block_alignment));
+        m_free_list = next;
+    }
+}
+
+auto InstancePool::allocate(size_t size, size_t alignment) -> void*
+{
+    {
+        const auto lock = std::scoped_lock{m_mutex};
+
+        if (m_block_size == 0)
+        {
+            // The first allocation determines the block layout of this pool.
+            m_block_size      = std::max(size, sizeof(FreeBlock));
+            m_block_alignment = std::max(alignment, alignof(FreeBlock));
+        }
+
+        if (is_poolable(size, alignment))
+        {
+            if (m_free_list != nullptr)
+            {
+                auto* block = m_free_list;
+                m_free_list = block->next;
+                --m_free_block_count;
+                return block;
+            }
+
+            ++m_allocated_block_count;
+
+            return ::operator new(m_block_size, std::align_val_t(m_block_alignment));
+        }
+    }
+
+    // Not expected to happen, since a source always creates the same instance type.
+    return ::operator new(size, std::align_val_t(alignment));
+}
+
+void InstancePool::deallocate(void* block, size_t size, size_t alignment) noexcept
+{
+    {
+        const auto lock = std::scoped_lock{m_mutex};
+
+        if (is_poolable(size, alignment))
+        {
+            m_free_list = new (block) FreeBlock{m_free_list};
+            ++m_free_block_count;
+            return;
+        }
+    }
+
+    ::operator delete(block, std::align_val_t(alignment));
+}
+
+auto InstancePool::allocated_block_count() const -> size_t
+{
+    const auto lock = std::scoped_lock{m_mutex};
+    return m_allocated_block_count;
+}
+
+auto InstancePool::free_block_count() const -> size_t
+{
+    const auto lock = std::scoped_lock{m_mutex};
+    return m_free_block_count;
+}
+
+auto InstancePool::is_poolable(size_t size, size_t alignment) const -> bool
+{
+    return std::max(size, sizeof(FreeBlock)) == m_block_size &&
+           std::max(alignment, alignof(FreeBlock)) == m_block_alignment;
+}
+} // namespace cer
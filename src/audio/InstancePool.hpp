@@ -0,0 +1,108 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <cerlib/CopyMoveMacros.hpp>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+namespace cer
+{
+// Recycles the storage of audio source and filter instances.
+//
+// Each source owns one pool. Because a source always creates instances of the same type, all
+// blocks have the same size, and a block freed by a stopped voice is handed to the next
+// play. After the first few plays, creating an instance therefore doesn't touch the heap.
+//
+// Blocks are usually freed on the audio thread and allocated on the game thread, so the
+// free list is guarded by its own mutex (never by the audio mutex).
+class InstancePool final
+{
+  public:
+    InstancePool() = default;
+
+    forbid_copy_and_move(InstancePool);
+
+    ~InstancePool() noexcept;
+
+    auto allocate(size_t size, size_t alignment) -> void*;
+
+    void deallocate(void* block, size_t size, size_t alignment) noexcept;
+
+    // The number of blocks that were obtained from the heap so far.
+    auto allocated_block_count() const -> size_t;
+
+    // The number of blocks that are ready to be reused.
+    auto free_block_count() const -> size_t;
+
+  private:
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    auto is_poolable(size_t size, size_t alignment) const -> bool;
+
+    mutable std::mutex m_mutex;
+    size_t             m_block_size{};
+    size_t             m_block_alignment{};
+    FreeBlock*         m_free_list{};
+    size_t             m_allocated_block_count{};
+    size_t             m_free_block_count{};
+};
+
+// Allocator that is passed to std::allocate_shared(), so that an instance and its
+// control block share a single pooled block.
+//
+// The allocator (and therefore the pool) is kept alive by the control block, which means
+// that instances may safely outlive the source that created them.
+template <typename T>
+class InstancePoolAllocator
+{
+  public:
+    using value_type = T;
+
+    explicit InstancePoolAllocator(std::shared_ptr<InstancePool> pool)
+        : m_pool(std::move(pool))
+    {
+    }
+
+    template <typename U>
+    explicit(false) InstancePoolAllocator(const InstancePoolAllocator<U>& other)
+        : m_pool(other.m_pool)
+    {
+    }
+
+    auto allocate(size_t n) -> T*
+    {
+        return static_cast<T*>(m_pool->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept
+    {
+        m_pool->deallocate(ptr, n * sizeof(T), alignof(T));
+    }
+
+    template <typename U>
+    auto operator==(const InstancePoolAllocator<U>& other) const -> bool
+    {
+        return m_pool == other.m_pool;
+    }
+
+  private:
+    template <typename U>
+    friend class InstancePoolAllocator;
+
+    std::shared_ptr<InstancePool> m_pool;
+};
+
+template <typename T, typename... Args>
+auto make_pooled_instance(const std::shared_ptr<InstancePool>& pool, Args&&... args)
+    -> std::shared_ptr<T>
+{
+    return std::allocate_shared<T>(InstancePoolAllocator<T>{pool}, std::forward<Args>(args)...);
+}
+} // namespace cer
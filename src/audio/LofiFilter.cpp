@@ -61,6 +61,6 @@ void LofiFilterInstance::filter_channel(const FilterChannelArgs& args)
 
 auto LofiFilter::create_instance() -> std::shared_ptr<FilterInstance>
 {
-    return std::make_shared<LofiFilterInstance>(this);
+    return make_pooled_instance<LofiFilterInstance>(instance_pool, this);
 }
 } // namespace cer
@@ -101,7 +101,7 @@ Noise::~Noise()
 
 auto Noise::create_instance() -> std::shared_ptr<AudioSourceInstance>
 {
-    return std::make_shared<NoiseInstance>(this);
+    return make_pooled_instance<NoiseInstance>(instance_pool, this);
 }
 
 void Noise::set_type(NoiseType type)
@@ -0,0 +1,13 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "audio/AudioDevice.hpp"
+#include "audio/soloud_internal.hpp"
+
+void cer::audio_null_init(const AudioBackendArgs& args)
+{
+    // The null driver has no audio thread and no output device. The mixer only runs
+    // when AudioDevice::mix() is called, e.g. by AudioDevice::render_offline().
+    args.device->postinit_internal(args.sample_rate, args.buffer, args.channel_count);
+}
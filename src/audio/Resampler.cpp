@@ -0,0 +1,357 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "audio/Resampler.hpp"
+#include "math/Float4.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if defined(CERLIB_HAVE_AVX2_RESAMPLER)
+#include <SDL3/SDL.h>
+#endif
+
+namespace cer::details
+{
+// The fractional part of a fixed-point position, in source samples times s_fixpoint_frac_mul.
+// It fits into 20 bits, so it's converted through int32_t, which is much cheaper than an
+// unsigned 64-bit conversion.
+static auto fraction(size_t pos) -> float
+{
+    return float(int32_t(pos & s_fixpoint_frac_mask));
+}
+
+auto catmull_rom(float t, float p0, float p1, float p2, float p3) -> float
+{
+    return 0.5f * (2 * p1 + (-p0 + p2) * t + (2 * p0 - 5 * p1 + 4 * p2 - p3) * t * t +
+                   (-p0 + 3 * p1 - 3 * p2 + p3) * t * t * t);
+}
+
+static void resample_catmull_rom(const float* src,
+                                 const float* prev_src,
+                                 float*       dst,
+                                 size_t       src_offset,
+                                 size_t       dst_sample_count,
+                                 size_t       step_fixed)
+{
+    auto pos = src_offset;
+
+    for (size_t i = 0; i < dst_sample_count; ++i, pos += step_fixed)
+    {
+        const auto p = pos >> s_fixpoint_frac_bits;
+
+        const auto s3 = p < 3 ? prev_src[sample_granularity + p - 3] : src[p - 3];
+        const auto s2 = p < 2 ? prev_src[sample_granularity + p - 2] : src[p - 2];
+        const auto s1 = p < 1 ? prev_src[sample_granularity + p - 1] : src[p - 1];
+        const auto s0 = src[p];
+
+        dst[i] = catmull_rom(fraction(pos) / float(s_fixpoint_frac_mul), s3, s2, s1, s0);
+    }
+}
+
+static void resample_linear(const float* src,
+                            const float* prev_src,
+                            float*       dst,
+                            size_t       src_offset,
+                            size_t       dst_sample_count,
+                            size_t       step_fixed)
+{
+    auto pos = src_offset;
+
+    for (size_t i = 0; i < dst_sample_count; ++i, pos += step_fixed)
+    {
+        const auto p  = pos >> s_fixpoint_frac_bits;
+        const auto s1 = p != 0 ? src[p - 1] : prev_src[sample_granularity - 1];
+        const auto s2 = src[p];
+
+        dst[i] = s1 + (s2 - s1) * fraction(pos) * (1 / float(s_fixpoint_frac_mul));
+    }
+}
+
+static void resample_point(const float* src,
+                           const float* /*prev_src*/,
+                           float*       dst,
+                           size_t       src_offset,
+                           size_t       dst_sample_count,
+                           size_t       step_fixed)
+{
+    if (step_fixed == s_fixpoint_frac_mul)
+    {
+        std::memcpy(dst,
+                    src + (src_offset >> s_fixpoint_frac_bits),
+                    dst_sample_count * sizeof(float));
+        return;
+    }
+
+    auto pos = src_offset;
+
+    for (size_t i = 0; i < dst_sample_count; ++i, pos += step_fixed)
+    {
+        dst[i] = src[pos >> s_fixpoint_frac_bits];
+    }
+}
+
+#if CERLIB_SIMD_SSE || CERLIB_SIMD_NEON
+// Four-wide kernels for SSE2 and NEON, both of which every CPU of the respective
+// architecture supports. Neither has a gather instruction, so the source samples are
+// loaded one by one, unless the voice plays at its native rate.
+
+// Source indices and interpolation fractions of four consecutive output samples.
+struct Positions4
+{
+    std::array<size_t, 4> index;
+    Float4                frac;
+};
+
+static auto positions4(size_t pos, size_t step_fixed) -> Positions4
+{
+    const auto pos1 = pos + step_fixed;
+    const auto pos2 = pos1 + step_fixed;
+    const auto pos3 = pos2 + step_fixed;
+
+    return Positions4{
+        .index = {pos >> s_fixpoint_frac_bits,
+                  pos1 >> s_fixpoint_frac_bits,
+                  pos2 >> s_fixpoint_frac_bits,
+                  pos3 >> s_fixpoint_frac_bits},
+        .frac  = set4(fraction(pos), fraction(pos1), fraction(pos2), fraction(pos3)),
+    };
+}
+
+// Loads the samples that lie offset samples before the given indices.
+template <bool IsUnitStep>
+static auto gather4(const float* src, const std::array<size_t, 4>& index, size_t offset)
+    -> Float4
+{
+    if constexpr (IsUnitStep)
+    {
+        return load4(src + index[0] - offset);
+    }
+    else
+    {
+        return set4(src[index[0] - offset],
+                    src[index[1] - offset],
+                    src[index[2] - offset],
+                    src[index[3] - offset]);
+    }
+}
+
+template <bool IsUnitStep>
+static void resample_catmull_rom4(const float* src,
+                                  const float* prev_src,
+                                  float*       dst,
+                                  size_t       src_offset,
+                                  size_t       dst_sample_count,
+                                  size_t       step_fixed)
+{
+    const auto head = resample_history_sample_count(src_offset, dst_sample_count, step_fixed, 3);
+
+    resample_catmull_rom(src, prev_src, dst, src_offset, head, step_fixed);
+
+    const auto half       = splat4(0.5f);
+    const auto two        = splat4(2.0f);
+    const auto three      = splat4(3.0f);
+    const auto four       = splat4(4.0f);
+    const auto five       = splat4(5.0f);
+    const auto frac_scale = splat4(1.0f / float(s_fixpoint_frac_mul));
+
+    auto i   = head;
+    auto pos = src_offset + (head * step_fixed);
+
+    for (; i + 4 <= dst_sample_count; i += 4, pos += 4 * step_fixed)
+    {
+        const auto [index, frac] = positions4(pos, step_fixed);
+
+        const auto p0 = gather4<IsUnitStep>(src, index, 3);
+        const auto p1 = gather4<IsUnitStep>(src, index, 2);
+        const auto p2 = gather4<IsUnitStep>(src, index, 1);
+        const auto p3 = gather4<IsUnitStep>(src, index, 0);
+        const auto t  = mul4(frac, frac_scale);
+
+        // Same order of operations as catmull_rom().
+        const auto a = mul4(two, p1);
+        const auto b = mul4(sub4(p2, p0), t);
+        const auto c = sub4(add4(sub4(mul4(two, p0), mul4(five, p1)), mul4(four, p2)), p3);
+        const auto d = add4(sub4(sub4(mul4(three, p1), p0), mul4(three, p2)), p3);
+
+        const auto ct2 = mul4(mul4(c, t), t);
+        const auto dt3 = mul4(mul4(mul4(d, t), t), t);
+
+        store4(dst + i, mul4(half, add4(add4(add4(a, b), ct2), dt3)));
+    }
+
+    resample_catmull_rom(src, prev_src, dst + i, pos, dst_sample_count - i, step_fixed);
+}
+
+template <bool IsUnitStep>
+static void resample_linear4(const float* src,
+                             const float* prev_src,
+                             float*       dst,
+                             size_t       src_offset,
+                             size_t       dst_sample_count,
+                             size_t       step_fixed)
+{
+    const auto head = resample_history_sample_count(src_offset, dst_sample_count, step_fixed, 1);
+
+    resample_linear(src, prev_src, dst, src_offset, head, step_fixed);
+
+    const auto frac_scale = splat4(1.0f / float(s_fixpoint_frac_mul));
+
+    auto i   = head;
+    auto pos = src_offset + (head * step_fixed);
+
+    for (; i + 4 <= dst_sample_count; i += 4, pos += 4 * step_fixed)
+    {
+        const auto [index, frac] = positions4(pos, step_fixed);
+
+        const auto s1 = gather4<IsUnitStep>(src, index, 1);
+        const auto s2 = gather4<IsUnitStep>(src, index, 0);
+
+        store4(dst + i, add4(s1, mul4(mul4(sub4(s2, s1), frac), frac_scale)));
+    }
+
+    resample_linear(src, prev_src, dst + i, pos, dst_sample_count - i, step_fixed);
+}
+
+template <auto Kernel, auto UnitStepKernel>
+static void dispatch_unit_step(const float* src,
+                               const float* prev_src,
+                               float*       dst,
+                               size_t       src_offset,
+                               size_t       dst_sample_count,
+                               size_t       step_fixed)
+{
+    if (step_fixed == s_fixpoint_frac_mul)
+    {
+        UnitStepKernel(src, prev_src, dst, src_offset, dst_sample_count, step_fixed);
+    }
+    else
+    {
+        Kernel(src, prev_src, dst, src_offset, dst_sample_count, step_fixed);
+    }
+}
+#endif
+
+// Output sample i is the source sample Delay samples before src_offset + i.
+template <size_t Delay, ResampleFunc ResampleKernels::*Fallback>
+static void copy_unit_step(const float* src,
+                           const float* prev_src,
+                           float*       dst,
+                           size_t       src_offset,
+                           size_t       dst_sample_count,
+                           size_t       step_fixed)
+{
+    if ((src_offset & s_fixpoint_frac_mask) != 0)
+    {
+        (resample_kernels().*Fallback)(
+            src, prev_src, dst, src_offset, dst_sample_count, step_fixed);
+        return;
+    }
+
+    const auto first = src_offset >> s_fixpoint_frac_bits;
+
+    auto i = size_t(0);
+
+    for (; i < dst_sample_count && first + i < Delay; ++i)
+    {
+        dst[i] = prev_src[sample_granularity + first + i - Delay];
+    }
+
+    std::memcpy(dst + i, src + first + i - Delay, (dst_sample_count - i) * sizeof(float));
+}
+
+auto ResampleKernels::get(Resampler resampler) const -> ResampleFunc
+{
+    switch (resampler)
+    {
+        case Resampler::Point: return point;
+        case Resampler::CatmullRom: return catmull_rom;
+        default: return linear;
+    }
+}
+
+auto scalar_resample_kernels() -> const ResampleKernels&
+{
+    static constexpr auto kernels = ResampleKernels{
+        .name        = "Scalar",
+        .point       = resample_point,
+        .linear      = resample_linear,
+        .catmull_rom = resample_catmull_rom,
+    };
+
+    return kernels;
+}
+
+auto supported_resample_kernels() -> std::span<const ResampleKernels>
+{
+    static const auto kernels = [] {
+        auto list = std::array<ResampleKernels, 3>{};
+        auto size = size_t(0);
+
+        list[size++] = scalar_resample_kernels();
+
+#if CERLIB_SIMD_SSE || CERLIB_SIMD_NEON
+        list[size++] = ResampleKernels{
+#if CERLIB_SIMD_SSE
+            .name = "SSE2",
+#else
+            .name = "NEON",
+#endif
+            // Point sampling is a plain copy either way.
+            .point  = resample_point,
+            .linear = dispatch_unit_step<resample_linear4<false>, resample_linear4<true>>,
+            .catmull_rom =
+                dispatch_unit_step<resample_catmull_rom4<false>, resample_catmull_rom4<true>>,
+        };
+#endif
+
+#if defined(CERLIB_HAVE_AVX2_RESAMPLER)
+        if (SDL_HasAVX2())
+        {
+            list[size++] = avx2_resample_kernels();
+        }
+#endif
+
+        return std::pair{list, size};
+    }();
+
+    return std::span{kernels.first.data(), kernels.second};
+}
+
+auto resample_kernels() -> const ResampleKernels&
+{
+    static const auto& kernels = supported_resample_kernels().back();
+    return kernels;
+}
+
+auto unit_step_resample_kernels() -> const ResampleKernels&
+{
+    static constexpr auto kernels = ResampleKernels{
+        .name        = "Copy",
+        .point       = copy_unit_step<0, &ResampleKernels::point>,
+        .linear      = copy_unit_step<1, &ResampleKernels::linear>,
+        .catmull_rom = copy_unit_step<2, &ResampleKernels::catmull_rom>,
+    };
+
+    return kernels;
+}
+
+auto resample_history_sample_count(size_t src_offset,
+                                   size_t dst_sample_count,
+                                   size_t step_fixed,
+                                   size_t history_size) -> size_t
+{
+    const auto history_end = history_size << s_fixpoint_frac_bits;
+
+    if (src_offset >= history_end)
+    {
+        return 0;
+    }
+
+    // Round up, so that the first sample after the head no longer reads from prev_src.
+    const auto count = (history_end - src_offset + step_fixed - 1) / step_fixed;
+
+    return std::min(count, dst_sample_count);
+}
+} // namespace cer::details
@@ -0,0 +1,74 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include "audio/Common.hpp"
+#include <span>
+
+namespace cer
+{
+static constexpr auto s_fixpoint_frac_bits = 20;
+static constexpr auto s_fixpoint_frac_mul  = 1 << s_fixpoint_frac_bits;
+static constexpr auto s_fixpoint_frac_mask = (1 << s_fixpoint_frac_bits) - 1;
+} // namespace cer
+
+namespace cer::details
+{
+// Resamples one channel of a voice.
+//
+// src is the current block of sample_granularity source samples, prev_src the block before
+// it, which provides the history that interpolation needs at the start of src.
+// src_offset and step_fixed are fixed-point values with s_fixpoint_frac_bits fractional
+// bits. The caller guarantees that no output sample reads past the end of src.
+using ResampleFunc = void (*)(const float* src,
+                              const float* prev_src,
+                              float*       dst,
+                              size_t       src_offset,
+                              size_t       dst_sample_count,
+                              size_t       step_fixed);
+
+// One implementation of every resampler, for a specific instruction set.
+struct ResampleKernels
+{
+    auto get(Resampler resampler) const -> ResampleFunc;
+
+    const char*  name{};
+    ResampleFunc point{};
+    ResampleFunc linear{};
+    ResampleFunc catmull_rom{};
+};
+
+// The portable implementation that all others are compared against.
+auto scalar_resample_kernels() -> const ResampleKernels&;
+
+// All implementations that the current CPU can run, from slowest to fastest.
+auto supported_resample_kernels() -> std::span<const ResampleKernels>;
+
+// The fastest implementation that the current CPU can run. Detected once.
+auto resample_kernels() -> const ResampleKernels&;
+
+// Kernels for voices that play at exactly the device rate (a step of 1.0). From a
+// whole-sample position, every resampler only reproduces the source samples, delayed by
+// its interpolation history, so these copy them instead. Other positions are passed on
+// to resample_kernels().
+auto unit_step_resample_kernels() -> const ResampleKernels&;
+
+// Interpolates between p1 and p2, with t in [0, 1).
+auto catmull_rom(float t, float p0, float p1, float p2, float p3) -> float;
+
+// Number of output samples at the start of a run that read from prev_src, given that
+// interpolation looks back history_size source samples. Vectorized kernels leave these
+// to the scalar ones.
+auto resample_history_sample_count(size_t src_offset,
+                                   size_t dst_sample_count,
+                                   size_t step_fixed,
+                                   size_t history_size) -> size_t;
+
+#if defined(CERLIB_HAVE_AVX2_RESAMPLER)
+// Defined in ResamplerAvx2.cpp, which is the only file compiled with AVX2 enabled.
+// Must only be called after checking that the CPU supports AVX2.
+auto avx2_resample_kernels() -> const ResampleKernels&;
+#endif
+} // namespace cer::details
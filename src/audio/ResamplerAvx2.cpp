@@ -0,0 +1,219 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+// This file is compiled with AVX2 enabled (see src/CMakeLists.txt), so nothing in here may
+// be reachable without a prior CPU check. For that reason it sticks to intrinsics and
+// leaves the head and tail of each run to the scalar kernels, instead of sharing inline
+// code with other translation units.
+
+#if defined(CERLIB_HAVE_AVX2_RESAMPLER)
+
+#include "audio/Resampler.hpp"
+#include <immintrin.h>
+
+namespace cer::details
+{
+namespace
+{
+// Source indices and interpolation fractions of eight consecutive output samples.
+struct Positions8
+{
+    __m256i index;
+    __m256  frac;
+};
+
+auto positions8(size_t pos, __m256i lane_offsets) -> Positions8
+{
+    // All positions in a run are below sample_granularity << s_fixpoint_frac_bits,
+    // so they fit into 32 bits.
+    const auto positions = _mm256_add_epi32(_mm256_set1_epi32(int(pos)), lane_offsets);
+
+    return Positions8{
+        .index = _mm256_srli_epi32(positions, s_fixpoint_frac_bits),
+        .frac  = _mm256_cvtepi32_ps(
+            _mm256_and_si256(positions, _mm256_set1_epi32(s_fixpoint_frac_mask))),
+    };
+}
+
+auto step_lane_offsets(size_t step_fixed) -> __m256i
+{
+    const auto step = uint32_t(step_fixed);
+
+    return _mm256_setr_epi32(0,
+                             int(step),
+                             int(step * 2),
+                             int(step * 3),
+                             int(step * 4),
+                             int(step * 5),
+                             int(step * 6),
+                             int(step * 7));
+}
+
+// Loads the samples that lie offset samples before the given indices.
+template <bool IsUnitStep>
+auto gather8(const float* src, const Positions8& positions, size_t offset) -> __m256
+{
+    if constexpr (IsUnitStep)
+    {
+        const auto first = size_t(_mm_cvtsi128_si32(_mm256_castsi256_si128(positions.index)));
+        return _mm256_loadu_ps(src + first - offset);
+    }
+    else
+    {
+        const auto index = _mm256_sub_epi32(positions.index, _mm256_set1_epi32(int(offset)));
+        return _mm256_i32gather_ps(src, index, sizeof(float));
+    }
+}
+
+template <bool IsUnitStep>
+void resample_catmull_rom8(const float* src,
+                           const float* prev_src,
+                           float*       dst,
+                           size_t       src_offset,
+                           size_t       dst_sample_count,
+                           size_t       step_fixed)
+{
+    const auto& scalar = scalar_resample_kernels();
+    const auto  head = resample_history_sample_count(src_offset, dst_sample_count, step_fixed, 3);
+
+    scalar.catmull_rom(src, prev_src, dst, src_offset, head, step_fixed);
+
+    const auto half         = _mm256_set1_ps(0.5f);
+    const auto two          = _mm256_set1_ps(2.0f);
+    const auto three        = _mm256_set1_ps(3.0f);
+    const auto four         = _mm256_set1_ps(4.0f);
+    const auto five         = _mm256_set1_ps(5.0f);
+    const auto frac_scale   = _mm256_set1_ps(1.0f / float(s_fixpoint_frac_mul));
+    const auto lane_offsets = step_lane_offsets(step_fixed);
+
+    auto i   = head;
+    auto pos = src_offset + (head * step_fixed);
+
+    for (; i + 8 <= dst_sample_count; i += 8, pos += 8 * step_fixed)
+    {
+        const auto positions = positions8(pos, lane_offsets);
+
+        const auto p0 = gather8<IsUnitStep>(src, positions, 3);
+        const auto p1 = gather8<IsUnitStep>(src, positions, 2);
+        const auto p2 = gather8<IsUnitStep>(src, positions, 1);
+        const auto p3 = gather8<IsUnitStep>(src, positions, 0);
+        const auto t  = _mm256_mul_ps(positions.frac, frac_scale);
+
+        // Same order of operations as the scalar kernel.
+        const auto a = _mm256_mul_ps(two, p1);
+        const auto b = _mm256_mul_ps(_mm256_sub_ps(p2, p0), t);
+        const auto c = _mm256_sub_ps(
+            _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(two, p0), _mm256_mul_ps(five, p1)),
+                          _mm256_mul_ps(four, p2)),
+            p3);
+        const auto d = _mm256_add_ps(
+            _mm256_sub_ps(_mm256_sub_ps(_mm256_mul_ps(three, p1), p0), _mm256_mul_ps(three, p2)),
+            p3);
+
+        const auto ct2 = _mm256_mul_ps(_mm256_mul_ps(c, t), t);
+        const auto dt3 = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(d, t), t), t);
+        const auto sum = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(a, b), ct2), dt3);
+
+        _mm256_storeu_ps(dst + i, _mm256_mul_ps(half, sum));
+    }
+
+    scalar.catmull_rom(src, prev_src, dst + i, pos, dst_sample_count - i, step_fixed);
+}
+
+template <bool IsUnitStep>
+void resample_linear8(const float* src,
+                      const float* prev_src,
+                      float*       dst,
+                      size_t       src_offset,
+                      size_t       dst_sample_count,
+                      size_t       step_fixed)
+{
+    const auto& scalar = scalar_resample_kernels();
+    const auto  head = resample_history_sample_count(src_offset, dst_sample_count, step_fixed, 1);
+
+    scalar.linear(src, prev_src, dst, src_offset, head, step_fixed);
+
+    const auto frac_scale   = _mm256_set1_ps(1.0f / float(s_fixpoint_frac_mul));
+    const auto lane_offsets = step_lane_offsets(step_fixed);
+
+    auto i   = head;
+    auto pos = src_offset + (head * step_fixed);
+
+    for (; i + 8 <= dst_sample_count; i += 8, pos += 8 * step_fixed)
+    {
+        const auto positions = positions8(pos, lane_offsets);
+
+        const auto s1 = gather8<IsUnitStep>(src, positions, 1);
+        const auto s2 = gather8<IsUnitStep>(src, positions, 0);
+        const auto ds = _mm256_mul_ps(_mm256_sub_ps(s2, s1), positions.frac);
+
+        _mm256_storeu_ps(dst + i, _mm256_add_ps(s1, _mm256_mul_ps(ds, frac_scale)));
+    }
+
+    scalar.linear(src, prev_src, dst + i, pos, dst_sample_count - i, step_fixed);
+}
+
+void resample_point8(const float* src,
+                     const float* prev_src,
+                     float*       dst,
+                     size_t       src_offset,
+                     size_t       dst_sample_count,
+                     size_t       step_fixed)
+{
+    const auto& scalar = scalar_resample_kernels();
+
+    if (step_fixed == s_fixpoint_frac_mul)
+    {
+        // A plain copy, which the scalar kernel already does.
+        scalar.point(src, prev_src, dst, src_offset, dst_sample_count, step_fixed);
+        return;
+    }
+
+    const auto lane_offsets = step_lane_offsets(step_fixed);
+
+    auto i   = size_t(0);
+    auto pos = src_offset;
+
+    for (; i + 8 <= dst_sample_count; i += 8, pos += 8 * step_fixed)
+    {
+        _mm256_storeu_ps(dst + i, gather8<false>(src, positions8(pos, lane_offsets), 0));
+    }
+
+    scalar.point(src, prev_src, dst + i, pos, dst_sample_count - i, step_fixed);
+}
+
+template <auto Kernel, auto UnitStepKernel>
+void dispatch_unit_step(const float* src,
+                        const float* prev_src,
+                        float*       dst,
+                        size_t       src_offset,
+                        size_t       dst_sample_count,
+                        size_t       step_fixed)
+{
+    if (step_fixed == s_fixpoint_frac_mul)
+    {
+        UnitStepKernel(src, prev_src, dst, src_offset, dst_sample_count, step_fixed);
+    }
+    else
+    {
+        Kernel(src, prev_src, dst, src_offset, dst_sample_count, step_fixed);
+    }
+}
+} // namespace
+
+auto avx2_resample_kernels() -> const ResampleKernels&
+{
+    static constexpr auto kernels = ResampleKernels{
+        .name   = "AVX2",
+        .point  = resample_point8,
+        .linear = dispatch_unit_step<resample_linear8<false>, resample_linear8<true>>,
+        .catmull_rom =
+            dispatch_unit_step<resample_catmull_rom8<false>, resample_catmull_rom8<true>>,
+    };
+
+    return kernels;
+}
+} // namespace cer::details
+
+#endif
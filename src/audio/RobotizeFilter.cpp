@@ -53,6 +53,6 @@ void RobotizeFilterInstance::filter_channel(const FilterChannelArgs& args)
 
 auto RobotizeFilter::create_instance() -> std::shared_ptr<FilterInstance>
 {
-    return std::make_shared<RobotizeFilterInstance>(this);
+    return make_pooled_instance<RobotizeFilterInstance>(instance_pool, this);
 }
 } // namespace cer
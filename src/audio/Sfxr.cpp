@@ -592,6 +592,6 @@ Sfxr::~Sfxr()
 
 auto Sfxr::create_instance() -> std::shared_ptr<AudioSourceInstance>
 {
-    return std::make_shared<SfxrInstance>(this);
+    return make_pooled_instance<SfxrInstance>(instance_pool, this);
 }
 }; // namespace cer
\ No newline at end of file
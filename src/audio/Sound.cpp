@@ -13,21 +13,21 @@ namespace cer
 {
 CERLIB_IMPLEMENT_OBJECT(Sound);
 
-Sound::Sound(std::span<const std::byte> data)
+Sound::Sound(std::span<const std::byte> data, const SoundLoadOptions& options)
     : m_impl(nullptr)
 {
     auto& audio_device = details::GameImpl::instance().audio_device();
 
-    auto impl = std::make_unique<details::SoundImpl>(audio_device, data);
+    auto impl = std::make_unique<details::SoundImpl>(audio_device, data, options);
 
     set_impl(*this, impl.release());
 }
 
-Sound::Sound(std::string_view asset_name)
+Sound::Sound(std::string_view asset_name, const SoundLoadOptions& options)
     : m_impl(nullptr)
 {
     auto& content = details::GameImpl::instance().content_manager();
-    *this         = content.load_sound(asset_name);
+    *this         = content.load_sound(asset_name, options);
 }
 
 void Sound::stop()
@@ -9,21 +9,28 @@
 
 namespace cer::details
 {
-SoundImpl::SoundImpl(AudioDevice& audio_device, std::span<const std::byte> data)
+SoundImpl::SoundImpl(AudioDevice&               audio_device,
+                     std::span<const std::byte> data,
+                     const SoundLoadOptions&    options)
     : m_audio_device(&audio_device)
-    , m_data(std::make_unique<std::byte[]>(data.size()))
     , m_data_size(data.size())
 {
-    std::memcpy(m_data.get(), data.data(), data.size());
-    init_soloud_audio_source();
+    auto copy = std::make_unique<std::byte[]>(data.size());
+    std::memcpy(copy.get(), data.data(), data.size());
+    m_data = std::move(copy);
+
+    init_soloud_audio_source(options);
 }
 
-SoundImpl::SoundImpl(AudioDevice& audio_device, std::unique_ptr<std::byte[]> data, size_t data_size)
+SoundImpl::SoundImpl(AudioDevice&                       audio_device,
+                     std::shared_ptr<const std::byte[]> data,
+                     size_t                             data_size,
+                     const SoundLoadOptions&            options)
     : m_audio_device(&audio_device)
     , m_data(std::move(data))
     , m_data_size(data_size)
 {
-    init_soloud_audio_source();
+    init_soloud_audio_source(options);
 }
 
 SoundImpl::~SoundImpl() noexcept
@@ -36,13 +43,27 @@ void SoundImpl::stop()
     m_audio_device->stop_audio_source(*m_soloud_audio_source);
 }
 
+void SoundImpl::replace_contents(std::shared_ptr<const std::byte[]> data,
+                                 size_t                             data_size,
+                                 std::unique_ptr<AudioSource>       audio_source)
+{
+    stop();
+
+    m_soloud_audio_source = std::move(audio_source);
+    m_data                = std::move(data);
+    m_data_size           = data_size;
+}
+
 auto SoundImpl::audio_source() -> AudioSource&
 {
     return *m_soloud_audio_source;
 }
 
-void SoundImpl::init_soloud_audio_source()
+void SoundImpl::init_soloud_audio_source(const SoundLoadOptions& options)
 {
-    m_soloud_audio_source = std::make_unique<Wav>(std::span{m_data.get(), m_data_size});
+    m_soloud_audio_source =
+        std::make_unique<Wav>(std::span{m_data.get(), m_data_size},
+                              options,
+                              float(m_audio_device->backend_sample_rate()));
 }
 } // namespace cer::details
@@ -16,24 +16,34 @@ class SoundImpl final : public Object, public Asset
 {
   public:
     // Creates copy of data.
-    explicit SoundImpl(AudioDevice& audio_device, std::span<const std::byte> data);
+    explicit SoundImpl(AudioDevice&               audio_device,
+                       std::span<const std::byte> data,
+                       const SoundLoadOptions&    options = {});
 
-    explicit SoundImpl(AudioDevice&                 audio_device,
-                       std::unique_ptr<std::byte[]> data,
-                       size_t                       data_size);
+    // Keeps a reference to data, which may be a mapped file.
+    explicit SoundImpl(AudioDevice&                       audio_device,
+                       std::shared_ptr<const std::byte[]> data,
+                       size_t                             data_size,
+                       const SoundLoadOptions&            options = {});
 
     ~SoundImpl() noexcept override;
 
     void stop();
 
+    // Stops all playing instances of the sound and replaces its data and audio source,
+    // which was created from the data.
+    void replace_contents(std::shared_ptr<const std::byte[]> data,
+                          size_t                             data_size,
+                          std::unique_ptr<AudioSource>       audio_source);
+
     auto audio_source() -> AudioSource&;
 
   private:
-    void init_soloud_audio_source();
+    void init_soloud_audio_source(const SoundLoadOptions& options);
 
-    AudioDevice*                 m_audio_device = nullptr;
-    std::unique_ptr<std::byte[]> m_data;
-    size_t                       m_data_size{};
-    std::unique_ptr<AudioSource> m_soloud_audio_source;
+    AudioDevice*                       m_audio_device = nullptr;
+    std::shared_ptr<const std::byte[]> m_data;
+    size_t                             m_data_size{};
+    std::unique_ptr<AudioSource>       m_soloud_audio_source;
 };
 } // namespace cer::details
@@ -0,0 +1,80 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <cerlib/CopyMoveMacros.hpp>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+namespace cer
+{
+// Bounded, lock-free queue with a single producer and a single consumer.
+//
+// Neither side ever blocks: try_push() fails when the queue is full and try_pop() fails
+// when it's empty. Several threads may act as the consumer (or producer), as long as they
+// are serialized by some other means, e.g. a mutex.
+template <typename T, size_t Capacity>
+class SpscQueue
+{
+    static_assert(std::has_single_bit(Capacity), "capacity must be a power of two");
+
+  public:
+    SpscQueue() = default;
+
+    forbid_copy_and_move(SpscQueue);
+
+    ~SpscQueue() noexcept = default;
+
+    // Called by the producer.
+    auto try_push(T&& value) -> bool
+    {
+        const auto head = m_head.load(std::memory_order_relaxed);
+
+        if (head - m_tail.load(std::memory_order_acquire) == Capacity)
+        {
+            return false;
+        }
+
+        m_items[head & (Capacity - 1)] = std::move(value);
+        m_head.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    // Called by the consumer.
+    auto try_pop() -> std::optional<T>
+    {
+        const auto tail = m_tail.load(std::memory_order_relaxed);
+
+        if (tail == m_head.load(std::memory_order_acquire))
+        {
+            return std::nullopt;
+        }
+
+        auto value = std::move(m_items[tail & (Capacity - 1)]);
+        m_tail.store(tail + 1, std::memory_order_release);
+
+        return value;
+    }
+
+    // Approximate when called concurrently with push or pop.
+    auto is_empty() const -> bool
+    {
+        return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+    }
+
+  private:
+    static constexpr auto cache_line_size = size_t(64);
+
+    // Head and tail live on separate cache lines so that producer and consumer don't
+    // invalidate each other's line on every operation.
+    alignas(cache_line_size) std::atomic<size_t> m_head{};
+    alignas(cache_line_size) std::atomic<size_t> m_tail{};
+    std::unique_ptr<T[]> m_items = std::make_unique<T[]>(Capacity);
+};
+} // namespace cer
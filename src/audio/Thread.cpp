@@ -233,13 +233,17 @@ static void pool_worker(void* param)
 {
     auto* my_pool = static_cast<Pool*>(param);
 
-    while (my_pool->m_running)
+    while (true)
     {
-        if (PoolTask* t = my_pool->get_work(); t == nullptr)
+        my_pool->m_work_available.acquire();
+
+        if (!my_pool->m_running)
         {
-            sleep(1);
+            break;
         }
-        else
+
+        // Other threads may have taken the task in the meantime.
+        if (PoolTask* t = my_pool->get_work())
         {
             t->work();
         }
@@ -249,6 +253,7 @@ static void pool_worker(void* param)
 Pool::~Pool()
 {
     m_running = 0;
+    m_work_available.release(std::ptrdiff_t(m_thread_count));
 
     for (size_t i = 0; i < m_thread_count; ++i)
     {
@@ -305,6 +310,7 @@ void Pool::add_work(PoolTask* aTask)
             m_max_task++;
             if (m_work_mutex)
                 unlock_mutex(m_work_mutex);
+            m_work_available.release();
         }
     }
 }
@@ -25,6 +25,7 @@ freely, subject to the following restrictions:
 #pragma once
 
 #include <array>
+#include <semaphore>
 
 // TODO: replace this entire file by std::jthread and std::mutex
 
@@ -88,5 +89,9 @@ class Pool
     size_t                                      m_max_task   = 0; // how many tasks are pending
     int          m_robin   = 0; // cyclic counter, used to pick jobs for threads
     volatile int m_running = 0; // running flag, used to flag threads to stop
+
+    // Released once per queued task and once per thread on shutdown. Idle threads block
+    // on it instead of polling for work.
+    std::counting_semaphore<> m_work_available{0};
 };
 } // namespace cer::thread
@@ -23,13 +23,17 @@ freely, subject to the following restrictions:
 */
 
 #include "audio/Wav.hpp"
+#include "audio/Adpcm.hpp"
 #include "audio/Common.hpp"
+#include "audio/Resampler.hpp"
 #include "dr_flac.h"
 #include "dr_mp3.h"
 #include "dr_wav.h"
 #include "stb_vorbis.hpp"
 #include "util/MemoryReader.hpp"
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <cstring>
 
 #define MAKEDWORD(a, b, c, d) (((d) << 24) | ((c) << 16) | ((b) << 8) | (a))
@@ -44,7 +48,8 @@ WavInstance::WavInstance(Wav* aParent)
 
 auto WavInstance::audio(float* buffer, size_t samples_to_read, size_t buffer_size) -> size_t
 {
-    if (m_parent->m_data == nullptr)
+    if (m_parent->m_data == nullptr && m_parent->m_int16_data == nullptr &&
+        m_parent->m_adpcm_data == nullptr)
     {
         return 0;
     }
@@ -52,11 +57,32 @@ auto WavInstance::audio(float* buffer, size_t samples_to_read, size_t buffer_siz
     const auto data_left   = m_parent->m_sample_count - m_offset;
     const auto copy_length = std::min(data_left, samples_to_read);
 
+    if (m_parent->m_adpcm_data != nullptr)
+    {
+        decode_adpcm(buffer, copy_length, buffer_size);
+        m_offset += copy_length;
+
+        return copy_length;
+    }
+
     for (size_t i = 0; i < channel_count; ++i)
     {
-        memcpy(buffer + (i * buffer_size),
-               m_parent->m_data.get() + m_offset + (i * m_parent->m_sample_count),
-               sizeof(float) * copy_length);
+        auto*      dst        = buffer + (i * buffer_size);
+        const auto src_offset = m_offset + (i * m_parent->m_sample_count);
+
+        if (m_parent->m_int16_data != nullptr)
+        {
+            const auto* src = m_parent->m_int16_data.get() + src_offset;
+
+            for (size_t j = 0; j < copy_length; ++j)
+            {
+                dst[j] = float(src[j]) * (1.0f / 32767.0f);
+            }
+        }
+        else
+        {
+            memcpy(dst, m_parent->m_data.get() + src_offset, sizeof(float) * copy_length);
+        }
     }
 
     m_offset += copy_length;
@@ -64,6 +90,64 @@ auto WavInstance::audio(float* buffer, size_t samples_to_read, size_t buffer_siz
     return copy_length;
 }
 
+void WavInstance::decode_adpcm(float* buffer, size_t sample_count, size_t buffer_size)
+{
+    using details::adpcm_block_sample_count;
+    using details::adpcm_block_size;
+
+    const auto block_count = details::adpcm_block_count(m_parent->m_sample_count);
+
+    auto written = size_t(0);
+
+    while (written < sample_count)
+    {
+        const auto pos          = m_offset + written;
+        const auto block_index  = pos / adpcm_block_sample_count;
+        const auto block_offset = pos % adpcm_block_sample_count;
+        const auto count =
+            std::min(adpcm_block_sample_count - block_offset, sample_count - written);
+
+        const auto block_of_channel = [&](size_t channel) {
+            return m_parent->m_adpcm_data.get() +
+                   (((channel * block_count) + block_index) * adpcm_block_size);
+        };
+
+        if (count == adpcm_block_sample_count)
+        {
+            // The whole block is needed, so decode it straight into the buffer.
+            for (size_t ch = 0; ch < channel_count; ++ch)
+            {
+                details::adpcm_decode_block(block_of_channel(ch),
+                                            buffer + (ch * buffer_size) + written);
+            }
+        }
+        else
+        {
+            if (block_index != m_decoded_block_index)
+            {
+                for (size_t ch = 0; ch < channel_count; ++ch)
+                {
+                    details::adpcm_decode_block(
+                        block_of_channel(ch),
+                        m_decoded_block.data() + (ch * adpcm_block_sample_count));
+                }
+
+                m_decoded_block_index = block_index;
+            }
+
+            for (size_t ch = 0; ch < channel_count; ++ch)
+            {
+                std::memcpy(buffer + (ch * buffer_size) + written,
+                            m_decoded_block.data() + (ch * adpcm_block_sample_count) +
+                                block_offset,
+                            count * sizeof(float));
+            }
+        }
+
+        written += count;
+    }
+}
+
 auto WavInstance::rewind() -> bool
 {
     m_offset        = 0;
@@ -76,7 +160,9 @@ auto WavInstance::has_ended() -> bool
     return !flags.loops && m_offset >= m_parent->m_sample_count;
 }
 
-Wav::Wav(std::span<const std::byte> data)
+Wav::Wav(std::span<const std::byte> data,
+         const SoundLoadOptions&    options,
+         float                      device_sample_rate)
 {
     assert(data.data() != nullptr);
     assert(!data.empty());
@@ -92,6 +178,24 @@ Wav::Wav(std::span<const std::byte> data)
         case MAKEDWORD('f', 'L', 'a', 'C'): load_flac(dr); break;
         default: load_mp3(dr); break;
     }
+
+    // Work that would otherwise be repeated in every mix is done once here.
+    if (options.downmix_to_mono)
+    {
+        downmix_to_mono();
+    }
+
+    if (options.resample_to_device_rate)
+    {
+        resample(device_sample_rate);
+    }
+
+    switch (options.sample_format)
+    {
+        case SoundSampleFormat::Int16: convert_to_int16(); break;
+        case SoundSampleFormat::Adpcm: convert_to_adpcm(); break;
+        default: break;
+    }
 }
 
 Wav::~Wav()
@@ -272,11 +376,118 @@ void Wav::load_flac(const MemoryReader& reader)
 
 auto Wav::create_instance() -> std::shared_ptr<AudioSourceInstance>
 {
-    return std::make_shared<WavInstance>(this);
+    return make_pooled_instance<WavInstance>(instance_pool, this);
 }
 
 auto Wav::length_time() const -> double
 {
     return base_sample_rate == 0 ? 0 : m_sample_count / base_sample_rate;
 }
+
+auto Wav::sample_data_size() const -> size_t
+{
+    if (m_adpcm_data != nullptr)
+    {
+        return details::adpcm_block_count(m_sample_count) * channel_count *
+               details::adpcm_block_size;
+    }
+
+    const auto sample_size = m_int16_data != nullptr ? sizeof(int16_t) : sizeof(float);
+
+    return m_sample_count * channel_count * sample_size;
+}
+
+void Wav::downmix_to_mono()
+{
+    if (channel_count <= 1)
+    {
+        return;
+    }
+
+    auto       mono  = std::make_unique<float[]>(m_sample_count);
+    const auto scale = 1.0f / float(channel_count);
+
+    for (size_t ch = 0; ch < channel_count; ++ch)
+    {
+        const auto* src = m_data.get() + (ch * m_sample_count);
+
+        for (size_t i = 0; i < m_sample_count; ++i)
+        {
+            mono[i] += src[i] * scale;
+        }
+    }
+
+    m_data        = std::move(mono);
+    channel_count = 1;
+}
+
+void Wav::resample(float sample_rate)
+{
+    if (sample_rate <= 0.0f || sample_rate == base_sample_rate || m_sample_count == 0)
+    {
+        return;
+    }
+
+    // Source samples per output sample
+    const auto step      = double(base_sample_rate) / double(sample_rate);
+    const auto new_count = size_t(std::ceil(double(m_sample_count) / step));
+    const auto last      = ptrdiff_t(m_sample_count) - 1;
+
+    auto new_data = std::make_unique<float[]>(new_count * channel_count);
+
+    for (size_t ch = 0; ch < channel_count; ++ch)
+    {
+        const auto* src = m_data.get() + (ch * m_sample_count);
+        auto*       dst = new_data.get() + (ch * new_count);
+
+        // Repeats the first and last sample beyond the edges.
+        const auto at = [src, last](ptrdiff_t index) {
+            return src[std::clamp(index, ptrdiff_t(0), last)];
+        };
+
+        for (size_t i = 0; i < new_count; ++i)
+        {
+            const auto pos = double(i) * step;
+            const auto p   = ptrdiff_t(pos);
+            const auto t   = float(pos - double(p));
+
+            dst[i] = details::catmull_rom(t, at(p - 1), at(p), at(p + 1), at(p + 2));
+        }
+    }
+
+    m_data           = std::move(new_data);
+    m_sample_count   = new_count;
+    base_sample_rate = sample_rate;
+}
+
+void Wav::convert_to_int16()
+{
+    const auto count = m_sample_count * channel_count;
+
+    m_int16_data = std::make_unique<int16_t[]>(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        m_int16_data[i] = int16_t(std::lrint(std::clamp(m_data[i], -1.0f, 1.0f) * 32767.0f));
+    }
+
+    m_data.reset();
+}
+
+void Wav::convert_to_adpcm()
+{
+    const auto channel_size =
+        details::adpcm_block_count(m_sample_count) * details::adpcm_block_size;
+
+    m_adpcm_data = std::make_unique<uint8_t[]>(channel_size * channel_count);
+
+    for (size_t ch = 0; ch < channel_count; ++ch)
+    {
+        details::adpcm_encode(m_data.get() + (ch * m_sample_count),
+                              m_sample_count,
+                              m_adpcm_data.get() + (ch * channel_size));
+    }
+
+    m_data.reset();
+}
 }; // namespace cer
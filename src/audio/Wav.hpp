@@ -24,7 +24,12 @@ freely, subject to the following restrictions:
 
 #pragma once
 
+#include "audio/Adpcm.hpp"
 #include "audio/AudioSource.hpp"
+#include "audio/Common.hpp"
+#include "cerlib/SoundTypes.hpp"
+#include <array>
+#include <cstdint>
 #include <span>
 
 struct stb_vorbis;
@@ -46,8 +51,19 @@ class WavInstance final : public AudioSourceInstance
     auto has_ended() -> bool override;
 
   private:
+    void decode_adpcm(float* buffer, size_t sample_count, size_t buffer_size);
+
     Wav*   m_parent = nullptr;
     size_t m_offset = 0;
+
+    // The ADPCM block that was decoded last, for all channels. Reads that don't cover a
+    // whole block are served from here, so that no block is decoded twice in a row.
+    // Stored inline, so that playing a sound doesn't allocate once the instance pool is
+    // warm.
+    using DecodedBlock = std::array<float, details::adpcm_block_sample_count * max_channels>;
+
+    DecodedBlock m_decoded_block{};
+    size_t       m_decoded_block_index = size_t(-1);
 };
 
 class Wav final : public AudioSource
@@ -55,7 +71,10 @@ class Wav final : public AudioSource
     friend WavInstance;
 
   public:
-    explicit Wav(std::span<const std::byte> data);
+    // device_sample_rate is only needed if options.resample_to_device_rate is set.
+    explicit Wav(std::span<const std::byte> data,
+                 const SoundLoadOptions&    options            = {},
+                 float                      device_sample_rate = 0.0f);
 
     ~Wav() override;
 
@@ -63,6 +82,9 @@ class Wav final : public AudioSource
 
     auto length_time() const -> SoundTime;
 
+    // Size of the decoded samples, in bytes.
+    auto sample_data_size() const -> size_t;
+
   private:
     void load_wav(const MemoryReader& reader);
 
@@ -72,7 +94,19 @@ class Wav final : public AudioSource
 
     void load_flac(const MemoryReader& reader);
 
-    std::unique_ptr<float[]> m_data;
-    size_t                   m_sample_count = 0;
+    void downmix_to_mono();
+
+    void resample(float sample_rate);
+
+    void convert_to_int16();
+
+    void convert_to_adpcm();
+
+    // Samples are stored per channel, one channel after the other. Only one of the
+    // arrays is used, depending on the sample format.
+    std::unique_ptr<float[]>   m_data;
+    std::unique_ptr<int16_t[]> m_int16_data;
+    std::unique_ptr<uint8_t[]> m_adpcm_data;
+    size_t                     m_sample_count = 0;
 };
 }; // namespace cer
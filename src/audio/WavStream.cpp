@@ -511,7 +511,7 @@ void WavStream::loadmp3(MemoryReader& fp)
 
 std::shared_ptr<AudioSourceInstance> WavStream::create_instance()
 {
-    return std::make_shared<WavStreamInstance>(this);
+    return make_pooled_instance<WavStreamInstance>(instance_pool, this);
 }
 
 double WavStream::getLength() const
@@ -60,6 +60,6 @@ void WaveShaperFilterInstance::filter_channel(const FilterChannelArgs& args)
 
 std::shared_ptr<FilterInstance> WaveShaperFilter::create_instance()
 {
-    return std::make_shared<WaveShaperFilterInstance>(this);
+    return make_pooled_instance<WaveShaperFilterInstance>(instance_pool, this);
 }
 } // namespace cer
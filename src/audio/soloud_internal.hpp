@@ -39,6 +39,8 @@ struct AudioBackendArgs
     size_t       channel_count = 2;
 };
 
+void audio_null_init(const AudioBackendArgs& args);
+
 void audio_sdl2_init(const AudioBackendArgs& args);
 
 void audio_sdl3_init(const AudioBackendArgs& args);
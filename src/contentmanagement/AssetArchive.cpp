@@ -0,0 +1,328 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "AssetArchive.hpp"
+
+#include "graphics/stb_image.hpp"
+#include "graphics/stb_image_write.hpp"
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <tuple>
+
+namespace cer::details
+{
+static constexpr auto s_magic   = std::array<char, 8>{'C', 'E', 'R', 'P', 'A', 'C', 'K', '\0'};
+static constexpr auto s_version = uint32_t(1);
+
+enum class Compression : uint32_t
+{
+    None    = 0,
+    Deflate = 1,
+};
+
+// All fields are little-endian, like on every platform that cerlib supports.
+struct Header
+{
+    std::array<char, 8> magic{};
+    uint32_t            version{};
+    uint32_t            entry_count{};
+    uint64_t            names_size{};
+};
+
+static_assert(sizeof(Header) == 24);
+
+static auto align(size_t value) -> size_t
+{
+    return (value + AssetArchive::s_alignment - 1) & ~(AssetArchive::s_alignment - 1);
+}
+
+[[noreturn]] static void throw_corrupt_archive()
+{
+    throw std::runtime_error{"The asset archive is corrupt."};
+}
+
+AssetArchive::AssetArchive(AssetData data)
+    : m_data(std::move(data))
+{
+    static_assert(sizeof(Entry) == 48);
+
+    const auto memory = m_data.as_span();
+
+    auto header = Header{};
+
+    if (memory.size() >= sizeof(Header))
+    {
+        std::memcpy(&header, memory.data(), sizeof(Header));
+    }
+
+    if (header.magic != s_magic)
+    {
+        throw std::runtime_error{"The data is not a cerlib asset archive."};
+    }
+
+    if (header.version != s_version)
+    {
+        throw std::runtime_error{
+            fmt::format("Unsupported asset archive version {}.", header.version)};
+    }
+
+    m_names_offset = sizeof(Header) + (uint64_t(header.entry_count) * sizeof(Entry));
+
+    if (m_names_offset > memory.size() || header.names_size > memory.size() - m_names_offset)
+    {
+        throw_corrupt_archive();
+    }
+
+    // The index is copied out of the file, because a mapped file doesn't guarantee the
+    // alignment of its contents.
+    m_entries.resize(header.entry_count);
+
+    std::memcpy(m_entries.data(),
+                memory.data() + sizeof(Header),
+                m_entries.size() * sizeof(Entry));
+
+    for (const auto& entry : m_entries)
+    {
+        const auto is_stored = entry.compression == uint32_t(Compression::None);
+
+        if (uint64_t(entry.name_offset) + entry.name_length > header.names_size ||
+            entry.offset > memory.size() || entry.stored_size > memory.size() - entry.offset ||
+            entry.compression > uint32_t(Compression::Deflate) ||
+            (is_stored && entry.stored_size != entry.size))
+        {
+            throw_corrupt_archive();
+        }
+    }
+
+    if (!std::ranges::is_sorted(m_entries, {}, &Entry::name_hash))
+    {
+        throw_corrupt_archive();
+    }
+}
+
+auto AssetArchive::find(std::string_view name) const -> std::optional<AssetData>
+{
+    const auto* entry = find_entry(name);
+
+    if (entry == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    const auto* stored_data = m_data.data.get() + entry->offset;
+
+    if (Compression(entry->compression) == Compression::None)
+    {
+        // Share the archive's memory instead of copying the entry.
+        return AssetData{
+            .data = std::shared_ptr<const std::byte[]>{m_data.data, stored_data},
+            .size = size_t(entry->size),
+        };
+    }
+
+    if (entry->size > uint64_t(INT_MAX) || entry->stored_size > uint64_t(INT_MAX))
+    {
+        throw_corrupt_archive();
+    }
+
+    auto       data         = std::make_unique<std::byte[]>(size_t(entry->size));
+    const auto decoded_size = stbi_zlib_decode_buffer(reinterpret_cast<char*>(data.get()),
+                                                      int(entry->size),
+                                                      reinterpret_cast<const char*>(stored_data),
+                                                      int(entry->stored_size));
+
+    if (decoded_size != int(entry->size))
+    {
+        throw std::runtime_error{
+            fmt::format("Failed to decompress asset '{}' from the asset archive.", name)};
+    }
+
+    return AssetData{
+        .data = std::move(data),
+        .size = size_t(entry->size),
+    };
+}
+
+auto AssetArchive::contains(std::string_view name) const -> bool
+{
+    return find_entry(name) != nullptr;
+}
+
+auto AssetArchive::entry_count() const -> size_t
+{
+    return m_entries.size();
+}
+
+auto AssetArchive::pack(std::span<const AssetArchiveFile> files, bool compress) -> List<std::byte>
+{
+    struct PackedFile
+    {
+        const AssetArchiveFile* file{};
+        Entry                   entry{};
+        List<std::byte>         compressed_data;
+    };
+
+    auto packed_files = List<PackedFile>();
+    packed_files.reserve(files.size());
+
+    for (const auto& file : files)
+    {
+        auto& packed = packed_files.emplace_back();
+
+        packed.file              = &file;
+        packed.entry.name_hash   = name_hash(file.name);
+        packed.entry.size        = file.data.size();
+        packed.entry.stored_size = file.data.size();
+
+        if (!compress || file.data.empty() || file.data.size() > size_t(INT_MAX))
+        {
+            continue;
+        }
+
+        // stb doesn't modify the data it compresses.
+        auto  compressed_size = 0;
+        auto* compressed      = stbi_zlib_compress(
+            const_cast<unsigned char*>(reinterpret_cast<const unsigned char*>(file.data.data())),
+            int(file.data.size()),
+            &compressed_size,
+            8);
+
+        if (compressed == nullptr)
+        {
+            continue;
+        }
+
+        defer
+        {
+            std::free(compressed);
+        };
+
+        // Stored entries are handed out without decompressing them, so compression has to
+        // be worth it.
+        if (size_t(compressed_size) < file.data.size() - (file.data.size() / 8))
+        {
+            const auto* compressed_begin = reinterpret_cast<const std::byte*>(compressed);
+
+            packed.compressed_data.assign(compressed_begin, compressed_begin + compressed_size);
+            packed.entry.compression = uint32_t(Compression::Deflate);
+            packed.entry.stored_size = uint64_t(compressed_size);
+        }
+    }
+
+    std::ranges::sort(packed_files, [](const PackedFile& lhs, const PackedFile& rhs) {
+        return std::tie(lhs.entry.name_hash, lhs.file->name) <
+               std::tie(rhs.entry.name_hash, rhs.file->name);
+    });
+
+    const auto have_same_name = [](const PackedFile& lhs, const PackedFile& rhs) {
+        return lhs.file->name == rhs.file->name;
+    };
+
+    if (const auto it = std::ranges::adjacent_find(packed_files, have_same_name);
+        it != packed_files.end())
+    {
+        throw std::invalid_argument{
+            fmt::format("The file '{}' was specified more than once.", it->file->name)};
+    }
+
+    // Lay out the names and the data.
+    auto names_size = size_t(0);
+
+    for (auto& packed : packed_files)
+    {
+        packed.entry.name_offset = uint32_t(names_size);
+        packed.entry.name_length = uint32_t(packed.file->name.size());
+        names_size += packed.file->name.size();
+    }
+
+    if (names_size > UINT32_MAX)
+    {
+        throw std::invalid_argument{"The names of the files are too long for an asset archive."};
+    }
+
+    const auto names_offset = sizeof(Header) + (packed_files.size() * sizeof(Entry));
+    auto       archive_size = names_offset + names_size;
+
+    for (auto& packed : packed_files)
+    {
+        packed.entry.offset = align(archive_size);
+        archive_size        = packed.entry.offset + packed.entry.stored_size;
+    }
+
+    // Write the archive.
+    auto archive = List<std::byte>(archive_size);
+
+    const auto header = Header{
+        .magic       = s_magic,
+        .version     = s_version,
+        .entry_count = uint32_t(packed_files.size()),
+        .names_size  = names_size,
+    };
+
+    std::memcpy(archive.data(), &header, sizeof(Header));
+
+    for (size_t i = 0; i < packed_files.size(); ++i)
+    {
+        const auto& packed = packed_files[i];
+        const auto& entry  = packed.entry;
+        const auto  data   = entry.compression == uint32_t(Compression::None)
+                                 ? packed.file->data
+                                 : std::span<const std::byte>{packed.compressed_data};
+
+        std::memcpy(archive.data() + sizeof(Header) + (i * sizeof(Entry)), &entry, sizeof(Entry));
+
+        std::memcpy(archive.data() + names_offset + entry.name_offset,
+                    packed.file->name.data(),
+                    entry.name_length);
+
+        if (!data.empty())
+        {
+            std::memcpy(archive.data() + entry.offset, data.data(), data.size());
+        }
+    }
+
+    return archive;
+}
+
+// FNV-1a, which is stable across platforms, unlike std::hash.
+auto AssetArchive::name_hash(std::string_view name) -> uint64_t
+{
+    auto hash = uint64_t(14695981039346656037ull);
+
+    for (const auto ch : name)
+    {
+        hash ^= uint64_t(uint8_t(ch));
+        hash *= uint64_t(1099511628211ull);
+    }
+
+    return hash;
+}
+
+auto AssetArchive::find_entry(std::string_view name) const -> const Entry*
+{
+    const auto hash = name_hash(name);
+
+    for (auto it = std::ranges::lower_bound(m_entries, hash, {}, &Entry::name_hash);
+         it != m_entries.end() && it->name_hash == hash;
+         ++it)
+    {
+        if (entry_name(*it) == name)
+        {
+            return &*it;
+        }
+    }
+
+    return nullptr;
+}
+
+auto AssetArchive::entry_name(const Entry& entry) const -> std::string_view
+{
+    return {reinterpret_cast<const char*>(m_data.data.get()) + m_names_offset + entry.name_offset,
+            entry.name_length};
+}
+} // namespace cer::details
@@ -0,0 +1,72 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include "cerlib/Content.hpp"
+#include <cerlib/List.hpp>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace cer::details
+{
+struct AssetArchiveFile
+{
+    std::string                name;
+    std::span<const std::byte> data;
+};
+
+// A cerlib asset archive (.cerpack), which is a single file that contains many assets.
+//
+// The file starts with a header, followed by an index of all entries that is sorted by the
+// hash of their names, the names themselves and finally the entries' data. Entries are either
+// stored as they are or deflate-compressed. Each entry's data starts at a multiple of
+// s_alignment, so that stored entries of a memory-mapped archive are handed out without
+// copying them.
+class AssetArchive final
+{
+  public:
+    static constexpr size_t s_alignment = 16;
+
+    explicit AssetArchive(AssetData data);
+
+    // Returns an empty optional if the archive doesn't contain the asset.
+    auto find(std::string_view name) const -> std::optional<AssetData>;
+
+    auto contains(std::string_view name) const -> bool;
+
+    auto entry_count() const -> size_t;
+
+    // Packs files into an archive. Files are compressed unless compress is false, or
+    // compression doesn't make them notably smaller, which is the case for formats that are
+    // already compressed, such as PNG or OGG.
+    static auto pack(std::span<const AssetArchiveFile> files, bool compress) -> List<std::byte>;
+
+    static auto name_hash(std::string_view name) -> uint64_t;
+
+  private:
+    struct Entry
+    {
+        uint64_t name_hash{};
+        uint64_t offset{};
+        uint64_t stored_size{};
+        uint64_t size{};
+        uint32_t name_offset{};
+        uint32_t name_length{};
+        uint32_t compression{};
+        uint32_t reserved{};
+    };
+
+    auto find_entry(std::string_view name) const -> const Entry*;
+
+    auto entry_name(const Entry& entry) const -> std::string_view;
+
+    AssetData   m_data;
+    uint64_t    m_names_offset{};
+    List<Entry> m_entries;
+};
+} // namespace cer::details
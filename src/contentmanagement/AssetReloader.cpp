@@ -0,0 +1,331 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "AssetReloader.hpp"
+
+#include "FileSystem.hpp"
+#include "audio/Wav.hpp"
+#include "cerlib/Logging.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <utility>
+
+#ifdef CERLIB_HAVE_ASSET_HOT_RELOADING
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace cer::details
+{
+#ifdef CERLIB_HAVE_ASSET_HOT_RELOADING
+using Clock = std::chrono::steady_clock;
+
+// How long a file must not have changed before it's reloaded.
+static constexpr auto s_settle_time = std::chrono::milliseconds{100};
+
+// How often the thread checks whether it should stop, or whether files have settled.
+static constexpr auto s_poll_interval_ms = 50;
+
+// Changed files are read instead of mapped, because they may be written again while
+// they're decoded.
+static auto read_file(const std::string& path) -> AssetData
+{
+    auto ifs = std::ifstream{path, std::ios::binary | std::ios::ate};
+
+    if (!ifs.is_open())
+    {
+        throw std::runtime_error{fmt::format("Failed to open file '{}' for reading.", path)};
+    }
+
+    const auto end = ifs.tellg();
+
+    if (end < 0)
+    {
+        throw std::runtime_error{fmt::format("Failed to determine the size of file '{}'.", path)};
+    }
+
+    const auto size = size_t(end);
+    auto       data = std::make_unique<std::byte[]>(size);
+
+    ifs.seekg(0, std::ios::beg);
+    ifs.read(reinterpret_cast<char*>(data.get()), std::streamsize(size));
+
+    if (!ifs)
+    {
+        throw std::runtime_error{fmt::format("Failed to read file '{}'.", path)};
+    }
+
+    return AssetData{
+        .data = std::move(data),
+        .size = size,
+    };
+}
+#endif
+
+AssetReloader::AssetReloader() = default;
+
+AssetReloader::~AssetReloader() noexcept
+{
+    set_enabled(false);
+}
+
+void AssetReloader::set_enabled(bool value)
+{
+    if (value == is_enabled())
+    {
+        return;
+    }
+
+#ifdef CERLIB_HAVE_ASSET_HOT_RELOADING
+    if (value)
+    {
+        m_inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+        if (m_inotify_fd == -1)
+        {
+            log_warning("Failed to start watching asset files for changes.");
+            return;
+        }
+
+        {
+            const auto lock = std::scoped_lock{m_mutex};
+
+            for (const auto& asset : m_assets)
+            {
+                watch_directory_of(asset.path);
+            }
+        }
+
+        m_should_stop = false;
+        m_thread      = std::thread{&AssetReloader::run, this};
+
+        log_verbose("[AssetReloader] Watching asset files for changes");
+    }
+    else
+    {
+        m_should_stop = true;
+        m_thread.join();
+
+        close(m_inotify_fd);
+        m_inotify_fd = -1;
+
+        const auto lock = std::scoped_lock{m_mutex};
+        m_watched_directories.clear();
+        m_reloaded_assets.clear();
+    }
+#else
+    log_warning("Hot reloading of assets is not supported on the current system.");
+#endif
+}
+
+auto AssetReloader::is_enabled() const -> bool
+{
+    return m_inotify_fd != -1;
+}
+
+void AssetReloader::add_asset(std::string_view key, std::string_view name, Source source)
+{
+    const auto lock = std::scoped_lock{m_mutex};
+
+    auto& asset = m_assets.emplace_back(WatchedAsset{
+        .key    = std::string{key},
+        .name   = std::string{name},
+        .path   = filesystem::asset_file_path(name),
+        .source = std::move(source),
+    });
+
+    if (is_enabled())
+    {
+        watch_directory_of(asset.path);
+    }
+}
+
+void AssetReloader::remove_asset(std::string_view key)
+{
+    const auto lock = std::scoped_lock{m_mutex};
+
+    const auto removed = std::ranges::remove(m_assets, key, &WatchedAsset::key);
+    m_assets.erase(removed.begin(), removed.end());
+}
+
+auto AssetReloader::take_reloaded_assets() -> List<ReloadedAsset>
+{
+    const auto lock = std::scoped_lock{m_mutex};
+
+    return std::exchange(m_reloaded_assets, {});
+}
+
+void AssetReloader::watch_directory_of([[maybe_unused]] std::string_view path)
+{
+#ifdef CERLIB_HAVE_ASSET_HOT_RELOADING
+    const auto slash     = path.rfind('/');
+    const auto directory = slash != std::string_view::npos ? std::string{path.substr(0, slash + 1)}
+                                                           : std::string{};
+
+    // Watching a directory again returns the same descriptor, so there's no need to check
+    // for directories that are already watched. Editors often save files by writing a new
+    // file and renaming it, which is why moves count as changes, too.
+    const auto wd = inotify_add_watch(m_inotify_fd,
+                                      directory.empty() ? "." : directory.c_str(),
+                                      IN_CLOSE_WRITE | IN_MOVED_TO);
+
+    if (wd == -1)
+    {
+        log_warning("Failed to watch directory '{}' for changes.", directory);
+        return;
+    }
+
+    m_watched_directories[wd] = directory;
+#endif
+}
+
+void AssetReloader::run()
+{
+#ifdef CERLIB_HAVE_ASSET_HOT_RELOADING
+    alignas(inotify_event) auto buffer = std::array<char, 4096>{};
+
+    // The time of the last change, by path.
+    auto changed_files = std::unordered_map<std::string, Clock::time_point>{};
+
+    while (!m_should_stop)
+    {
+        auto poll_fd = pollfd{
+            .fd      = m_inotify_fd,
+            .events  = POLLIN,
+            .revents = 0,
+        };
+
+        if (poll(&poll_fd, 1, s_poll_interval_ms) > 0)
+        {
+            auto length = ssize_t(0);
+
+            while ((length = read(m_inotify_fd, buffer.data(), buffer.size())) > 0)
+            {
+                const auto lock = std::scoped_lock{m_mutex};
+                const auto now  = Clock::now();
+
+                for (auto offset = ssize_t(0); offset < length;)
+                {
+                    const auto* event =
+                        reinterpret_cast<const inotify_event*>(buffer.data() + offset);
+
+                    offset += ssize_t(sizeof(inotify_event) + event->len);
+
+                    const auto it = m_watched_directories.find(event->wd);
+
+                    if (event->len == 0 || it == m_watched_directories.end())
+                    {
+                        continue;
+                    }
+
+                    auto path = it->second + event->name;
+
+                    if (std::ranges::find(m_assets, path, &WatchedAsset::path) != m_assets.end())
+                    {
+                        changed_files[std::move(path)] = now;
+                    }
+                }
+            }
+        }
+
+        const auto now = Clock::now();
+
+        for (auto it = changed_files.begin(); it != changed_files.end();)
+        {
+            if (now - it->second < s_settle_time)
+            {
+                ++it;
+                continue;
+            }
+
+            reload_file(it->first);
+            it = changed_files.erase(it);
+        }
+    }
+#endif
+}
+
+void AssetReloader::reload_file([[maybe_unused]] const std::string& path)
+{
+#ifdef CERLIB_HAVE_ASSET_HOT_RELOADING
+    auto assets = List<WatchedAsset>{};
+
+    {
+        const auto lock = std::scoped_lock{m_mutex};
+
+        for (const auto& asset : m_assets)
+        {
+            if (asset.path == path)
+            {
+                assets.push_back(asset);
+            }
+        }
+    }
+
+    auto data = AssetData{};
+
+    try
+    {
+        data = read_file(path);
+    }
+    catch (const std::exception& ex)
+    {
+        log_warning("Failed to reload file '{}': {}", path, ex.what());
+        return;
+    }
+
+    auto reloaded_assets = List<ReloadedAsset>{};
+
+    for (const auto& asset : assets)
+    {
+        try
+        {
+            if (const auto* image = std::get_if<ImageSource>(&asset.source))
+            {
+                auto decoded_image = decode_image(data.as_span(), image->options);
+
+                reloaded_assets.push_back(ReloadedAsset{
+                    .key      = asset.key,
+                    .name     = asset.name,
+                    .contents = ReloadedImage{data, std::move(decoded_image)},
+                });
+            }
+            else if (const auto* sound = std::get_if<SoundSource>(&asset.source))
+            {
+                auto audio_source =
+                    std::make_unique<Wav>(data.as_span(), sound->options, sound->sample_rate);
+
+                reloaded_assets.push_back(ReloadedAsset{
+                    .key      = asset.key,
+                    .name     = asset.name,
+                    .contents = ReloadedSound{data, std::move(audio_source)},
+                });
+            }
+            else
+            {
+                reloaded_assets.push_back(ReloadedAsset{
+                    .key      = asset.key,
+                    .name     = asset.name,
+                    .contents = ReloadedShader{std::string{data.as_string_view()}},
+                });
+            }
+        }
+        catch (const std::exception& ex)
+        {
+            log_warning("Failed to reload asset '{}': {}", asset.name, ex.what());
+        }
+    }
+
+    const auto lock = std::scoped_lock{m_mutex};
+
+    for (auto& reloaded : reloaded_assets)
+    {
+        m_reloaded_assets.push_back(std::move(reloaded));
+    }
+#endif
+}
+} // namespace cer::details
@@ -0,0 +1,129 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include "ImageLoading.hpp"
+#include "audio/AudioSource.hpp"
+#include "cerlib/Content.hpp"
+#include "cerlib/Image.hpp"
+#include "cerlib/SoundTypes.hpp"
+#include <atomic>
+#include <cerlib/CopyMoveMacros.hpp>
+#include <cerlib/List.hpp>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <variant>
+
+#if defined(__linux__) && !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+#define CERLIB_HAVE_ASSET_HOT_RELOADING
+#endif
+
+namespace cer::details
+{
+// Reloads assets whose files have changed, so that changes show up without restarting
+// the game.
+//
+// A background thread watches the directories of the assets' files. Because editors tend
+// to write files in several steps, it waits until a file hasn't changed for a while before
+// it decodes the assets that were loaded from it. The content manager then swaps the
+// decoded assets into the loaded ones on the main thread, which keeps existing references
+// to them valid.
+//
+// Files are watched using inotify, which is why only Linux is supported.
+class AssetReloader final
+{
+  public:
+    struct ImageSource
+    {
+        ImageLoadOptions options;
+    };
+
+    struct SoundSource
+    {
+        SoundLoadOptions options;
+        float            sample_rate{};
+    };
+
+    struct ShaderSource
+    {
+    };
+
+    // How an asset is decoded again.
+    using Source = std::variant<ImageSource, SoundSource, ShaderSource>;
+
+    struct ReloadedImage
+    {
+        AssetData    data;
+        DecodedImage image;
+    };
+
+    struct ReloadedSound
+    {
+        AssetData                    data;
+        std::unique_ptr<AudioSource> audio_source;
+    };
+
+    struct ReloadedShader
+    {
+        std::string source_code;
+    };
+
+    struct ReloadedAsset
+    {
+        std::string                                                key;
+        std::string                                                name;
+        std::variant<ReloadedImage, ReloadedSound, ReloadedShader> contents;
+    };
+
+    AssetReloader();
+
+    forbid_copy_and_move(AssetReloader);
+
+    ~AssetReloader() noexcept;
+
+    void set_enabled(bool value);
+
+    auto is_enabled() const -> bool;
+
+    // Registers an asset that was loaded from a file. The key is the asset's key in the
+    // content manager, while the name is the name that its file was loaded by.
+    void add_asset(std::string_view key, std::string_view name, Source source);
+
+    void remove_asset(std::string_view key);
+
+    // Returns the assets that were decoded since the last call.
+    auto take_reloaded_assets() -> List<ReloadedAsset>;
+
+  private:
+    struct WatchedAsset
+    {
+        std::string key;
+        std::string name;
+        std::string path;
+        Source      source;
+    };
+
+    void watch_directory_of(std::string_view path);
+
+    void run();
+
+    void reload_file(const std::string& path);
+
+    std::mutex          m_mutex;
+    List<WatchedAsset>  m_assets;
+    List<ReloadedAsset> m_reloaded_assets;
+    int                 m_inotify_fd{-1};
+
+#ifdef CERLIB_HAVE_ASSET_HOT_RELOADING
+    std::unordered_map<int, std::string> m_watched_directories;
+    std::atomic<bool>                    m_should_stop{};
+    std::thread                          m_thread;
+#endif
+};
+} // namespace cer::details
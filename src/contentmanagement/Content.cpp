@@ -43,6 +43,30 @@ auto cer::asset_loading_prefix() -> std::string
     return std::string{content.asset_loading_prefix()};
 }
 
+void cer::mount_asset_archive(std::string_view filename)
+{
+    LOAD_CONTENT_MANAGER;
+    content.mount_asset_archive(filename);
+}
+
+void cer::unmount_asset_archive(std::string_view filename)
+{
+    LOAD_CONTENT_MANAGER;
+    content.unmount_asset_archive(filename);
+}
+
+void cer::set_asset_hot_reloading_enabled(bool value)
+{
+    LOAD_CONTENT_MANAGER;
+    content.set_hot_reloading_enabled(value);
+}
+
+auto cer::is_asset_hot_reloading_enabled() -> bool
+{
+    LOAD_CONTENT_MANAGER;
+    return content.is_hot_reloading_enabled();
+}
+
 void cer::register_custom_asset_loader(std::string_view type_id, CustomAssetLoadFunc load_func)
 {
     LOAD_CONTENT_MANAGER;
@@ -15,6 +15,7 @@
 #include "cerlib/Sound.hpp"
 #include "game/GameImpl.hpp"
 #include "graphics/FontImpl.hpp"
+#include "graphics/GraphicsDevice.hpp"
 #include "graphics/ImageImpl.hpp"
 #include "graphics/ShaderImpl.hpp"
 #include "util/Platform.hpp"
@@ -132,16 +133,99 @@ auto ContentManager::asset_loading_prefix() const -> std::string_view
     return m_asset_loading_prefix;
 }
 
-auto ContentManager::load_image(std::string_view name) -> Image
+void ContentManager::mount_asset_archive(std::string_view filename)
 {
-    const auto key = std::string{name};
+    if (std::ranges::find(m_mounted_archives, filename, &MountedArchive::filename) !=
+        m_mounted_archives.end())
+    {
+        throw std::invalid_argument{
+            fmt::format("The asset archive '{}' is already mounted.", filename)};
+    }
+
+    auto archive = AssetArchive{filesystem::load_asset_data(filename)};
+
+    log_verbose("[ContentManager] Mounted asset archive '{}' with {} entries",
+                filename,
+                archive.entry_count());
+
+    // Archives that are mounted later take precedence.
+    m_mounted_archives.insert(m_mounted_archives.begin(),
+                              MountedArchive{
+                                  .filename = std::string{filename},
+                                  .archive  = std::move(archive),
+                              });
+}
+
+void ContentManager::unmount_asset_archive(std::string_view filename)
+{
+    const auto it = std::ranges::find(m_mounted_archives, filename, &MountedArchive::filename);
+
+    if (it == m_mounted_archives.end())
+    {
+        throw std::invalid_argument{
+            fmt::format("The asset archive '{}' is not mounted.", filename)};
+    }
+
+    // Assets that were loaded from the archive keep their data alive.
+    m_mounted_archives.erase(it);
+}
+
+auto ContentManager::load_asset_data(std::string_view name) const -> AssetData
+{
+    for (const auto& mounted : m_mounted_archives)
+    {
+        if (auto data = mounted.archive.find(name))
+        {
+            return std::move(*data);
+        }
+    }
+
+    return filesystem::load_asset_data(name);
+}
 
-    return lazy_load<Image, ImageImpl>(key, name, [](std::string_view name) {
-        const auto data  = filesystem::load_asset_data(name);
-        auto       image = Image{data.as_span()};
-        image.set_name(name);
-        return image;
+void ContentManager::watch_asset(std::string_view      key,
+                                 std::string_view      name,
+                                 AssetReloader::Source source)
+{
+    const auto is_in_archive = std::ranges::any_of(m_mounted_archives, [name](const auto& mounted) {
+        return mounted.archive.contains(name);
     });
+
+    if (!is_in_archive)
+    {
+        m_asset_reloader.add_asset(m_asset_loading_prefix + std::string{key},
+                                   name,
+                                   std::move(source));
+    }
+}
+
+static auto build_image_key(std::string_view asset_name, const ImageLoadOptions& options)
+    -> std::string
+{
+    auto key = std::string{asset_name};
+
+    if (options != ImageLoadOptions{})
+    {
+        key += fmt::format("|{}", options.generate_mipmaps);
+    }
+
+    return key;
+}
+
+auto ContentManager::load_image(std::string_view name, const ImageLoadOptions& options) -> Image
+{
+    const auto key = build_image_key(name, options);
+
+    return lazy_load<Image, ImageImpl>(
+        key,
+        name,
+        [this, &options](std::string_view name) {
+            const auto data  = load_asset_data(name);
+            auto       image = Image{data.as_span(), options};
+            image.set_name(name);
+            return image;
+        },
+        AssetReloader::ImageSource{options});
 }
 
 static auto build_shader_key(std::string_view asset_name, std::span<const std::string_view> defines)
@@ -164,40 +248,75 @@ auto ContentManager::load_shader(std::string_view
 {
     const auto key = std::string{build_shader_key(name, defines)};
 
-    return lazy_load<Shader, ShaderImpl>(key, name, [](std::string_view full_name) {
-        const auto data   = filesystem::load_asset_data(full_name);
-        auto       shader = Shader{full_name, data.as_string_view()};
-        shader.set_name(full_name);
-        return shader;
-    });
+    return lazy_load<Shader, ShaderImpl>(
+        key,
+        name,
+        [this](std::string_view full_name) {
+            const auto data   = load_asset_data(full_name);
+            auto       shader = Shader{full_name, data.as_string_view()};
+            shader.set_name(full_name);
+            return shader;
+        },
+        AssetReloader::ShaderSource{});
 }
 
 auto ContentManager::load_font(std::string_view name) -> Font
 {
-    return lazy_load<Font, FontImpl>(name, name, [](std::string_view full_name) {
-        auto data      = filesystem::load_asset_data(full_name);
+    return lazy_load<Font, FontImpl>(name, name, [this](std::string_view full_name) {
+        auto data      = filesystem::detach_asset_data(load_asset_data(full_name));
         auto font_impl = std::make_unique<FontImpl>(std::move(data.data));
 
         return Font{font_impl.release()};
     });
 }
 
-auto ContentManager::load_sound(std::string_view name) -> Sound
+static auto build_sound_key(std::string_view asset_name, const SoundLoadOptions& options)
+    -> std::string
 {
-    return lazy_load<Sound, SoundImpl>(name, name, [](std::string_view full_name) {
-        if (!is_audio_device_initialized())
-        {
-            return Sound{};
-        }
+    auto key = std::string{asset_name};
 
-        auto& audio_device = GameImpl::instance().audio_device();
-        auto  data         = filesystem::load_asset_data(full_name);
+    if (options != SoundLoadOptions{})
+    {
+        key += fmt::format("|{}|{}|{}",
+                           options.resample_to_device_rate,
+                           int(options.sample_format),
+                           options.downmix_to_mono);
+    }
 
-        auto sound_impl =
-            std::make_unique<SoundImpl>(audio_device, std::move(data.data), data.size);
+    return key;
+}
 
-        return Sound{sound_impl.release()};
-    });
+auto ContentManager::load_sound(std::string_view name, const SoundLoadOptions& options) -> Sound
+{
+    const auto key = build_sound_key(name, options);
+
+    // Without an audio device, sounds are loaded as empty sounds, which aren't watched.
+    auto* audio_device =
+        is_audio_device_initialized() ? &GameImpl::instance().audio_device() : nullptr;
+
+    return lazy_load<Sound, SoundImpl>(
+        key,
+        name,
+        [&](std::string_view full_name) {
+            if (audio_device == nullptr)
+            {
+                return Sound{};
+            }
+
+            auto data = filesystem::detach_asset_data(load_asset_data(full_name));
+
+            auto sound_impl = std::make_unique<SoundImpl>(*audio_device,
+                                                          std::move(data.data),
+                                                          data.size,
+                                                          options);
+
+            return Sound{sound_impl.release()};
+        },
+        AssetReloader::SoundSource{
+            .options     = options,
+            .sample_rate = audio_device != nullptr ? float(audio_device->backend_sample_rate())
+                                                   : 0.0f,
+        });
 }
 
 auto ContentManager::load_custom_asset(std::string_view type_id,
@@ -248,7 +367,7 @@ auto ContentManager::load_custom_asset(std::string_view type_id,
     }
 
     // Load the asset as a shared_ptr.
-    auto file_data = filesystem::load_asset_data(key_str);
+    auto file_data = load_asset_data(key_str);
     auto asset     = it_load_func->second(name, file_data, extra_info);
 
     asset->m_content_manager = this;
@@ -294,5 +413,74 @@ void ContentManager::notify_asset_destroyed(std::string_view name)
 {
     log_verbose("[ContentManager] Removing asset '{}'", name);
     m_loaded_assets.erase(std::string{name});
+    m_asset_reloader.remove_asset(name);
+}
+
+void ContentManager::set_hot_reloading_enabled(bool value)
+{
+    m_asset_reloader.set_enabled(value);
+}
+
+auto ContentManager::is_hot_reloading_enabled() const -> bool
+{
+    return m_asset_reloader.is_enabled();
+}
+
+void ContentManager::apply_reloaded_assets()
+{
+    if (!m_asset_reloader.is_enabled())
+    {
+        return;
+    }
+
+    for (auto& reloaded : m_asset_reloader.take_reloaded_assets())
+    {
+        const auto it = m_loaded_assets.find(reloaded.key);
+
+        if (it == m_loaded_assets.end())
+        {
+            continue;
+        }
+
+        try
+        {
+            if (const auto* image = std::get_if<AssetReloader::ReloadedImage>(&reloaded.contents))
+            {
+                auto*       image_impl = std::get<ImageImpl*>(it->second);
+                const auto& decoded    = image->image;
+
+                image_impl->parent_device().replace_image_contents(*image_impl,
+                                                                   decoded.width,
+                                                                   decoded.height,
+                                                                   decoded.format,
+                                                                   decoded.mipmaps());
+            }
+            else if (auto* sound = std::get_if<AssetReloader::ReloadedSound>(&reloaded.contents))
+            {
+                std::get<SoundImpl*>(it->second)
+                    ->replace_contents(std::move(sound->data.data),
+                                       sound->data.size,
+                                       std::move(sound->audio_source));
+            }
+            else if (const auto* shader =
+                         std::get_if<AssetReloader::ReloadedShader>(&reloaded.contents))
+            {
+                auto* shader_impl = std::get<ShaderImpl*>(it->second);
+
+                const auto new_shader =
+                    shader_impl->parent_device().demand_create_shader(reloaded.name,
+                                                                      shader->source_code,
+                                                                      {});
+
+                shader_impl->take_contents_of(*new_shader);
+            }
+
+            log_info("Reloaded asset '{}'", reloaded.key);
+        }
+        catch (const std::exception& ex)
+        {
+            log_warning("Failed to reload asset '{}': {}", reloaded.key, ex.what());
+        }
+    }
 }
 } // namespace cer::details
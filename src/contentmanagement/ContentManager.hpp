@@ -4,12 +4,16 @@
 
 #pragma once
 
+#include "AssetArchive.hpp"
+#include "AssetReloader.hpp"
 #include "cerlib/Content.hpp"
 #include "cerlib/Logging.hpp"
 #include "cerlib/Shader.hpp"
+#include "cerlib/SoundTypes.hpp"
 #include "graphics/ShaderImpl.hpp"
 #include "util/StringUnorderedMap.hpp"
 #include <cerlib/CopyMoveMacros.hpp>
+#include <optional>
 #include <span>
 #include <string>
 #include <string_view>
@@ -35,14 +39,18 @@ class ContentManager final
 
     auto asset_loading_prefix() const -> std::string_view;
 
-    auto load_image(std::string_view name) -> Image;
+    void mount_asset_archive(std::string_view filename);
+
+    void unmount_asset_archive(std::string_view filename);
+
+    auto load_image(std::string_view name, const ImageLoadOptions& options = {}) -> Image;
 
     auto load_shader(std::string_view name, std::span<const std::string_view> defines = {})
         -> Shader;
 
     auto load_font(std::string_view name) -> Font;
 
-    auto load_sound(std::string_view name) -> Sound;
+    auto load_sound(std::string_view name, const SoundLoadOptions& options = {}) -> Sound;
 
     auto load_custom_asset(std::string_view type_id,
                            std::string_view name,
@@ -56,6 +64,14 @@ class ContentManager final
 
     void notify_asset_destroyed(std::string_view name);
 
+    void set_hot_reloading_enabled(bool value);
+
+    auto is_hot_reloading_enabled() const -> bool;
+
+    // Swaps assets whose files have changed into the loaded assets. Called once per frame,
+    // while nothing is drawn.
+    void apply_reloaded_assets();
+
   private:
     using CustomAsset = std::weak_ptr<Asset>;
 
@@ -70,19 +86,41 @@ class ContentManager final
 
     using CustomAssetLoaderMap = StringUnorderedMap<CustomAssetLoadFunc>;
 
+    struct MountedArchive
+    {
+        std::string  filename;
+        AssetArchive archive;
+    };
+
+    // Assets that were loaded successfully are watched by the asset reloader if a reload
+    // source is specified.
     template <typename TBase, typename TImpl, typename TLoadFunc>
-    auto lazy_load(std::string_view key, std::string_view name, const TLoadFunc& load_func);
+    auto lazy_load(std::string_view                     key,
+                   std::string_view                     name,
+                   const TLoadFunc&                     load_func,
+                   std::optional<AssetReloader::Source> reload_source = {});
+
+    // Loads the data of an asset from the mounted archives, or from its file if no archive
+    // contains it.
+    auto load_asset_data(std::string_view name) const -> AssetData;
+
+    // Lets the asset reloader know about an asset that was just loaded, unless it was
+    // loaded from an archive.
+    void watch_asset(std::string_view key, std::string_view name, AssetReloader::Source source);
 
     std::string          m_root_directory;
     std::string          m_asset_loading_prefix;
     MapOfLoadedAssets    m_loaded_assets;
     CustomAssetLoaderMap m_custom_asset_loaders;
+    List<MountedArchive> m_mounted_archives;
+    AssetReloader        m_asset_reloader;
 };
 
 template <typename TBase, typename TImpl, typename TLoadFunc>
-auto ContentManager::lazy_load(std::string_view key,
-                               std::string_view name,
-                               const TLoadFunc& load_func)
+auto ContentManager::lazy_load(std::string_view                     key,
+                               std::string_view                     name,
+                               const TLoadFunc&                     load_func,
+                               std::optional<AssetReloader::Source> reload_source)
 {
     static_assert(std::is_base_of_v<Asset, TImpl>, "Type must derive from Asset");
 
@@ -152,6 +190,11 @@ auto ContentManager::lazy_load(std::string_view key,
 
     m_loaded_assets.emplace(key_str, static_cast<TImpl*>(impl));
 
+    if (reload_source)
+    {
+        watch_asset(key, name_str, std::move(*reload_source));
+    }
+
     return asset;
 }
 } // namespace cer::details
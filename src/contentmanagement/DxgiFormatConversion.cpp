@@ -14,6 +14,10 @@ auto from_dxgi_format(DXGI_FORMAT dxgi_format) -> std::optional<ImageFormat>
     {
         case DXGI_FORMAT_R8G8B8A8_UNORM: return ImageFormat::R8G8B8A8_UNorm;
         case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB: return ImageFormat::R8G8B8A8_Srgb;
+        case DXGI_FORMAT_BC1_UNORM: return ImageFormat::BC1_UNorm;
+        case DXGI_FORMAT_BC1_UNORM_SRGB: return ImageFormat::BC1_Srgb;
+        case DXGI_FORMAT_BC3_UNORM: return ImageFormat::BC3_UNorm;
+        case DXGI_FORMAT_BC3_UNORM_SRGB: return ImageFormat::BC3_Srgb;
         default: return {};
     };
 }
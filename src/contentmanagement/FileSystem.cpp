@@ -26,6 +26,13 @@
 #include "cerlib/details/Android.hpp"
 #include <android/asset_manager.h>
 static AAssetManager* s_cerlib_android_asset_manager;
+#elif defined(__unix__) && !defined(__EMSCRIPTEN__)
+#define CERLIB_MAP_ASSET_FILES
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
 
 namespace cer::details
@@ -225,16 +232,133 @@ auto cer::filesystem::combine_paths(std::string_view path1, std::string_view pat
     return first + second;
 }
 
-auto cer::filesystem::load_asset_data(std::string_view filename) -> AssetData
+[[noreturn]] static void throw_failed_to_open(std::string_view filename,
+                                              std::string_view full_filename)
 {
-    log_verbose("Loading binary file '{}'", filename);
+    if (filename == full_filename)
+    {
+        throw std::runtime_error{fmt::format("Failed to open file '{}' for reading.", filename)};
+    }
+
+    throw std::runtime_error{
+        fmt::format("Failed to open file '{}' for reading ({}).", filename, full_filename)};
+}
+
+#ifdef CERLIB_MAP_ASSET_FILES
+// Files smaller than this are read into a buffer, since mapping them costs more than copying
+// their few pages.
+static constexpr auto s_min_mapped_file_size = size_t(64 * 1024);
+
+// Unmaps a file once the last reference to its data is released. Being a distinct type, it
+// also identifies mapped data for detach_asset_data().
+struct FileMapping
+{
+    size_t size{};
+
+    void operator()(const std::byte* ptr) const
+    {
+        munmap(const_cast<std::byte*>(ptr), size);
+    }
+};
+
+// Maps an asset file into memory, so that decoders read the file's pages directly instead of
+// a copy of them. The OS can drop pages that were already decoded, and the whole file is
+// never resident at once just because it's being loaded.
+//
+// Accessing a mapping after its file was truncated crashes, so assets that keep their data
+// (fonts, sounds) detach it from the file using detach_asset_data().
+//
+// Returns an empty optional if the file can't be opened.
+static auto map_asset_file(const std::string& filename) -> std::optional<cer::AssetData>
+{
+    const auto fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0)
+    {
+        return std::nullopt;
+    }
+
+    defer
+    {
+        close(fd);
+    };
+
+    struct stat info
+    {
+    };
+
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode))
+    {
+        return std::nullopt;
+    }
+
+    const auto size = size_t(info.st_size);
 
-    auto filename_str = std::string{s_file_loading_root_directory};
-    clean_path(filename_str, true);
+    if (size < s_min_mapped_file_size)
+    {
+        auto data       = std::make_unique<std::byte[]>(size);
+        auto bytes_read = size_t(0);
+
+        while (bytes_read < size)
+        {
+            const auto result = read(fd, data.get() + bytes_read, size - bytes_read);
+
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
 
-    filename_str += filename;
-    clean_path(filename_str, false);
+                throw std::runtime_error{fmt::format("Failed to read file '{}'.", filename)};
+            }
 
+            // The file shrank since it was opened.
+            if (result == 0)
+            {
+                break;
+            }
+
+            bytes_read += size_t(result);
+        }
+
+        return cer::AssetData{
+            .data = std::move(data),
+            .size = bytes_read,
+        };
+    }
+
+    auto* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (mapping == MAP_FAILED)
+    {
+        throw std::runtime_error{fmt::format("Failed to map file '{}' into memory.", filename)};
+    }
+
+    return cer::AssetData{
+        .data = std::shared_ptr<const std::byte[]>{static_cast<const std::byte*>(mapping),
+                                                   FileMapping{size}},
+        .size = size,
+    };
+}
+#endif
+
+auto cer::filesystem::asset_file_path(std::string_view filename) -> std::string
+{
+    auto path = std::string{s_file_loading_root_directory};
+    clean_path(path, true);
+
+    path += filename;
+    clean_path(path, false);
+
+    return path;
+}
+
+auto cer::filesystem::load_asset_data(std::string_view filename) -> AssetData
+{
+    log_verbose("Loading binary file '{}'", filename);
+
+    const auto filename_str = asset_file_path(filename);
 
 #if TARGET_OS_IPHONE || TARGET_OS_OSX
     auto       ifs           = std::ifstream{};
@@ -328,20 +452,23 @@ auto cer::filesystem::load_asset_data(std::string_view filename) -> AssetData
         ifs =
             MemoryStream{AAsset_getBuffer(asset_handle), size_t(AAsset_getLength64(asset_handle))};
     }
+#elif defined(CERLIB_MAP_ASSET_FILES)
+    auto data = map_asset_file(filename_str);
+
+    if (!data)
+    {
+        throw_failed_to_open(filename, filename_str);
+    }
+
+    return std::move(*data);
 #else
     std::ifstream ifs{filename_str.c_str(), std::ios::binary | std::ios::ate};
 #endif
 
+#ifndef CERLIB_MAP_ASSET_FILES
     if (!ifs.is_open())
     {
-        if (filename == filename_str)
-        {
-            throw std::runtime_error{
-                fmt::format("Failed to open file '{}' for reading.", filename)};
-        }
-
-        throw std::runtime_error{
-            fmt::format("Failed to open file '{}' for reading ({}).", filename, filename_str)};
+        throw_failed_to_open(filename, filename_str);
     }
 
     const auto data_size = ifs.tellg();
@@ -354,6 +481,26 @@ auto cer::filesystem::load_asset_data(std::string_view filename) -> AssetData
         .data = std::move(data),
         .size = size_t(data_size),
     };
+#endif
+}
+
+auto cer::filesystem::detach_asset_data(AssetData data) -> AssetData
+{
+#ifdef CERLIB_MAP_ASSET_FILES
+    // Entries of mapped asset archives share the archive's deleter.
+    if (std::get_deleter<FileMapping>(data.data) != nullptr)
+    {
+        auto copy = std::make_unique<std::byte[]>(data.size);
+        std::memcpy(copy.get(), data.data.get(), data.size);
+
+        return {
+            .data = std::move(copy),
+            .size = data.size,
+        };
+    }
+#endif
+
+    return data;
 }
 
 auto cer::filesystem::load_file_data_from_disk([[maybe_unused]] std::string_view filename)
@@ -28,6 +28,14 @@ void set_file_loading_root_directory(std::string_view prefix);
 
 auto load_asset_data(std::string_view filename) -> AssetData;
 
+// Copies data that load_asset_data() mapped from a file, so that it stays valid when the
+// file is modified. Other data is returned as is. Used by assets that keep their data.
+auto detach_asset_data(AssetData data) -> AssetData;
+
+// The path of the file that load_asset_data() loads on platforms that load assets from
+// ordinary files.
+auto asset_file_path(std::string_view filename) -> std::string;
+
 auto filename_extension(std::string_view filename) -> std::string;
 
 auto filename_without_extension(std::string_view filename) -> std::string;
@@ -1,4 +1,8 @@
 set(contentmanagement_files
+  AssetArchive.cpp
+  AssetArchive.hpp
+  AssetReloader.cpp
+  AssetReloader.hpp
   Content.cpp
   ContentManager.cpp
   ContentManager.hpp
@@ -10,4 +14,6 @@ set(contentmanagement_files
   FileSystem.hpp
   ImageLoading.cpp
   ImageLoading.hpp
+  KTX2.cpp
+  KTX2.hpp
 )
\ No newline at end of file
@@ -5,11 +5,13 @@
 #include "ImageLoading.hpp"
 
 #include "DDS.hpp"
+#include "KTX2.hpp"
 #include "cerlib/Image.hpp"
 #include "cerlib/Logging.hpp"
 #include "contentmanagement/FileSystem.hpp"
 #include "graphics/GraphicsDevice.hpp"
 #include "graphics/ImageImpl.hpp"
+#include "graphics/Mipmaps.hpp"
 #include "util/narrow_cast.hpp"
 #include <cstddef>
 
@@ -38,8 +40,8 @@
 
 namespace cer::details
 {
-static auto try_load_misc(GraphicsDevice& device, std::span<const std::byte> memory)
-    -> std::unique_ptr<ImageImpl>
+static auto try_decode_misc(std::span<const std::byte> memory, const ImageLoadOptions& options)
+    -> std::optional<DecodedImage>
 {
     const auto is_hdr = stbi_is_hdr_from_memory(reinterpret_cast<const stbi_uc*>(memory.data()),
                                                 narrow<int>(memory.size())) != 0;
@@ -70,53 +72,112 @@ static auto try_load_misc(GraphicsDevice& device, std::span<const std::byte> mem
 
     if (image_data == nullptr)
     {
-        return nullptr;
+        return std::nullopt;
     }
 
+    auto image = DecodedImage{
+        .width          = uint32_t(width),
+        .height         = uint32_t(height),
+        .format         = is_hdr ? ImageFormat::R32G32B32A32_Float : ImageFormat::R8G8B8A8_UNorm,
+        .decoded_pixels = std::shared_ptr<void>{image_data, stbi_image_free},
+    };
+
     if (width <= 0 || height <= 0 || comp <= 0)
     {
         throw std::runtime_error{"Failed to load the image (invalid extents/channels)."};
     }
 
-    defer
+    if (options.generate_mipmaps)
     {
-        stbi_image_free(image_data);
-    };
-
-    const auto format = is_hdr ? ImageFormat::R32G32B32A32_Float : ImageFormat::R8G8B8A8_UNorm;
+        image.generated_mipmaps =
+            generate_mipmaps(image.width, image.height, image.format, image_data);
+    }
 
-    return device.create_image(width, height, format, image_data);
+    return image;
 }
 } // namespace cer::details
 
-auto cer::details::load_image(GraphicsDevice& device_impl, std::span<const std::byte> memory)
-    -> std::unique_ptr<ImageImpl>
+auto cer::details::DecodedImage::mipmaps() const -> List<const void*, 16>
 {
-    log_verbose("Loading image from memory. Span is {} bytes", memory.size());
+    if (decoded_pixels == nullptr)
+    {
+        return file_mipmaps;
+    }
 
+    auto mipmaps = List<const void*, 16>{decoded_pixels.get()};
+
+    for (const auto& mipmap : generated_mipmaps)
+    {
+        mipmaps.push_back(mipmap.data());
+    }
+
+    return mipmaps;
+}
+
+auto cer::details::decode_image(std::span<const std::byte> memory,
+                                const ImageLoadOptions&    options) -> DecodedImage
+{
     // Try loading misc image first
 
-    if (auto image = try_load_misc(device_impl, memory))
+    if (auto image = try_decode_misc(memory, options))
     {
-        return image;
+        return std::move(*image);
     }
 
     if (const auto maybe_dds_image = dds::load(memory))
     {
-        const auto& dds_image    = *maybe_dds_image;
-        const auto& first_mipmap = dds_image.faces.front().mipmaps.front();
+        const auto& dds_image = *maybe_dds_image;
 
-        return device_impl.create_image(dds_image.width,
-                                        dds_image.height,
-                                        dds_image.format,
-                                        first_mipmap.data_span.data());
+        // DDS files come with their own mipmaps, if any, which are used as they are.
+        auto image = DecodedImage{
+            .width  = dds_image.width,
+            .height = dds_image.height,
+            .format = dds_image.format,
+        };
+
+        for (const auto& mipmap : dds_image.faces.front().mipmaps)
+        {
+            image.file_mipmaps.push_back(mipmap.data_span.data());
+        }
+
+        return image;
+    }
+
+    if (const auto maybe_ktx2_image = ktx2::load(memory))
+    {
+        const auto& ktx2_image = *maybe_ktx2_image;
+
+        auto image = DecodedImage{
+            .width  = ktx2_image.width,
+            .height = ktx2_image.height,
+            .format = ktx2_image.format,
+        };
+
+        for (const auto& mipmap : ktx2_image.mipmaps)
+        {
+            image.file_mipmaps.push_back(mipmap.data());
+        }
+
+        return image;
     }
 
     throw std::runtime_error{"Failed to load the image (unknown image type)."};
 }
 
-auto cer::details::load_image(GraphicsDevice& device_impl, std::string_view filename)
-    -> std::unique_ptr<ImageImpl>
+auto cer::details::load_image(GraphicsDevice&            device_impl,
+                              std::span<const std::byte> memory,
+                              const ImageLoadOptions&    options) -> std::unique_ptr<ImageImpl>
+{
+    log_verbose("Loading image from memory. Span is {} bytes", memory.size());
+
+    const auto image = decode_image(memory, options);
+
+    return device_impl.create_image(image.width, image.height, image.format, image.mipmaps());
+}
+
+auto cer::details::load_image(GraphicsDevice&         device_impl,
+                              std::string_view        filename,
+                              const ImageLoadOptions& options) -> std::unique_ptr<ImageImpl>
 {
-    return load_image(device_impl, filesystem::load_file_data_from_disk(filename));
+    return load_image(device_impl, filesystem::load_file_data_from_disk(filename), options);
 }
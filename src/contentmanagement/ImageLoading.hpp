@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include "cerlib/Image.hpp"
+#include <cerlib/List.hpp>
+#include <cstddef>
+#include <memory>
 #include <span>
 
 namespace cer::details
@@ -11,9 +15,31 @@ namespace cer::details
 class GraphicsDevice;
 class ImageImpl;
 
-auto load_image(GraphicsDevice& device_impl, std::span<const std::byte> memory)
-    -> std::unique_ptr<ImageImpl>;
+// An image that was decoded on the CPU, but not created on a graphics device yet.
+// Decoding doesn't touch the device, which is why it may run on any thread.
+struct DecodedImage
+{
+    // All mipmaps, starting with the full-size image. The mipmaps of images that were
+    // stored in a container format (DDS, KTX2) point into the memory that the image was
+    // decoded from.
+    auto mipmaps() const -> List<const void*, 16>;
+
+    uint32_t              width{};
+    uint32_t              height{};
+    ImageFormat           format{};
+    std::shared_ptr<void> decoded_pixels{};
+    List<List<std::byte>> generated_mipmaps{};
+    List<const void*, 16> file_mipmaps{};
+};
+
+auto decode_image(std::span<const std::byte> memory, const ImageLoadOptions& options)
+    -> DecodedImage;
+
+auto load_image(GraphicsDevice&            device_impl,
+                std::span<const std::byte> memory,
+                const ImageLoadOptions&    options) -> std::unique_ptr<ImageImpl>;
 
-auto load_image(GraphicsDevice& device_impl, std::string_view filename)
-    -> std::unique_ptr<ImageImpl>;
+auto load_image(GraphicsDevice&         device_impl,
+                std::string_view        filename,
+                const ImageLoadOptions& options) -> std::unique_ptr<ImageImpl>;
 } // namespace cer::details
@@ -0,0 +1,144 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "KTX2.hpp"
+
+#include "graphics/Mipmaps.hpp"
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+namespace cer::ktx2
+{
+static constexpr auto identifier = std::array<uint8_t, 12>{
+    0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+struct Header
+{
+    std::array<uint8_t, 12> identifier{};
+    uint32_t                vk_format{};
+    uint32_t                type_size{};
+    uint32_t                pixel_width{};
+    uint32_t                pixel_height{};
+    uint32_t                pixel_depth{};
+    uint32_t                layer_count{};
+    uint32_t                face_count{};
+    uint32_t                level_count{};
+    uint32_t                supercompression_scheme{};
+    uint32_t                dfd_byte_offset{};
+    uint32_t                dfd_byte_length{};
+    uint32_t                kvd_byte_offset{};
+    uint32_t                kvd_byte_length{};
+    uint64_t                sgd_byte_offset{};
+    uint64_t                sgd_byte_length{};
+};
+
+static_assert(sizeof(Header) == 80);
+
+struct LevelIndex
+{
+    uint64_t byte_offset{};
+    uint64_t byte_length{};
+    uint64_t uncompressed_byte_length{};
+};
+
+static_assert(sizeof(LevelIndex) == 24);
+
+// VkFormat values of the formats that images support.
+static auto from_vk_format(uint32_t vk_format) -> std::optional<ImageFormat>
+{
+    switch (vk_format)
+    {
+        case 9: return ImageFormat::R8_UNorm;
+        case 37: return ImageFormat::R8G8B8A8_UNorm;
+        case 43: return ImageFormat::R8G8B8A8_Srgb;
+        case 109: return ImageFormat::R32G32B32A32_Float;
+        case 133: return ImageFormat::BC1_UNorm;
+        case 134: return ImageFormat::BC1_Srgb;
+        case 137: return ImageFormat::BC3_UNorm;
+        case 138: return ImageFormat::BC3_Srgb;
+        case 147: return ImageFormat::ETC2_RGB8_UNorm;
+        case 148: return ImageFormat::ETC2_RGB8_Srgb;
+        case 151: return ImageFormat::ETC2_RGBA8_UNorm;
+        case 152: return ImageFormat::ETC2_RGBA8_Srgb;
+        default: return {};
+    }
+}
+
+auto load(std::span<const std::byte> memory) -> std::optional<KTX2Image>
+{
+    if (memory.size() < sizeof(Header) ||
+        std::memcmp(memory.data(), identifier.data(), identifier.size()) != 0)
+    {
+        return {};
+    }
+
+    auto header = Header{};
+    std::memcpy(&header, memory.data(), sizeof(Header));
+
+    if (header.supercompression_scheme != 0)
+    {
+        throw std::runtime_error{"Supercompressed KTX2 files are not supported."};
+    }
+
+    if (header.pixel_width == 0 || header.pixel_height == 0 || header.pixel_depth > 1 ||
+        header.layer_count > 1 || header.face_count != 1)
+    {
+        throw std::runtime_error{"Only KTX2 files that contain a single 2D image are supported."};
+    }
+
+    const auto format = from_vk_format(header.vk_format);
+
+    if (!format)
+    {
+        throw std::runtime_error{
+            fmt::format("Unsupported format in KTX2 data (VkFormat {}).", header.vk_format)};
+    }
+
+    // A level count of zero asks the loader to generate mipmaps, which is up to the
+    // ImageLoadOptions instead.
+    const auto level_count = std::max(header.level_count, 1u);
+
+    if (level_count > details::full_mipmap_count(header.pixel_width, header.pixel_height))
+    {
+        throw std::runtime_error{
+            fmt::format("KTX2 has more mipmaps than its size allows ({}).", level_count)};
+    }
+
+    if (memory.size() < sizeof(Header) + (level_count * sizeof(LevelIndex)))
+    {
+        throw std::runtime_error{"KTX2 has invalid level index."};
+    }
+
+    auto image = KTX2Image{
+        .width  = header.pixel_width,
+        .height = header.pixel_height,
+        .format = *format,
+    };
+
+    for (uint32_t level = 0; level < level_count; ++level)
+    {
+        auto index = LevelIndex{};
+        std::memcpy(&index,
+                    memory.data() + sizeof(Header) + (level * sizeof(LevelIndex)),
+                    sizeof(LevelIndex));
+
+        const auto expected_size =
+            image_slice_pitch(std::max(image.width >> level, 1u),
+                              std::max(image.height >> level, 1u),
+                              image.format);
+
+        if (index.byte_offset > memory.size() ||
+            index.byte_length > memory.size() - index.byte_offset ||
+            index.byte_length < expected_size)
+        {
+            throw std::runtime_error{fmt::format("KTX2 has invalid data for mipmap {}.", level)};
+        }
+
+        image.mipmaps.push_back(memory.subspan(size_t(index.byte_offset), expected_size));
+    }
+
+    return image;
+}
+} // namespace cer::ktx2
@@ -0,0 +1,26 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include "cerlib/Image.hpp"
+#include <cerlib/List.hpp>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace cer::ktx2
+{
+struct KTX2Image
+{
+    uint32_t                             width{};
+    uint32_t                             height{};
+    ImageFormat                          format{};
+    List<std::span<const std::byte>, 16> mipmaps{};
+};
+
+// Returns an empty optional if the memory doesn't contain a KTX2 file, and throws if it
+// does but the file can't be loaded.
+auto load(std::span<const std::byte> memory) -> std::optional<KTX2Image>;
+} // namespace cer::ktx2
@@ -1,7 +1,11 @@
 set(game_files
+  FrameWorker.cpp
+  FrameWorker.hpp
   Game.cpp
   GameImpl.cpp
   GameImpl.hpp
+  GameLoop.cpp
+  GameLoop.hpp
   Window.cpp
   WindowImpl.cpp
   WindowImpl.hpp
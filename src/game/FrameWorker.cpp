@@ -0,0 +1,113 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "FrameWorker.hpp"
+#include <cassert>
+#include <utility>
+
+namespace cer::details
+{
+FrameWorker::FrameWorker()
+    : m_thread([this] {
+        thread_main();
+    })
+{
+}
+
+FrameWorker::~FrameWorker() noexcept
+{
+    {
+        const auto lock = std::scoped_lock{m_mutex};
+        m_should_stop   = true;
+    }
+
+    m_condition.notify_all();
+    m_thread.join();
+}
+
+void FrameWorker::start(Job job)
+{
+    {
+        const auto lock = std::scoped_lock{m_mutex};
+
+        assert(!m_has_pending_job);
+
+        m_job             = std::move(job);
+        m_has_pending_job = true;
+        m_is_job_done     = false;
+        m_job_result      = false;
+        m_job_exception   = {};
+    }
+
+    m_condition.notify_all();
+}
+
+auto FrameWorker::has_pending_job() const -> bool
+{
+    return m_has_pending_job;
+}
+
+auto FrameWorker::wait() -> bool
+{
+    auto lock = std::unique_lock{m_mutex};
+
+    if (!m_has_pending_job)
+    {
+        return true;
+    }
+
+    m_condition.wait(lock, [this] {
+        return m_is_job_done;
+    });
+
+    m_has_pending_job = false;
+    m_job             = {};
+
+    if (m_job_exception)
+    {
+        std::rethrow_exception(std::exchange(m_job_exception, {}));
+    }
+
+    return m_job_result;
+}
+
+void FrameWorker::thread_main()
+{
+    auto lock = std::unique_lock{m_mutex};
+
+    while (true)
+    {
+        m_condition.wait(lock, [this] {
+            return m_should_stop || (m_has_pending_job && !m_is_job_done);
+        });
+
+        if (m_should_stop)
+        {
+            break;
+        }
+
+        lock.unlock();
+
+        auto result    = false;
+        auto exception = std::exception_ptr{};
+
+        try
+        {
+            result = m_job();
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        lock.lock();
+
+        m_job_result    = result;
+        m_job_exception = exception;
+        m_is_job_done   = true;
+
+        m_condition.notify_all();
+    }
+}
+} // namespace cer::details
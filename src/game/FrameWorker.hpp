@@ -0,0 +1,59 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <cerlib/CopyMoveMacros.hpp>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace cer::details
+{
+/**
+ * A dedicated thread that runs one frame job at a time, used to build the next frame
+ * while the current one is rendered.
+ */
+class FrameWorker final
+{
+  public:
+    /** A job returns false if the game should exit. */
+    using Job = std::function<bool()>;
+
+    FrameWorker();
+
+    forbid_copy_and_move(FrameWorker);
+
+    ~FrameWorker() noexcept;
+
+    /**
+     * Starts running a job on the worker thread. No other job may be pending.
+     */
+    void start(Job job);
+
+    auto has_pending_job() const -> bool;
+
+    /**
+     * Waits until the pending job has finished and returns its result.
+     * If the job threw an exception, it is rethrown on the calling thread.
+     * If no job is pending, returns true immediately.
+     */
+    auto wait() -> bool;
+
+  private:
+    void thread_main();
+
+    std::mutex              m_mutex;
+    std::condition_variable m_condition;
+    Job                     m_job;
+    bool                    m_has_pending_job{};
+    bool                    m_is_job_done{};
+    bool                    m_should_stop{};
+    bool                    m_job_result{};
+    std::exception_ptr      m_job_exception;
+    std::thread             m_thread;
+};
+} // namespace cer::details
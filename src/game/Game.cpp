@@ -19,8 +19,13 @@ Game::Game()
 }
 
 Game::Game(bool enable_audio)
+    : Game(enable_audio ? AudioMode::Device : AudioMode::Disabled)
 {
-    details::GameImpl::init_instance(enable_audio);
+}
+
+Game::Game(AudioMode audio_mode)
+{
+    details::GameImpl::init_instance(audio_mode);
 
     auto& game_impl = details::GameImpl::instance();
 
@@ -151,6 +156,24 @@ auto Game::gamepads() -> List<Gamepad>
     return impl.gamepads();
 }
 
+auto Game::loop_options() -> GameLoopOptions
+{
+    LOAD_GAME_IMPL;
+    return impl.loop_options();
+}
+
+void Game::set_loop_options(const GameLoopOptions& options)
+{
+    LOAD_GAME_IMPL;
+    impl.set_loop_options(options);
+}
+
+auto Game::current_time() -> GameTime
+{
+    LOAD_GAME_IMPL;
+    return impl.current_time();
+}
+
 Game::~Game() noexcept
 {
     details::GameImpl::destroy_instance();
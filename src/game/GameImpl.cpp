@@ -24,6 +24,8 @@
 #include <algorithm>
 #include <cassert>
 #include <cerlib/List.hpp>
+#include <chrono>
+#include <thread>
 
 #ifdef __EMSCRIPTEN__
 #include <emscripten.h>
@@ -109,17 +111,28 @@ using namespace std::chrono_literals;
 
 static std::unique_ptr<GameImpl> s_game_instance;
 
-GameImpl::GameImpl(bool enable_audio)
+static auto seconds_since_start() -> double
+{
+    return double(SDL_GetPerformanceCounter()) / double(SDL_GetPerformanceFrequency());
+}
+
+GameImpl::GameImpl(AudioMode audio_mode)
 {
     log_verbose("Creating game");
 
-    if (is_desktop_platform() && enable_audio)
+    if (is_desktop_platform() && audio_mode == AudioMode::Device)
     {
         if (const auto* env = SDL_getenv("CERLIB_DISABLE_AUDIO");
             env != nullptr && std::strncmp(env, "1", 1) == 0)
         {
             log_verbose("Implicitly disabling audio due to environment variable");
-            enable_audio = false;
+            audio_mode = AudioMode::Disabled;
+        }
+        else if (const auto* env = SDL_getenv("CERLIB_OFFLINE_AUDIO");
+                 env != nullptr && std::strncmp(env, "1", 1) == 0)
+        {
+            log_verbose("Implicitly using offline audio due to environment variable");
+            audio_mode = AudioMode::Offline;
         }
     }
 
@@ -131,7 +144,7 @@ GameImpl::GameImpl(bool enable_audio)
     init_flags |= SDL_INIT_GAMEPAD;
 #endif
 
-    if (enable_audio)
+    if (audio_mode == AudioMode::Device)
     {
         init_flags |= SDL_INIT_AUDIO;
     }
@@ -149,13 +162,17 @@ GameImpl::GameImpl(bool enable_audio)
 
     log_verbose("SDL is initialized");
 
-    if (enable_audio)
+    if (audio_mode != AudioMode::Disabled)
     {
         log_verbose("Audio is enabled, attempting to initialize it");
 
+        const auto backend = audio_mode == AudioMode::Offline ? AudioBackend::NullDriver
+                                                               : AudioBackend::Auto;
+
         try
         {
-            m_audio_device = std::make_unique<AudioDevice>(EngineFlags{}, 44100, 4096, 2);
+            m_audio_device =
+                std::make_unique<AudioDevice>(EngineFlags{}, 44100, 4096, 2, backend);
             log_debug("Audio initialized successfully");
         }
         catch (const std::exception& ex)
@@ -177,14 +194,14 @@ GameImpl::GameImpl(bool enable_audio)
 
 GameImpl::~GameImpl() noexcept = default;
 
-void GameImpl::init_instance(bool enable_audio)
+void GameImpl::init_instance(AudioMode audio_mode)
 {
     if (s_game_instance != nullptr)
     {
         throw std::logic_error{"The game is already initialized exists."};
     }
 
-    s_game_instance = std::make_unique<GameImpl>(enable_audio);
+    s_game_instance = std::make_unique<GameImpl>(audio_mode);
 }
 
 auto GameImpl::instance() -> GameImpl&
@@ -227,6 +244,18 @@ void GameImpl::run()
         0,
         1);
 #else
+    // Don't leave the worker running game code once the loop ends. Recorded frames hold
+    // references to resources, which must be released while the device still exists.
+    defer
+    {
+        m_frame_worker.reset();
+
+        for (auto& frame : m_recorded_frames)
+        {
+            frame.clear();
+        }
+    };
+
     while (tick())
     {
         // Nothing to do
@@ -458,6 +487,25 @@ auto GameImpl::gamepads() const -> List<Gamepad>
     return m_connected_gamepads;
 }
 
+auto GameImpl::loop_options() const -> GameLoopOptions
+{
+    return m_pending_loop_options ? *m_pending_loop_options : m_game_loop.options();
+}
+
+void GameImpl::set_loop_options(const GameLoopOptions& options)
+{
+    GameLoop::verify_options(options);
+
+    // Options are applied at the start of the next tick, since the game loop may be in
+    // use by the main thread while this is called from a pipelined update().
+    m_pending_loop_options = options;
+}
+
+auto GameImpl::current_time() const -> GameTime
+{
+    return m_game_loop.game_time();
+}
+
 void GameImpl::open_initial_gamepads()
 {
 #ifndef __EMSCRIPTEN__
@@ -531,6 +579,19 @@ auto GameImpl::tick() -> bool
         m_has_loaded_content = true;
     }
 
+    // In pipelined mode, wait for the worker to finish the frame that is rendered in this
+    // tick. This also ensures that the worker doesn't run while events are processed.
+    if (m_frame_worker != nullptr && !m_frame_worker->wait())
+    {
+        return false;
+    }
+
+    if (m_pending_loop_options)
+    {
+        m_game_loop.set_options(*m_pending_loop_options);
+        m_pending_loop_options.reset();
+    }
+
     process_events();
 
     if (m_audio_device != nullptr)
@@ -538,19 +599,43 @@ auto GameImpl::tick() -> bool
         m_audio_device->purge_sounds();
     }
 
-    do_time_measurement();
+    m_content_manager->apply_reloaded_assets();
+
+    if (m_graphics_device != nullptr)
+    {
+        // Resources that the worker released in the previous tick are destroyed here.
+        m_graphics_device->destroy_released_resources();
+        m_graphics_device->canvas_pool().next_frame();
+    }
+
+    const auto update_step_count = m_game_loop.begin_frame(seconds_since_start());
 
     bool should_exit = false;
 
-    // Do update()
-    if (m_update_func && !m_update_func(m_game_time))
+    if (is_pipelined())
     {
-        should_exit = true;
+        do_pipelined_frame(update_step_count);
     }
+    else
+    {
+        if (m_frame_worker != nullptr)
+        {
+            // Pipelining was turned off; the last recorded frame is dropped.
+            m_frame_worker.reset();
+            m_recorded_frames = {};
+        }
 
-    do_draw();
+        should_exit = !run_update_steps(update_step_count);
 
-    m_is_first_tick = false;
+        do_draw();
+    }
+
+#ifndef __EMSCRIPTEN__
+    // On the web, frames are paced by the browser.
+    m_game_loop.pace_frame(&seconds_since_start, [](double duration) {
+        std::this_thread::sleep_for(std::chrono::duration<double>{duration});
+    });
+#endif
 
     return !should_exit;
 }
@@ -955,18 +1040,20 @@ void GameImpl::process_single_event(const SDL_Event& event, InputImpl& input_imp
     }
 }
 
-void GameImpl::do_time_measurement()
+auto GameImpl::run_update_steps(uint32_t count) -> bool
 {
-    const auto current_time   = SDL_GetPerformanceCounter();
-    const auto time_frequency = SDL_GetPerformanceFrequency();
-
-    m_game_time.elapsed_time = m_is_first_tick ? 0
-                                               : (double(current_time) - double(m_previous_time)) *
-                                                     1000 / double(time_frequency) * 0.001;
+    // Do update(), possibly multiple times when running at a fixed update rate.
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const auto& game_time = m_game_loop.next_update_time();
 
-    m_game_time.total_time += m_game_time.elapsed_time;
+        if (m_update_func && !m_update_func(game_time))
+        {
+            return false;
+        }
+    }
 
-    m_previous_time = current_time;
+    return true;
 }
 
 void GameImpl::do_draw()
@@ -976,25 +1063,117 @@ void GameImpl::do_draw()
         for (auto window_impl : m_windows)
         {
             auto window = Window{window_impl};
-            m_graphics_device->start_frame(window);
 
-            // Ensure that the frame ends even if an exception is thrown during this frame.
-            defer_named(end_frame_guard)
-            {
+            render_window(window, [this, &window] {
+                m_draw_func(window);
+            });
+        }
+    }
+}
+
+void GameImpl::render_window(const Window& window, const std::function<void()>& draw_func)
+{
+    m_graphics_device->start_frame(window);
+
+    // Ensure that the frame ends even if an exception is thrown during this frame.
+    defer_named(end_frame_guard)
+    {
 #ifdef CERLIB_ENABLE_IMGUI
-                const auto post_draw_callback = [this, &window] {
-                    do_imgui_draw(window);
-                };
+        const auto post_draw_callback = [this, &window] {
+            do_imgui_draw(window);
+        };
 #else
-                const auto post_draw_callback = [] {
-                };
+        const auto post_draw_callback = [] {
+        };
 #endif
 
-                m_graphics_device->end_frame(window, post_draw_callback);
-            };
+        m_graphics_device->end_frame(window, post_draw_callback);
+    };
+
+    draw_func();
+}
+
+auto GameImpl::is_pipelined() const -> bool
+{
+#ifdef __EMSCRIPTEN__
+    return false;
+#else
+    return m_game_loop.options().pipelined;
+#endif
+}
+
+void GameImpl::do_pipelined_frame(uint32_t update_step_count)
+{
+    if (m_frame_worker == nullptr)
+    {
+        log_verbose("Starting pipelined update and rendering");
+
+        if (m_graphics_device != nullptr)
+        {
+            m_recorded_sprite_shader = m_graphics_device->current_sprite_shader();
+            m_recorded_blend_state   = m_graphics_device->current_blend_state();
+        }
+
+        m_frame_worker = std::make_unique<FrameWorker>();
+    }
+
+    // Render the frame that was recorded during the previous tick, while the worker
+    // updates the game and records the next frame into the other list.
+    auto& frame_to_render   = m_recorded_frames[m_recording_frame_index];
+    m_recording_frame_index = (m_recording_frame_index + 1) % m_recorded_frames.size();
+    auto& frame_to_record   = m_recorded_frames[m_recording_frame_index];
 
-            m_draw_func(window);
+    const auto previous_frame_stats =
+        m_graphics_device != nullptr ? m_graphics_device->frame_stats_ref() : FrameStats{};
+
+    m_frame_worker->start([this, update_step_count, &frame_to_record, previous_frame_stats] {
+        if (!run_update_steps(update_step_count))
+        {
+            return false;
         }
+
+        record_frame(frame_to_record, previous_frame_stats);
+
+        return true;
+    });
+
+    for (const auto& list : frame_to_render)
+    {
+        render_window(list.window(), [this, &list] {
+            list.replay(*m_graphics_device);
+        });
+    }
+}
+
+void GameImpl::record_frame(List<DrawCommandList>& frame, const FrameStats& previous_frame_stats)
+{
+    if (!m_draw_func || m_graphics_device == nullptr)
+    {
+        frame.clear();
+        return;
+    }
+
+    frame.resize(m_windows.size());
+
+    for (size_t i = 0; i < m_windows.size(); ++i)
+    {
+        const auto window = Window{m_windows[i]};
+        auto&      list   = frame[i];
+
+        list.begin_recording(window,
+                             previous_frame_stats,
+                             m_recorded_sprite_shader,
+                             m_recorded_blend_state);
+
+        defer
+        {
+            list.end_recording();
+        };
+
+        m_draw_func(window);
+
+        m_recorded_sprite_shader = list.current_sprite_shader();
+        m_recorded_blend_state   = list.current_blend_state();
     }
 }
 
@@ -1045,6 +1224,11 @@ void GameImpl::notify_window_destroyed(WindowImpl* window)
     assert(it != m_windows.cend());
 
     m_windows.erase(it);
+
+    if (m_graphics_device != nullptr)
+    {
+        m_graphics_device->canvas_pool().remove_canvases_of(window);
+    }
 }
 
 auto GameImpl::find_window_by_sdl_window_id(Uint32 sdl_window_id) const -> Window
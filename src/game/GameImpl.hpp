@@ -4,11 +4,15 @@
 
 #pragma once
 
+#include "FrameWorker.hpp"
+#include "GameLoop.hpp"
 #include "cerlib/Game.hpp"
 #include "cerlib/Vector2.hpp"
+#include "graphics/DrawCommandList.hpp"
 #include "util/Object.hpp"
 #include <cerlib/CopyMoveMacros.hpp>
 #include <cerlib/List.hpp>
+#include <array>
 #include <map>
 #include <span>
 #include <variant>
@@ -82,13 +86,13 @@ class GameImpl final : public Object
 
     using EventFunc = std::function<void(const Event& event)>;
 
-    explicit GameImpl(bool enable_audio);
+    explicit GameImpl(AudioMode audio_mode);
 
     forbid_copy_and_move(GameImpl);
 
     ~GameImpl() noexcept override;
 
-    static void init_instance(bool enable_audio);
+    static void init_instance(AudioMode audio_mode);
 
     static auto instance() -> GameImpl&;
 
@@ -138,6 +142,12 @@ class GameImpl final : public Object
 
     auto gamepads() const -> List<Gamepad>;
 
+    auto loop_options() const -> GameLoopOptions;
+
+    void set_loop_options(const GameLoopOptions& options);
+
+    auto current_time() const -> GameTime;
+
   private:
     void open_initial_gamepads();
 
@@ -151,10 +161,18 @@ class GameImpl final : public Object
 
     void process_single_event(const SDL_Event& event, InputImpl& input_impl);
 
-    void do_time_measurement();
+    auto run_update_steps(uint32_t count) -> bool;
 
     void do_draw();
 
+    void render_window(const Window& window, const std::function<void()>& draw_func);
+
+    auto is_pipelined() const -> bool;
+
+    void do_pipelined_frame(uint32_t update_step_count);
+
+    void record_frame(List<DrawCommandList>& frame, const FrameStats& previous_frame_stats);
+
     void do_imgui_draw(const Window& window);
 
     void notify_window_created(WindowImpl* window);
@@ -171,10 +189,10 @@ class GameImpl final : public Object
         -> std::ranges::borrowed_iterator_t<const List<Gamepad>&>;
 
     bool       m_is_running{};
-    bool       m_is_first_tick{true};
     bool       m_has_loaded_content{};
-    Uint64     m_previous_time{};
-    GameTime   m_game_time;
+    GameLoop   m_game_loop;
+
+    std::optional<GameLoopOptions> m_pending_loop_options;
     LoadFunc   m_load_func;
     UpdateFunc m_update_func;
     DrawFunc   m_draw_func;
@@ -200,5 +218,13 @@ class GameImpl final : public Object
     List<WindowImpl*>               m_windows;
     Vector2                         m_previous_mouse_position;
     List<Gamepad>                   m_connected_gamepads;
+
+    // Pipelined mode: the frame that the worker records in one tick is rendered in the
+    // next one. The sprite shader and blend state carry over from frame to frame.
+    std::array<List<DrawCommandList>, 2> m_recorded_frames;
+    size_t                               m_recording_frame_index{};
+    Shader                               m_recorded_sprite_shader;
+    BlendState                           m_recorded_blend_state;
+    std::unique_ptr<FrameWorker>         m_frame_worker;
 };
 } // namespace cer::details
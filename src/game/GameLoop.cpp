@@ -0,0 +1,151 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "GameLoop.hpp"
+#include "cerlib/Math.hpp"
+#include <cmath>
+#include <stdexcept>
+
+namespace cer::details
+{
+auto GameLoop::options() const -> const GameLoopOptions&
+{
+    return m_options;
+}
+
+void GameLoop::set_options(const GameLoopOptions& options)
+{
+    verify_options(options);
+
+    if (options.fixed_update_rate != m_options.fixed_update_rate)
+    {
+        m_accumulator                   = 0.0;
+        m_game_time.interpolation_alpha = 0.0;
+    }
+
+    if (options.target_fps != m_options.target_fps)
+    {
+        // Restart pacing from the current frame.
+        m_next_frame_time.reset();
+    }
+
+    m_options = options;
+}
+
+void GameLoop::verify_options(const GameLoopOptions& options)
+{
+    if (options.fixed_update_rate && !(*options.fixed_update_rate > 0.0))
+    {
+        throw std::invalid_argument{"The fixed update rate must be greater than zero."};
+    }
+
+    if (options.target_fps && !(*options.target_fps > 0.0))
+    {
+        throw std::invalid_argument{"The target FPS must be greater than zero."};
+    }
+
+    if (options.max_update_steps == 0)
+    {
+        throw std::invalid_argument{"The maximum number of update steps must not be zero."};
+    }
+
+#if !defined(CERLIB_ATOMIC_REFCOUNTING) && !defined(__EMSCRIPTEN__)
+    if (options.pipelined)
+    {
+        throw std::invalid_argument{"Pipelined mode requires cerlib to be built with the "
+                                    "CERLIB_ATOMIC_REFCOUNTING option."};
+    }
+#endif
+}
+
+auto GameLoop::begin_frame(double now) -> uint32_t
+{
+    m_frame_elapsed_time = m_is_first_frame ? 0.0 : max(now - m_previous_time, 0.0);
+    m_previous_time      = now;
+    m_is_first_frame     = false;
+
+    if (!m_options.fixed_update_rate)
+    {
+        m_game_time.interpolation_alpha = 0.0;
+        return 1;
+    }
+
+    const auto step = fixed_step();
+
+    m_accumulator += m_frame_elapsed_time;
+
+    const auto step_count =
+        uint32_t(min(std::floor(m_accumulator / step), double(m_options.max_update_steps)));
+
+    m_accumulator -= double(step_count) * step;
+
+    if (m_accumulator >= step)
+    {
+        // We're further behind than the catch-up limit allows. Drop the excess time, so
+        // that a long stall (e.g. a breakpoint or a window drag) doesn't turn into an
+        // avalanche of update steps.
+        m_accumulator = std::fmod(m_accumulator, step);
+    }
+
+    m_game_time.interpolation_alpha = m_accumulator / step;
+
+    return step_count;
+}
+
+auto GameLoop::next_update_time() -> const GameTime&
+{
+    m_game_time.elapsed_time = m_options.fixed_update_rate ? fixed_step() : m_frame_elapsed_time;
+    m_game_time.total_time += m_game_time.elapsed_time;
+
+    return m_game_time;
+}
+
+auto GameLoop::game_time() const -> const GameTime&
+{
+    return m_game_time;
+}
+
+void GameLoop::pace_frame(const ClockFunc& clock, const SleepFunc& sleep)
+{
+    if (!m_options.target_fps)
+    {
+        return;
+    }
+
+    const auto frame_duration = 1.0 / *m_options.target_fps;
+    auto       now            = clock();
+
+    // Schedule frames relative to the previous deadline rather than to the end of the
+    // previous frame, so that small overshoots don't accumulate into drift. If we're
+    // more than a frame late, re-anchor to now instead of trying to catch up.
+    if (!m_next_frame_time || *m_next_frame_time + frame_duration < now - frame_duration)
+    {
+        m_next_frame_time = now;
+        return;
+    }
+
+    const auto deadline = *m_next_frame_time + frame_duration;
+    m_next_frame_time   = deadline;
+
+    // Sleep for the bulk of the remaining time. Sleeping is imprecise, so the
+    // last part is spun instead.
+    const auto sleep_duration = deadline - now - spin_duration;
+
+    if (sleep_duration > 0.0)
+    {
+        sleep(sleep_duration);
+        now = clock();
+    }
+
+    while (now < deadline)
+    {
+        now = clock();
+    }
+}
+
+auto GameLoop::fixed_step() const -> double
+{
+    return 1.0 / *m_options.fixed_update_rate;
+}
+} // namespace cer::details
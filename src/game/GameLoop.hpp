@@ -0,0 +1,82 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include "cerlib/Game.hpp"
+#include <functional>
+#include <optional>
+
+namespace cer::details
+{
+/**
+ * Implements the timing logic of the game loop, i.e. how many update steps to run
+ * per frame, with which game time, and how long to wait until the next frame starts.
+ *
+ * All times are in seconds and come from an external clock, which allows the loop
+ * logic to be driven by a fake clock in tests.
+ */
+class GameLoop final
+{
+  public:
+    /** Returns the current time, in seconds. */
+    using ClockFunc = std::function<double()>;
+
+    /** Blocks the calling thread for roughly the specified duration, in seconds. */
+    using SleepFunc = std::function<void(double duration)>;
+
+    /** The part of a frame's remaining time that is spun instead of slept. */
+    static constexpr double spin_duration = 0.002;
+
+    GameLoop() = default;
+
+    auto options() const -> const GameLoopOptions&;
+
+    void set_options(const GameLoopOptions& options);
+
+    /**
+     * Throws if the specified options are invalid.
+     */
+    static void verify_options(const GameLoopOptions& options);
+
+    /**
+     * Starts a new frame at the specified time.
+     *
+     * @return The number of update steps to run in this frame.
+     */
+    auto begin_frame(double now) -> uint32_t;
+
+    /**
+     * Advances the game time by one update step of the current frame.
+     *
+     * @return The game time to pass to the update step.
+     */
+    auto next_update_time() -> const GameTime&;
+
+    /**
+     * Gets the game time of the current frame.
+     */
+    auto game_time() const -> const GameTime&;
+
+    /**
+     * Waits until the next frame is due, according to the target FPS.
+     * Does nothing if no target FPS is set.
+     *
+     * @param clock The clock to measure the time with.
+     * @param sleep The function to sleep with.
+     */
+    void pace_frame(const ClockFunc& clock, const SleepFunc& sleep);
+
+  private:
+    auto fixed_step() const -> double;
+
+    GameLoopOptions       m_options;
+    bool                  m_is_first_frame{true};
+    double                m_previous_time{};
+    double                m_frame_elapsed_time{};
+    double                m_accumulator{};
+    std::optional<double> m_next_frame_time;
+    GameTime              m_game_time;
+};
+} // namespace cer::details
@@ -0,0 +1,499 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "BlockCompression.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+namespace cer::details
+{
+// The RGBA pixels of a 4x4 block, row by row.
+using DecodedBlock = std::array<uint8_t, 4 * 4 * 4>;
+
+using BlockDecodeFunc = void (*)(const uint8_t* block, DecodedBlock& dst);
+
+struct Rgb
+{
+    int r{};
+    int g{};
+    int b{};
+};
+
+static auto clamp_to_byte(int value) -> uint8_t
+{
+    return uint8_t(std::clamp(value, 0, 255));
+}
+
+static void set_pixel(DecodedBlock& dst, size_t x, size_t y, const Rgb& color)
+{
+    auto* pixel = dst.data() + (((y * 4) + x) * 4);
+
+    pixel[0] = clamp_to_byte(color.r);
+    pixel[1] = clamp_to_byte(color.g);
+    pixel[2] = clamp_to_byte(color.b);
+}
+
+static void set_alpha(DecodedBlock& dst, size_t x, size_t y, int alpha)
+{
+    dst[(((y * 4) + x) * 4) + 3] = clamp_to_byte(alpha);
+}
+
+static auto load_le16(const uint8_t* src) -> uint32_t
+{
+    return uint32_t(src[0]) | (uint32_t(src[1]) << 8);
+}
+
+static auto load_le32(const uint8_t* src) -> uint32_t
+{
+    return load_le16(src) | (load_le16(src + 2) << 16);
+}
+
+static auto load_be64(const uint8_t* src) -> uint64_t
+{
+    auto value = uint64_t(0);
+
+    for (size_t i = 0; i < 8; ++i)
+    {
+        value = (value << 8) | src[i];
+    }
+
+    return value;
+}
+
+static auto bits(uint64_t value, int first, int count) -> int
+{
+    return int((value >> first) & ((uint64_t(1) << count) - 1));
+}
+
+static auto extend_bits(int value, int count) -> int
+{
+    return (value << (8 - count)) | (value >> ((2 * count) - 8));
+}
+
+// BC1 / BC3
+
+static auto rgb565(uint32_t value) -> Rgb
+{
+    return {
+        .r = extend_bits(int(value >> 11) & 31, 5),
+        .g = extend_bits(int(value >> 5) & 63, 6),
+        .b = extend_bits(int(value) & 31, 5),
+    };
+}
+
+// BC3 always interpolates four colors, while BC1 switches to three colors and a
+// transparent one when the first endpoint isn't greater than the second.
+static void decode_bc_color_block(const uint8_t* block, DecodedBlock& dst, bool allow_alpha)
+{
+    const auto c0      = load_le16(block);
+    const auto c1      = load_le16(block + 2);
+    const auto indices = load_le32(block + 4);
+    const auto e0      = rgb565(c0);
+    const auto e1      = rgb565(c1);
+
+    auto palette = std::array<Rgb, 4>{e0, e1};
+    auto alpha   = std::array{255, 255, 255, 255};
+
+    if (c0 > c1 || !allow_alpha)
+    {
+        palette[2] = {(2 * e0.r + e1.r) / 3, (2 * e0.g + e1.g) / 3, (2 * e0.b + e1.b) / 3};
+        palette[3] = {(e0.r + 2 * e1.r) / 3, (e0.g + 2 * e1.g) / 3, (e0.b + 2 * e1.b) / 3};
+    }
+    else
+    {
+        palette[2] = {(e0.r + e1.r) / 2, (e0.g + e1.g) / 2, (e0.b + e1.b) / 2};
+        palette[3] = {};
+        alpha[3]   = 0;
+    }
+
+    for (size_t i = 0; i < 16; ++i)
+    {
+        const auto index = (indices >> (i * 2)) & 3;
+
+        set_pixel(dst, i % 4, i / 4, palette[index]);
+        set_alpha(dst, i % 4, i / 4, alpha[index]);
+    }
+}
+
+static void decode_bc1_block(const uint8_t* block, DecodedBlock& dst)
+{
+    decode_bc_color_block(block, dst, true);
+}
+
+static void decode_bc3_block(const uint8_t* block, DecodedBlock& dst)
+{
+    decode_bc_color_block(block + 8, dst, false);
+
+    const auto a0 = int(block[0]);
+    const auto a1 = int(block[1]);
+
+    auto palette = std::array<int, 8>{a0, a1};
+
+    if (a0 > a1)
+    {
+        for (int i = 1; i < 7; ++i)
+        {
+            palette[size_t(i) + 1] = (((7 - i) * a0) + (i * a1)) / 7;
+        }
+    }
+    else
+    {
+        for (int i = 1; i < 5; ++i)
+        {
+            palette[size_t(i) + 1] = (((5 - i) * a0) + (i * a1)) / 5;
+        }
+
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    // 48 bits of 3-bit indices, little-endian.
+    auto indices = uint64_t(0);
+
+    for (size_t i = 0; i < 6; ++i)
+    {
+        indices |= uint64_t(block[2 + i]) << (i * 8);
+    }
+
+    for (size_t i = 0; i < 16; ++i)
+    {
+        set_alpha(dst, i % 4, i / 4, palette[(indices >> (i * 3)) & 7]);
+    }
+}
+
+// ETC2 / EAC
+//
+// Blocks are big-endian, and their pixel indices go column by column.
+
+static constexpr auto s_etc1_modifiers = std::array<std::array<int, 2>, 8>{{
+    {2, 8},
+    {5, 17},
+    {9, 29},
+    {13, 42},
+    {18, 60},
+    {24, 80},
+    {33, 106},
+    {47, 183},
+}};
+
+static constexpr auto s_etc2_distances = std::array{3, 6, 11, 16, 23, 32, 41, 64};
+
+static constexpr auto s_eac_modifiers = std::array<std::array<int, 8>, 16>{{
+    {-3, -6, -9, -15, 2, 5, 8, 14},
+    {-3, -7, -10, -13, 2, 6, 9, 12},
+    {-2, -5, -8, -13, 1, 4, 7, 12},
+    {-2, -4, -6, -13, 1, 3, 5, 12},
+    {-3, -6, -8, -12, 2, 5, 7, 11},
+    {-3, -7, -9, -11, 2, 6, 8, 10},
+    {-4, -7, -8, -11, 3, 6, 7, 10},
+    {-3, -5, -8, -11, 2, 4, 7, 10},
+    {-2, -6, -8, -10, 1, 5, 7, 9},
+    {-2, -5, -8, -10, 1, 4, 7, 9},
+    {-2, -4, -8, -10, 1, 3, 7, 9},
+    {-2, -5, -7, -10, 1, 4, 6, 9},
+    {-3, -4, -7, -10, 2, 3, 6, 9},
+    {-1, -2, -3, -10, 0, 1, 2, 9},
+    {-4, -6, -8, -9, 3, 5, 7, 8},
+    {-3, -5, -7, -9, 2, 4, 6, 8},
+}};
+
+static auto etc_pixel_index(uint64_t block, size_t x, size_t y) -> int
+{
+    const auto i = int((x * 4) + y);
+    return (bits(block, i + 16, 1) << 1) | bits(block, i, 1);
+}
+
+static auto offset(const Rgb& color, int value) -> Rgb
+{
+    return {color.r + value, color.g + value, color.b + value};
+}
+
+static void decode_etc2_t_or_h_mode(uint64_t block, DecodedBlock& dst, bool is_h_mode)
+{
+    auto palette = std::array<Rgb, 4>{};
+
+    if (is_h_mode)
+    {
+        const auto base0 = Rgb{
+            .r = extend_bits(bits(block, 59, 4), 4),
+            .g = extend_bits((bits(block, 56, 3) << 1) | bits(block, 52, 1), 4),
+            .b = extend_bits((bits(block, 51, 1) << 3) | bits(block, 47, 3), 4),
+        };
+
+        const auto base1 = Rgb{
+            .r = extend_bits(bits(block, 43, 4), 4),
+            .g = extend_bits(bits(block, 39, 4), 4),
+            .b = extend_bits(bits(block, 35, 4), 4),
+        };
+
+        // The order of the base colors stores the lowest bit of the distance index.
+        const auto value0 = (base0.r << 16) | (base0.g << 8) | base0.b;
+        const auto value1 = (base1.r << 16) | (base1.g << 8) | base1.b;
+
+        const auto distance_index =
+            (bits(block, 34, 1) << 2) | (bits(block, 32, 1) << 1) | (value0 >= value1 ? 1 : 0);
+
+        const auto distance = s_etc2_distances[size_t(distance_index)];
+
+        palette = {
+            offset(base0, distance),
+            offset(base0, -distance),
+            offset(base1, distance),
+            offset(base1, -distance),
+        };
+    }
+    else
+    {
+        const auto base0 = Rgb{
+            .r = extend_bits((bits(block, 59, 2) << 2) | bits(block, 56, 2), 4),
+            .g = extend_bits(bits(block, 52, 4), 4),
+            .b = extend_bits(bits(block, 48, 4), 4),
+        };
+
+        const auto base1 = Rgb{
+            .r = extend_bits(bits(block, 44, 4), 4),
+            .g = extend_bits(bits(block, 40, 4), 4),
+            .b = extend_bits(bits(block, 36, 4), 4),
+        };
+
+        const auto distance =
+            s_etc2_distances[size_t((bits(block, 34, 2) << 1) | bits(block, 32, 1))];
+
+        palette = {base0, offset(base1, distance), base1, offset(base1, -distance)};
+    }
+
+    for (size_t y = 0; y < 4; ++y)
+    {
+        for (size_t x = 0; x < 4; ++x)
+        {
+            set_pixel(dst, x, y, palette[size_t(etc_pixel_index(block, x, y))]);
+        }
+    }
+}
+
+static void decode_etc2_planar_mode(uint64_t block, DecodedBlock& dst)
+{
+    const auto origin = Rgb{
+        .r = extend_bits(bits(block, 57, 6), 6),
+        .g = extend_bits((bits(block, 56, 1) << 6) | bits(block, 49, 6), 7),
+        .b = extend_bits((bits(block, 48, 1) << 5) | (bits(block, 43, 2) << 3) | bits(block, 39, 3),
+                         6),
+    };
+
+    const auto horizontal = Rgb{
+        .r = extend_bits((bits(block, 34, 5) << 1) | bits(block, 32, 1), 6),
+        .g = extend_bits(bits(block, 25, 7), 7),
+        .b = extend_bits(bits(block, 19, 6), 6),
+    };
+
+    const auto vertical = Rgb{
+        .r = extend_bits(bits(block, 13, 6), 6),
+        .g = extend_bits(bits(block, 6, 7), 7),
+        .b = extend_bits(bits(block, 0, 6), 6),
+    };
+
+    const auto interpolate = [](int o, int h, int v, int x, int y) {
+        return ((x * (h - o)) + (y * (v - o)) + (4 * o) + 2) >> 2;
+    };
+
+    for (int y = 0; y < 4; ++y)
+    {
+        for (int x = 0; x < 4; ++x)
+        {
+            set_pixel(dst,
+                      size_t(x),
+                      size_t(y),
+                      {
+                          .r = interpolate(origin.r, horizontal.r, vertical.r, x, y),
+                          .g = interpolate(origin.g, horizontal.g, vertical.g, x, y),
+                          .b = interpolate(origin.b, horizontal.b, vertical.b, x, y),
+                      });
+        }
+    }
+}
+
+static void decode_etc2_rgb_block(const uint8_t* src, DecodedBlock& dst)
+{
+    const auto block = load_be64(src);
+
+    auto base0 = Rgb{};
+    auto base1 = Rgb{};
+
+    if (bits(block, 33, 1) == 0)
+    {
+        // Individual mode: two 4-bit base colors.
+        base0 = {
+            .r = extend_bits(bits(block, 60, 4), 4),
+            .g = extend_bits(bits(block, 52, 4), 4),
+            .b = extend_bits(bits(block, 44, 4), 4),
+        };
+
+        base1 = {
+            .r = extend_bits(bits(block, 56, 4), 4),
+            .g = extend_bits(bits(block, 48, 4), 4),
+            .b = extend_bits(bits(block, 40, 4), 4),
+        };
+    }
+    else
+    {
+        // Differential mode: a 5-bit base color and a 3-bit signed delta for the second
+        // one. Deltas that overflow select the modes that ETC2 added to ETC1.
+        const auto delta = [&](int first) {
+            const auto value = bits(block, first, 3);
+            return value >= 4 ? value - 8 : value;
+        };
+
+        const auto r = bits(block, 59, 5);
+        const auto g = bits(block, 51, 5);
+        const auto b = bits(block, 43, 5);
+
+        const auto r2 = r + delta(56);
+        const auto g2 = g + delta(48);
+        const auto b2 = b + delta(40);
+
+        if (r2 < 0 || r2 > 31)
+        {
+            decode_etc2_t_or_h_mode(block, dst, false);
+            return;
+        }
+
+        if (g2 < 0 || g2 > 31)
+        {
+            decode_etc2_t_or_h_mode(block, dst, true);
+            return;
+        }
+
+        if (b2 < 0 || b2 > 31)
+        {
+            decode_etc2_planar_mode(block, dst);
+            return;
+        }
+
+        base0 = {extend_bits(r, 5), extend_bits(g, 5), extend_bits(b, 5)};
+        base1 = {extend_bits(r2, 5), extend_bits(g2, 5), extend_bits(b2, 5)};
+    }
+
+    const auto is_flipped = bits(block, 32, 1) != 0;
+    const auto table0     = s_etc1_modifiers[size_t(bits(block, 37, 3))];
+    const auto table1     = s_etc1_modifiers[size_t(bits(block, 34, 3))];
+
+    for (size_t y = 0; y < 4; ++y)
+    {
+        for (size_t x = 0; x < 4; ++x)
+        {
+            // Subblocks are 2x4 side by side, or 4x2 on top of each other when flipped.
+            const auto is_second = is_flipped ? y >= 2 : x >= 2;
+            const auto index     = etc_pixel_index(block, x, y);
+            const auto magnitude = (is_second ? table1 : table0)[size_t(index & 1)];
+            const auto modifier  = (index & 2) != 0 ? -magnitude : magnitude;
+
+            set_pixel(dst, x, y, offset(is_second ? base1 : base0, modifier));
+        }
+    }
+}
+
+static void decode_etc2_rgb8_block(const uint8_t* block, DecodedBlock& dst)
+{
+    decode_etc2_rgb_block(block, dst);
+
+    for (size_t i = 0; i < 16; ++i)
+    {
+        set_alpha(dst, i % 4, i / 4, 255);
+    }
+}
+
+static void decode_etc2_rgba8_block(const uint8_t* block, DecodedBlock& dst)
+{
+    decode_etc2_rgb_block(block + 8, dst);
+
+    const auto alpha      = load_be64(block);
+    const auto base       = bits(alpha, 56, 8);
+    const auto multiplier = bits(alpha, 52, 4);
+    const auto& table     = s_eac_modifiers[size_t(bits(alpha, 48, 4))];
+
+    for (size_t x = 0; x < 4; ++x)
+    {
+        for (size_t y = 0; y < 4; ++y)
+        {
+            const auto index = bits(alpha, 45 - int(((x * 4) + y) * 3), 3);
+            set_alpha(dst, x, y, base + (table[size_t(index)] * multiplier));
+        }
+    }
+}
+
+static auto block_decode_func(ImageFormat format) -> BlockDecodeFunc
+{
+    switch (format)
+    {
+        case ImageFormat::BC1_UNorm:
+        case ImageFormat::BC1_Srgb: return decode_bc1_block;
+        case ImageFormat::BC3_UNorm:
+        case ImageFormat::BC3_Srgb: return decode_bc3_block;
+        case ImageFormat::ETC2_RGB8_UNorm:
+        case ImageFormat::ETC2_RGB8_Srgb: return decode_etc2_rgb8_block;
+        case ImageFormat::ETC2_RGBA8_UNorm:
+        case ImageFormat::ETC2_RGBA8_Srgb: return decode_etc2_rgba8_block;
+        case ImageFormat::R8_UNorm:
+        case ImageFormat::R8G8B8A8_UNorm:
+        case ImageFormat::R8G8B8A8_Srgb:
+        case ImageFormat::R32G32B32A32_Float: break;
+    }
+
+    throw std::invalid_argument{
+        fmt::format("Image format {} is not block-compressed.", image_format_name(format))};
+}
+
+auto decoded_image_format(ImageFormat format) -> ImageFormat
+{
+    switch (format)
+    {
+        case ImageFormat::BC1_Srgb:
+        case ImageFormat::BC3_Srgb:
+        case ImageFormat::ETC2_RGB8_Srgb:
+        case ImageFormat::ETC2_RGBA8_Srgb: return ImageFormat::R8G8B8A8_Srgb;
+        default: return ImageFormat::R8G8B8A8_UNorm;
+    }
+}
+
+auto decode_block_compressed_image(uint32_t    width,
+                                   uint32_t    height,
+                                   ImageFormat format,
+                                   const void* data) -> List<std::byte>
+{
+    const auto decode_block = block_decode_func(format);
+    const auto block_size   = size_t(image_format_bits_per_pixel(format)) * 2;
+    const auto blocks_x     = (width + 3) / 4;
+    const auto blocks_y     = (height + 3) / 4;
+
+    auto result = List<std::byte>(size_t(width) * height * 4);
+    auto block  = DecodedBlock{};
+
+    const auto* src = static_cast<const uint8_t*>(data);
+
+    for (uint32_t by = 0; by < blocks_y; ++by)
+    {
+        for (uint32_t bx = 0; bx < blocks_x; ++bx)
+        {
+            decode_block(src, block);
+            src += block_size;
+
+            // Blocks at the right and bottom edges may be partially outside the image.
+            const auto columns = std::min(width - (bx * 4), 4u);
+            const auto rows    = std::min(height - (by * 4), 4u);
+
+            for (uint32_t y = 0; y < rows; ++y)
+            {
+                std::memcpy(result.data() + ((((size_t(by) * 4) + y) * width) + (bx * 4)) * 4,
+                            block.data() + (size_t(y) * 16),
+                            size_t(columns) * 4);
+            }
+        }
+    }
+
+    return result;
+}
+} // namespace cer::details
@@ -0,0 +1,26 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include "cerlib/Image.hpp"
+#include <cerlib/List.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace cer::details
+{
+// Software decoders for block-compressed images, for systems that can't sample them
+// directly.
+
+// The uncompressed format that a block-compressed format is decoded to.
+auto decoded_image_format(ImageFormat format) -> ImageFormat;
+
+// Decodes a block-compressed image of image_slice_pitch(width, height, format) bytes to
+// 8-bit RGBA pixels.
+auto decode_block_compressed_image(uint32_t    width,
+                                   uint32_t    height,
+                                   ImageFormat format,
+                                   const void* data) -> List<std::byte>;
+} // namespace cer::details
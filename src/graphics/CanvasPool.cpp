@@ -0,0 +1,112 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "CanvasPool.hpp"
+#include "ImageImpl.hpp"
+#include <algorithm>
+
+namespace cer::details
+{
+auto CanvasPool::acquire(uint32_t      width,
+                         uint32_t      height,
+                         ImageFormat   format,
+                         const Window& window,
+                         FrameStats&   stats) -> Image
+{
+    const auto it = std::ranges::find_if(m_entries, [&](const Entry& entry) {
+        return entry.window == window.impl() && entry.canvas.width() == width &&
+               entry.canvas.height() == height && entry.canvas.format() == format &&
+               is_free(entry);
+    });
+
+    if (it != m_entries.end())
+    {
+        ++stats.canvas_pool_hits;
+
+        it->last_used_frame = m_frame;
+
+        // Don't carry state over from whoever used the canvas before.
+        it->canvas.set_canvas_clear_color(std::nullopt);
+
+        return it->canvas;
+    }
+
+    ++stats.canvas_pool_misses;
+
+    auto canvas = Image{width, height, format, window};
+
+    m_entries.push_back(Entry{
+        .canvas          = canvas,
+        .window          = window.impl(),
+        .last_used_frame = m_frame,
+    });
+
+    return canvas;
+}
+
+void CanvasPool::next_frame()
+{
+    // Canvases that are in use count as used in every frame, so that they're only destroyed
+    // once they've actually been free for a while.
+    for (auto& entry : m_entries)
+    {
+        if (!is_free(entry))
+        {
+            entry.last_used_frame = m_frame;
+        }
+    }
+
+    if (m_frame >= m_max_idle_frames)
+    {
+        remove_free_canvases_unused_since(m_frame - m_max_idle_frames);
+    }
+
+    ++m_frame;
+}
+
+auto CanvasPool::max_idle_frames() const -> uint32_t
+{
+    return m_max_idle_frames;
+}
+
+void CanvasPool::set_max_idle_frames(uint32_t value)
+{
+    m_max_idle_frames = value;
+}
+
+void CanvasPool::trim()
+{
+    remove_free_canvases_unused_since(m_frame + 1);
+}
+
+void CanvasPool::remove_canvases_of(const WindowImpl* window)
+{
+    const auto removed = std::ranges::remove(m_entries, window, &Entry::window);
+    m_entries.erase(removed.begin(), removed.end());
+}
+
+void CanvasPool::clear()
+{
+    m_entries.clear();
+}
+
+auto CanvasPool::canvas_count() const -> size_t
+{
+    return m_entries.size();
+}
+
+auto CanvasPool::is_free(const Entry& entry) -> bool
+{
+    return entry.canvas.impl()->ref_count() == 1;
+}
+
+void CanvasPool::remove_free_canvases_unused_since(uint64_t frame)
+{
+    const auto removed = std::ranges::remove_if(m_entries, [frame](const Entry& entry) {
+        return entry.last_used_frame < frame && is_free(entry);
+    });
+
+    m_entries.erase(removed.begin(), removed.end());
+}
+} // namespace cer::details
@@ -0,0 +1,76 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include "cerlib/Drawing.hpp"
+#include "cerlib/Image.hpp"
+#include "cerlib/Window.hpp"
+#include <cerlib/CopyMoveMacros.hpp>
+#include <cerlib/List.hpp>
+
+namespace cer::details
+{
+class WindowImpl;
+
+// Recycles canvases that are only needed for a short while, such as the intermediate
+// canvases of post-processing effects, so that they aren't created every frame.
+//
+// The pool keeps a reference to each of its canvases. A canvas is free as soon as nothing
+// else refers to it, which is how canvases are returned to the pool. Canvases that have been
+// free for more than max_idle_frames() frames are destroyed.
+class CanvasPool final
+{
+  public:
+    static constexpr auto default_max_idle_frames = 60u;
+
+    explicit CanvasPool() = default;
+
+    forbid_copy_and_move(CanvasPool);
+
+    ~CanvasPool() noexcept = default;
+
+    // Gets a free canvas of the specified size and format, creating one if necessary.
+    // Hits and misses are counted in the specified frame stats.
+    auto acquire(uint32_t      width,
+                 uint32_t      height,
+                 ImageFormat   format,
+                 const Window& window,
+                 FrameStats&   stats) -> Image;
+
+    // Advances the pool to the next frame, destroying canvases that have been free for too
+    // long.
+    void next_frame();
+
+    auto max_idle_frames() const -> uint32_t;
+
+    void set_max_idle_frames(uint32_t value);
+
+    // Destroys all canvases that are currently free.
+    void trim();
+
+    void remove_canvases_of(const WindowImpl* window);
+
+    void clear();
+
+    auto canvas_count() const -> size_t;
+
+  private:
+    struct Entry
+    {
+        Image             canvas;
+        const WindowImpl* window{};
+        uint64_t          last_used_frame{};
+    };
+
+    static auto is_free(const Entry& entry) -> bool;
+
+    // Destroys free canvases that haven't been used since the specified frame.
+    void remove_free_canvases_unused_since(uint64_t frame);
+
+    List<Entry> m_entries;
+    uint64_t    m_frame{};
+    uint32_t    m_max_idle_frames{default_max_idle_frames};
+};
+} // namespace cer::details
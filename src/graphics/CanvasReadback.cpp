@@ -0,0 +1,69 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "cerlib/CanvasReadback.hpp"
+#include "graphics/CanvasReadbackImpl.hpp"
+#include "graphics/GraphicsDevice.hpp"
+#include <stdexcept>
+
+namespace cer
+{
+// Waiting for and reading the data uses the graphics API, which only the render thread may
+// do. In pipelined mode, this excludes the game's update() and draw().
+static void verify_render_thread(const details::CanvasReadbackImpl& impl)
+{
+    if (!impl.parent_device().is_render_thread())
+    {
+        throw std::logic_error{"Canvas readbacks can only be accessed on the render thread, "
+                               "which excludes update() and draw() in pipelined mode."};
+    }
+}
+
+CERLIB_IMPLEMENT_OBJECT(CanvasReadback);
+
+auto CanvasReadback::is_ready() const -> bool
+{
+    DECLARE_THIS_IMPL;
+    verify_render_thread(*impl);
+
+    return impl->is_ready();
+}
+
+auto CanvasReadback::width() const -> uint32_t
+{
+    DECLARE_THIS_IMPL;
+    return impl->width();
+}
+
+auto CanvasReadback::height() const -> uint32_t
+{
+    DECLARE_THIS_IMPL;
+    return impl->height();
+}
+
+auto CanvasReadback::size_in_bytes() const -> size_t
+{
+    DECLARE_THIS_IMPL;
+    return impl->size_in_bytes();
+}
+
+void CanvasReadback::read_into(void* destination) const
+{
+    DECLARE_THIS_IMPL;
+    verify_render_thread(*impl);
+
+    impl->read_into(destination);
+}
+
+auto CanvasReadback::read() const -> List<std::byte>
+{
+    DECLARE_THIS_IMPL;
+    verify_render_thread(*impl);
+
+    auto data = List<std::byte>{impl->size_in_bytes()};
+    impl->read_into(data.data());
+
+    return data;
+}
+} // namespace cer
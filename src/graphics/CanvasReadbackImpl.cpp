@@ -0,0 +1,51 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "CanvasReadbackImpl.hpp"
+
+#include "GraphicsDevice.hpp"
+
+namespace cer::details
+{
+CanvasReadbackImpl::CanvasReadbackImpl(GraphicsDevice& parent_device,
+                                       uint32_t        width,
+                                       uint32_t        height,
+                                       ImageFormat     format)
+    : m_parent_device(parent_device)
+    , m_width(width)
+    , m_height(height)
+    , m_format(format)
+{
+}
+
+auto CanvasReadbackImpl::parent_device() const -> const GraphicsDevice&
+{
+    return m_parent_device;
+}
+
+auto CanvasReadbackImpl::width() const -> uint32_t
+{
+    return m_width;
+}
+
+auto CanvasReadbackImpl::height() const -> uint32_t
+{
+    return m_height;
+}
+
+auto CanvasReadbackImpl::format() const -> ImageFormat
+{
+    return m_format;
+}
+
+auto CanvasReadbackImpl::size_in_bytes() const -> size_t
+{
+    return image_slice_pitch(m_width, m_height, m_format);
+}
+
+void CanvasReadbackImpl::on_unreferenced()
+{
+    m_parent_device.destroy_canvas_readback(*this);
+}
+} // namespace cer::details
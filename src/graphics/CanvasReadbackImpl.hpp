@@ -0,0 +1,53 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include "cerlib/Image.hpp"
+#include "util/Object.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace cer::details
+{
+class GraphicsDevice;
+
+class CanvasReadbackImpl : public Object
+{
+  protected:
+    explicit CanvasReadbackImpl(GraphicsDevice& parent_device,
+                                uint32_t        width,
+                                uint32_t        height,
+                                ImageFormat     format);
+
+  public:
+    forbid_copy_and_move(CanvasReadbackImpl);
+
+    ~CanvasReadbackImpl() noexcept override = default;
+
+    auto parent_device() const -> const GraphicsDevice&;
+
+    auto width() const -> uint32_t;
+
+    auto height() const -> uint32_t;
+
+    auto format() const -> ImageFormat;
+
+    auto size_in_bytes() const -> size_t;
+
+    virtual auto is_ready() const -> bool = 0;
+
+    // Waits for the data if it hasn't arrived yet.
+    virtual void read_into(void* destination) = 0;
+
+  protected:
+    void on_unreferenced() override;
+
+  private:
+    GraphicsDevice& m_parent_device;
+    uint32_t        m_width{};
+    uint32_t        m_height{};
+    ImageFormat     m_format{};
+};
+} // namespace cer::details
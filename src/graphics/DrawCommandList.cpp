@@ -0,0 +1,338 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "DrawCommandList.hpp"
+#include "DrawListImpl.hpp"
+#include "GraphicsDevice.hpp"
+#include "cerlib/ParticleSystem.hpp"
+#include "util/narrow_cast.hpp"
+#include <algorithm>
+
+namespace cer::details
+{
+static thread_local DrawCommandList* s_current_list;
+
+auto DrawCommandList::current() -> DrawCommandList*
+{
+    return s_current_list;
+}
+
+template <typename T>
+void DrawCommandList::push_command(CommandKind kind, List<T>& payloads, T payload)
+{
+    m_commands.push_back({
+        .kind          = kind,
+        .payload_index = narrow<uint32_t>(payloads.size()),
+    });
+
+    payloads.push_back(std::move(payload));
+}
+
+void DrawCommandList::begin_recording()
+{
+    begin_recording({}, {}, {}, non_premultiplied);
+}
+
+void DrawCommandList::begin_recording(const Window&     window,
+                                      const FrameStats& frame_stats,
+                                      const Shader&     sprite_shader,
+                                      const BlendState& blend_state)
+{
+    if (m_is_recording)
+    {
+        throw std::logic_error{"The draw list is already recording."};
+    }
+
+    clear();
+
+    m_window        = window;
+    m_window_size   = window ? window.size_px() : Vector2{};
+    m_frame_stats   = frame_stats;
+    m_sprite_shader = sprite_shader;
+    m_blend_state   = blend_state;
+    m_outer_list    = s_current_list;
+    m_is_recording  = true;
+
+    s_current_list = this;
+}
+
+void DrawCommandList::end_recording()
+{
+    if (s_current_list != this)
+    {
+        throw std::logic_error{
+            "The draw list is not the most recently started list on this thread."};
+    }
+
+    s_current_list = m_outer_list;
+    m_outer_list   = nullptr;
+    m_is_recording = false;
+}
+
+auto DrawCommandList::is_recording() const -> bool
+{
+    return m_is_recording;
+}
+
+auto DrawCommandList::window() const -> const Window&
+{
+    return m_window;
+}
+
+auto DrawCommandList::command_count() const -> uint32_t
+{
+    return narrow<uint32_t>(m_commands.size());
+}
+
+void DrawCommandList::clear()
+{
+    m_window = {};
+    m_canvas = {};
+    m_commands.clear();
+    m_scissor_rects.clear();
+    m_strings.clear();
+
+    m_canvases.clear();
+    m_scissor_rect_ranges.clear();
+    m_transformations.clear();
+    m_sprite_shaders.clear();
+    m_samplers.clear();
+    m_blend_states.clear();
+    m_sprites.clear();
+    m_draw_string_cmds.clear();
+    m_draw_text_cmds.clear();
+    m_fill_rectangle_cmds.clear();
+    m_text_cache_capacities.clear();
+    m_lists.clear();
+}
+
+void DrawCommandList::set_canvas(const Image& canvas)
+{
+    m_canvas = canvas;
+    push_command(CommandKind::SetCanvas, m_canvases, canvas);
+}
+
+void DrawCommandList::set_scissor_rects(std::span<const Rectangle> scissor_rects)
+{
+    push_command(CommandKind::SetScissorRects,
+                 m_scissor_rect_ranges,
+                 SetScissorRectsCmd{
+                     .offset = narrow<uint32_t>(m_scissor_rects.size()),
+                     .count  = narrow<uint32_t>(scissor_rects.size()),
+                 });
+
+    m_scissor_rects.insert(m_scissor_rects.end(), scissor_rects.begin(), scissor_rects.end());
+}
+
+void DrawCommandList::set_transformation(const Matrix& transformation)
+{
+    push_command(CommandKind::SetTransformation, m_transformations, transformation);
+}
+
+void DrawCommandList::set_sprite_shader(const Shader& shader)
+{
+    m_sprite_shader = shader;
+    push_command(CommandKind::SetSpriteShader, m_sprite_shaders, shader);
+}
+
+void DrawCommandList::set_sampler(const Sampler& sampler)
+{
+    push_command(CommandKind::SetSampler, m_samplers, sampler);
+}
+
+void DrawCommandList::set_blend_state(const BlendState& blend_state)
+{
+    m_blend_state = blend_state;
+    push_command(CommandKind::SetBlendState, m_blend_states, blend_state);
+}
+
+void DrawCommandList::draw_sprite(const Sprite& sprite)
+{
+    push_command(CommandKind::DrawSprite, m_sprites, sprite);
+}
+
+void DrawCommandList::draw_string(std::string_view                     text,
+                                  const Font&                          font,
+                                  uint32_t                             font_size,
+                                  Vector2                              position,
+                                  Color                                color,
+                                  const std::optional<TextDecoration>& decoration)
+{
+    // Strings are only shaped when the list is replayed, since shaping may have to
+    // rasterize glyphs into the font's atlas images.
+    push_command(CommandKind::DrawString,
+                 m_draw_string_cmds,
+                 DrawStringCmd{
+                     .text_offset = narrow<uint32_t>(m_strings.size()),
+                     .text_length = narrow<uint32_t>(text.size()),
+                     .font        = font,
+                     .font_size   = font_size,
+                     .position    = position,
+                     .color       = color,
+                     .decoration  = decoration,
+                 });
+
+    m_strings += text;
+}
+
+void DrawCommandList::draw_text(const Text& text, Vector2 position, Color color)
+{
+    push_command(CommandKind::DrawText,
+                 m_draw_text_cmds,
+                 DrawTextCmd{
+                     .text     = text,
+                     .position = position,
+                     .color    = color,
+                 });
+}
+
+void DrawCommandList::fill_rectangle(Rectangle rectangle,
+                                     Color     color,
+                                     float     rotation,
+                                     Vector2   origin)
+{
+    push_command(CommandKind::FillRectangle,
+                 m_fill_rectangle_cmds,
+                 FillRectangleCmd{
+                     .rectangle = rectangle,
+                     .color     = color,
+                     .rotation  = rotation,
+                     .origin    = origin,
+                 });
+}
+
+void DrawCommandList::draw_particles(const ParticleSystem& particle_system)
+{
+    // The particles are captured now, because the system may already be updated for the
+    // next frame by the time this list is replayed.
+    const auto previous_blend_state = m_blend_state;
+
+    for (const auto& emitter_data : particle_system.m_emitters)
+    {
+        const auto& emitter = emitter_data.emitter;
+        const auto& image   = emitter.image;
+
+        if (!image)
+        {
+            continue;
+        }
+
+        set_blend_state(emitter.blend_state);
+
+        const auto image_size = image.size();
+
+        auto sprite = Sprite{
+            .image  = image,
+            .origin = image_size * 0.5f,
+        };
+
+        const auto particles_span =
+            std::span{emitter_data.particle_buffer.data(), emitter_data.active_particle_count};
+
+        for (const auto& particle : particles_span)
+        {
+            sprite.dst_rect = {particle.position, image_size * particle.scale};
+            sprite.color    = particle.color;
+            sprite.rotation = particle.rotation;
+
+            draw_sprite(sprite);
+        }
+    }
+
+    set_blend_state(previous_blend_state);
+}
+
+void DrawCommandList::set_text_cache_capacity(uint32_t capacity)
+{
+    push_command(CommandKind::SetTextCacheCapacity, m_text_cache_capacities, capacity);
+}
+
+void DrawCommandList::draw_list(const DrawList& list)
+{
+    push_command(CommandKind::DrawList, m_lists, list);
+}
+
+auto DrawCommandList::current_canvas() const -> const Image&
+{
+    return m_canvas;
+}
+
+auto DrawCommandList::current_sprite_shader() const -> const Shader&
+{
+    return m_sprite_shader;
+}
+
+auto DrawCommandList::current_blend_state() const -> const BlendState&
+{
+    return m_blend_state;
+}
+
+auto DrawCommandList::current_canvas_size() const -> Vector2
+{
+    return m_canvas ? m_canvas.size() : m_window_size;
+}
+
+auto DrawCommandList::frame_stats() const -> const FrameStats&
+{
+    return m_frame_stats;
+}
+
+auto DrawCommandList::draws_list(const DrawCommandList& list) const -> bool
+{
+    return std::ranges::any_of(m_lists, [&list](const DrawList& drawn_list) {
+        const auto& commands = drawn_list.impl()->commands();
+        return &commands == &list || commands.draws_list(list);
+    });
+}
+
+void DrawCommandList::replay(GraphicsDevice& device) const
+{
+    for (const auto [kind, index] : m_commands)
+    {
+        switch (kind)
+        {
+            case CommandKind::SetCanvas: device.set_canvas(m_canvases[index], false); break;
+            case CommandKind::SetScissorRects: {
+                const auto [offset, count] = m_scissor_rect_ranges[index];
+                device.set_scissor_rects(std::span{m_scissor_rects}.subspan(offset, count));
+                break;
+            }
+            case CommandKind::SetTransformation:
+                device.set_transformation(m_transformations[index]);
+                break;
+            case CommandKind::SetSpriteShader:
+                device.set_sprite_shader(m_sprite_shaders[index]);
+                break;
+            case CommandKind::SetSampler: device.set_sampler(m_samplers[index]); break;
+            case CommandKind::SetBlendState: device.set_blend_state(m_blend_states[index]); break;
+            case CommandKind::DrawSprite: device.draw_sprite(m_sprites[index]); break;
+            case CommandKind::DrawString: {
+                const auto& cmd = m_draw_string_cmds[index];
+                device.draw_string(
+                    std::string_view{m_strings}.substr(cmd.text_offset, cmd.text_length),
+                    cmd.font,
+                    cmd.font_size,
+                    cmd.position,
+                    cmd.color,
+                    cmd.decoration);
+                break;
+            }
+            case CommandKind::DrawText: {
+                const auto& cmd = m_draw_text_cmds[index];
+                device.draw_text(cmd.text, cmd.position, cmd.color);
+                break;
+            }
+            case CommandKind::FillRectangle: {
+                const auto& cmd = m_fill_rectangle_cmds[index];
+                device.fill_rectangle(cmd.rectangle, cmd.color, cmd.rotation, cmd.origin);
+                break;
+            }
+            case CommandKind::SetTextCacheCapacity:
+                device.set_text_cache_capacity(m_text_cache_capacities[index]);
+                break;
+            case CommandKind::DrawList: m_lists[index].impl()->commands().replay(device); break;
+        }
+    }
+}
+} // namespace cer::details
@@ -0,0 +1,218 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include "cerlib/BlendState.hpp"
+#include "cerlib/DrawList.hpp"
+#include "cerlib/Drawing.hpp"
+#include "cerlib/Font.hpp"
+#include "cerlib/Image.hpp"
+#include "cerlib/Matrix.hpp"
+#include "cerlib/Rectangle.hpp"
+#include "cerlib/Sampler.hpp"
+#include "cerlib/Shader.hpp"
+#include "cerlib/Text.hpp"
+#include "cerlib/Window.hpp"
+#include <cerlib/List.hpp>
+#include <optional>
+#include <span>
+#include <string>
+
+namespace cer::details
+{
+class GraphicsDevice;
+
+/**
+ * Records draw and state commands into a linear list, so that they can be replayed
+ * later, possibly on another thread. Backs both the frames of pipelined mode and
+ * public DrawList objects.
+ *
+ * While a list is recording on a thread, the public drawing functions that are called on
+ * that thread are routed to the list instead of the graphics device (see current()).
+ * Lists can be recorded while another list is recording; the previous list becomes
+ * current again when the nested list ends recording.
+ * The list keeps track of the state it records, so that queries such as current_canvas()
+ * can be answered without touching the graphics device.
+ */
+class DrawCommandList final
+{
+  public:
+    DrawCommandList() = default;
+
+    /**
+     * Gets the list that is currently recording on the calling thread, if any.
+     */
+    static auto current() -> DrawCommandList*;
+
+    /**
+     * Clears the list and starts recording the calling thread's drawing functions into it,
+     * without a window, e.g. for a DrawList.
+     */
+    void begin_recording();
+
+    /**
+     * Clears the list and starts recording the calling thread's drawing functions into it.
+     *
+     * @param window The window the frame is recorded for.
+     * @param frame_stats The statistics of the previously rendered frame, which are
+     * reported by frame_stats() while recording.
+     * @param sprite_shader The sprite shader that is active when the frame starts.
+     * @param blend_state The blend state that is active when the frame starts.
+     */
+    void begin_recording(const Window&     window,
+                         const FrameStats& frame_stats,
+                         const Shader&     sprite_shader,
+                         const BlendState& blend_state);
+
+    void end_recording();
+
+    auto is_recording() const -> bool;
+
+    auto window() const -> const Window&;
+
+    auto command_count() const -> uint32_t;
+
+    void clear();
+
+    void set_canvas(const Image& canvas);
+
+    void set_scissor_rects(std::span<const Rectangle> scissor_rects);
+
+    void set_transformation(const Matrix& transformation);
+
+    void set_sprite_shader(const Shader& shader);
+
+    void set_sampler(const Sampler& sampler);
+
+    void set_blend_state(const BlendState& blend_state);
+
+    void draw_sprite(const Sprite& sprite);
+
+    void draw_string(std::string_view                     text,
+                     const Font&                          font,
+                     uint32_t                             font_size,
+                     Vector2                              position,
+                     Color                                color,
+                     const std::optional<TextDecoration>& decoration);
+
+    void draw_text(const Text& text, Vector2 position, Color color);
+
+    void fill_rectangle(Rectangle rectangle, Color color, float rotation, Vector2 origin);
+
+    void draw_particles(const ParticleSystem& particle_system);
+
+    void set_text_cache_capacity(uint32_t capacity);
+
+    void draw_list(const DrawList& list);
+
+    auto current_canvas() const -> const Image&;
+
+    auto current_sprite_shader() const -> const Shader&;
+
+    auto current_blend_state() const -> const BlendState&;
+
+    auto current_canvas_size() const -> Vector2;
+
+    auto frame_stats() const -> const FrameStats&;
+
+    /**
+     * Gets a value indicating whether this list draws another list, either directly or
+     * through the lists that it draws.
+     */
+    auto draws_list(const DrawCommandList& list) const -> bool;
+
+    /**
+     * Submits all recorded commands to a graphics device, in the order they were recorded.
+     */
+    void replay(GraphicsDevice& device) const;
+
+  private:
+    // Commands only store their kind and the index of their payload, which lives in a
+    // separate list per kind. This keeps frequent, small commands such as sprites from
+    // occupying as much space as the largest kind of command.
+    enum class CommandKind : uint8_t
+    {
+        SetCanvas,
+        SetScissorRects,
+        SetTransformation,
+        SetSpriteShader,
+        SetSampler,
+        SetBlendState,
+        DrawSprite,
+        DrawString,
+        DrawText,
+        FillRectangle,
+        SetTextCacheCapacity,
+        DrawList,
+    };
+
+    struct Command
+    {
+        CommandKind kind{};
+        uint32_t    payload_index{};
+    };
+
+    struct SetScissorRectsCmd
+    {
+        uint32_t offset{};
+        uint32_t count{};
+    };
+
+    struct DrawStringCmd
+    {
+        uint32_t                      text_offset{};
+        uint32_t                      text_length{};
+        Font                          font;
+        uint32_t                      font_size{};
+        Vector2                       position;
+        Color                         color;
+        std::optional<TextDecoration> decoration;
+    };
+
+    struct DrawTextCmd
+    {
+        Text    text;
+        Vector2 position;
+        Color   color;
+    };
+
+    struct FillRectangleCmd
+    {
+        Rectangle rectangle;
+        Color     color;
+        float     rotation{};
+        Vector2   origin;
+    };
+
+    template <typename T>
+    void push_command(CommandKind kind, List<T>& payloads, T payload);
+
+    DrawCommandList* m_outer_list{};
+    bool             m_is_recording{};
+    Window           m_window;
+    Vector2          m_window_size;
+    FrameStats       m_frame_stats;
+    Image            m_canvas;
+    Shader           m_sprite_shader;
+    BlendState       m_blend_state = non_premultiplied;
+    List<Command>    m_commands;
+    List<Rectangle>  m_scissor_rects;
+    std::string      m_strings;
+
+    // Command payloads
+    List<Image>              m_canvases;
+    List<SetScissorRectsCmd> m_scissor_rect_ranges;
+    List<Matrix>             m_transformations;
+    List<Shader>             m_sprite_shaders;
+    List<Sampler>            m_samplers;
+    List<BlendState>         m_blend_states;
+    List<Sprite>             m_sprites;
+    List<DrawStringCmd>      m_draw_string_cmds;
+    List<DrawTextCmd>        m_draw_text_cmds;
+    List<FillRectangleCmd>   m_fill_rectangle_cmds;
+    List<uint32_t>           m_text_cache_capacities;
+    List<DrawList>           m_lists;
+};
+} // namespace cer::details
@@ -0,0 +1,89 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "cerlib/DrawList.hpp"
+#include "graphics/DrawListImpl.hpp"
+#include "graphics/GraphicsDevice.hpp"
+#include "game/GameImpl.hpp"
+
+namespace cer
+{
+CERLIB_IMPLEMENT_OBJECT(DrawList);
+
+auto DrawList::create() -> DrawList
+{
+    auto list = DrawList{};
+    auto impl = std::make_unique<details::DrawListImpl>();
+
+    set_impl(list, impl.release());
+
+    return list;
+}
+
+void DrawList::begin_recording()
+{
+    DECLARE_THIS_IMPL;
+    impl->commands().begin_recording();
+}
+
+void DrawList::end_recording()
+{
+    DECLARE_THIS_IMPL;
+    impl->commands().end_recording();
+}
+
+auto DrawList::is_recording() const -> bool
+{
+    DECLARE_THIS_IMPL;
+    return impl->commands().is_recording();
+}
+
+auto DrawList::command_count() const -> uint32_t
+{
+    DECLARE_THIS_IMPL;
+    return impl->commands().command_count();
+}
+
+void DrawList::clear()
+{
+    DECLARE_THIS_IMPL;
+
+    if (impl->commands().is_recording())
+    {
+        throw std::logic_error{"A draw list cannot be cleared while it is recording."};
+    }
+
+    impl->commands().clear();
+}
+} // namespace cer
+
+void cer::draw_list(const DrawList& list)
+{
+    if (!list)
+    {
+        return;
+    }
+
+    if (list.is_recording())
+    {
+        throw std::logic_error{"A draw list cannot be drawn while it is recording."};
+    }
+
+    if (auto* recording_list = details::DrawCommandList::current())
+    {
+        // The list is recorded by reference, so a list that draws the recording list
+        // would draw itself endlessly and keep itself alive.
+        if (list.impl()->commands().draws_list(*recording_list))
+        {
+            throw std::logic_error{"A draw list cannot draw itself, neither directly nor "
+                                   "through the lists that it draws."};
+        }
+
+        recording_list->draw_list(list);
+        return;
+    }
+
+    LOAD_DEVICE_IMPL;
+    list.impl()->commands().replay(device_impl);
+}
@@ -0,0 +1,18 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "DrawListImpl.hpp"
+
+namespace cer::details
+{
+auto DrawListImpl::commands() -> DrawCommandList&
+{
+    return m_commands;
+}
+
+auto DrawListImpl::commands() const -> const DrawCommandList&
+{
+    return m_commands;
+}
+} // namespace cer::details
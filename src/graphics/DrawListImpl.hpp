@@ -0,0 +1,24 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include "graphics/DrawCommandList.hpp"
+#include "util/Object.hpp"
+
+namespace cer::details
+{
+class DrawListImpl final : public Object
+{
+  public:
+    DrawListImpl() = default;
+
+    auto commands() -> DrawCommandList&;
+
+    auto commands() const -> const DrawCommandList&;
+
+  private:
+    DrawCommandList m_commands;
+};
+} // namespace cer::details
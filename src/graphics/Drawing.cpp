@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in LICENSE.
 
 #include "cerlib/Drawing.hpp"
+#include "DrawCommandList.hpp"
 #include "FontImpl.hpp"
 #include "GraphicsDevice.hpp"
 #include "cerlib/Font.hpp"
@@ -19,12 +20,23 @@
 
 void cer::set_scissor_rects(std::span<const Rectangle> scissor_rects)
 {
+    if (auto* list = details::DrawCommandList::current())
+    {
+        list->set_scissor_rects(scissor_rects);
+        return;
+    }
+
     LOAD_DEVICE_IMPL;
     device_impl.set_scissor_rects(scissor_rects);
 }
 
 auto cer::current_canvas() -> Image
 {
+    if (auto* list = details::DrawCommandList::current())
+    {
+        return list->current_canvas();
+    }
+
     LOAD_DEVICE_IMPL;
     return device_impl.current_canvas();
 }
@@ -36,36 +48,71 @@ void cer::set_canvas(const Image& canvas)
         throw std::invalid_argument{"The specified image is not a canvas."};
     }
 
+    if (auto* list = details::DrawCommandList::current())
+    {
+        list->set_canvas(canvas);
+        return;
+    }
+
     LOAD_DEVICE_IMPL;
     device_impl.set_canvas(canvas, false);
 }
 
 void cer::set_transformation(const Matrix& transformation)
 {
+    if (auto* list = details::DrawCommandList::current())
+    {
+        list->set_transformation(transformation);
+        return;
+    }
+
     LOAD_DEVICE_IMPL;
     device_impl.set_transformation(transformation);
 }
 
 auto cer::current_sprite_shader() -> Shader
 {
+    if (auto* list = details::DrawCommandList::current())
+    {
+        return list->current_sprite_shader();
+    }
+
     LOAD_DEVICE_IMPL;
     return device_impl.current_sprite_shader();
 }
 
 auto cer::set_sprite_shader(const Shader& shader) -> void
 {
+    if (auto* list = details::DrawCommandList::current())
+    {
+        list->set_sprite_shader(shader);
+        return;
+    }
+
     LOAD_DEVICE_IMPL;
     device_impl.set_sprite_shader(shader);
 }
 
 void cer::set_sampler(const Sampler& sampler)
 {
+    if (auto* list = details::DrawCommandList::current())
+    {
+        list->set_sampler(sampler);
+        return;
+    }
+
     LOAD_DEVICE_IMPL;
     device_impl.set_sampler(sampler);
 }
 
 void cer::set_blend_state(const BlendState& blend_state)
 {
+    if (auto* list = details::DrawCommandList::current())
+    {
+        list->set_blend_state(blend_state);
+        return;
+    }
+
     LOAD_DEVICE_IMPL;
     device_impl.set_blend_state(blend_state);
 }
@@ -77,9 +124,7 @@ void cer::draw_sprite(const Image& image, Vector2 position, Color color)
         return;
     }
 
-    LOAD_DEVICE_IMPL;
-
-    device_impl.draw_sprite(Sprite{
+    draw_sprite(Sprite{
         .image    = image,
         .dst_rect = {position, image.size()},
         .color    = color,
@@ -93,6 +138,12 @@ void cer::draw_sprite(const Sprite& sprite)
         return;
     }
 
+    if (auto* list = details::DrawCommandList::current())
+    {
+        list->draw_sprite(sprite);
+        return;
+    }
+
     LOAD_DEVICE_IMPL;
     device_impl.draw_sprite(sprite);
 }
@@ -104,42 +155,90 @@ void cer::draw_string(std::string_view                     text,
                       Color                                color,
                       const std::optional<TextDecoration>& decoration)
 {
+    if (auto* list = details::DrawCommandList::current())
+    {
+        list->draw_string(text, font, font_size, position, color, decoration);
+        return;
+    }
+
     LOAD_DEVICE_IMPL;
     device_impl.draw_string(text, font, font_size, position, color, decoration);
 }
 
+void cer::set_text_cache_capacity(uint32_t capacity)
+{
+    if (auto* list = details::DrawCommandList::current())
+    {
+        list->set_text_cache_capacity(capacity);
+        return;
+    }
+
+    LOAD_DEVICE_IMPL;
+    device_impl.set_text_cache_capacity(capacity);
+}
+
 void cer::draw_text(const Text& text, Vector2 position, const Color& color)
 {
+    if (auto* list = details::DrawCommandList::current())
+    {
+        list->draw_text(text, position, color);
+        return;
+    }
+
     LOAD_DEVICE_IMPL;
     device_impl.draw_text(text, position, color);
 }
 
 void cer::fill_rectangle(Rectangle rectangle, Color color, float rotation, Vector2 origin)
 {
+    if (auto* list = details::DrawCommandList::current())
+    {
+        list->fill_rectangle(rectangle, color, rotation, origin);
+        return;
+    }
+
     LOAD_DEVICE_IMPL;
     device_impl.fill_rectangle(rectangle, color, rotation, origin);
 }
 
 void cer::draw_particles(const ParticleSystem& particle_system)
 {
+    if (auto* list = details::DrawCommandList::current())
+    {
+        list->draw_particles(particle_system);
+        return;
+    }
+
     LOAD_DEVICE_IMPL;
     device_impl.draw_particles(particle_system);
 }
 
 auto cer::frame_stats() -> FrameStats
 {
+    if (auto* list = details::DrawCommandList::current())
+    {
+        return list->frame_stats();
+    }
+
     LOAD_DEVICE_IMPL;
     return device_impl.frame_stats_ref();
 }
 
 auto cer::current_canvas_size() -> Vector2
 {
+    if (auto* list = details::DrawCommandList::current())
+    {
+        return list->current_canvas_size();
+    }
+
     LOAD_DEVICE_IMPL;
     return device_impl.current_canvas_size();
 }
 
-void cer::read_canvas_data_into(
-    const Image& canvas, uint32_t x, uint32_t y, uint32_t width, uint32_t height, void* destination)
+namespace cer::details
+{
+static void verify_canvas_readable(
+    const Image& canvas, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
 {
     if (!canvas)
     {
@@ -151,6 +250,12 @@ void cer::read_canvas_data_into(
         throw std::invalid_argument{"The specified image does not represent a canvas."};
     }
 
+    if (DrawCommandList::current() != nullptr)
+    {
+        throw std::logic_error{"Canvas data cannot be read while the frame is being recorded "
+                               "for pipelined rendering."};
+    }
+
     if (canvas == current_canvas())
     {
         throw std::logic_error{"The specified canvas is currently being drawn to. Please "
@@ -179,6 +284,57 @@ void cer::read_canvas_data_into(
                         height,
                         canvas_height)};
     }
+}
+
+// The canvas pool isn't synchronized. In pipelined mode, the game's update() and draw() run
+// on a worker thread, which must leave the pool to the render thread.
+static void verify_canvas_pool_access(const GraphicsDevice& device_impl)
+{
+    if (!device_impl.is_render_thread())
+    {
+        throw std::logic_error{"The canvas pool can only be used on the render thread, which "
+                               "excludes update() and draw() in pipelined mode."};
+    }
+}
+} // namespace cer::details
+
+auto cer::acquire_canvas(uint32_t width, uint32_t height, ImageFormat format, const Window& window)
+    -> Image
+{
+    if (details::DrawCommandList::current() != nullptr)
+    {
+        throw std::logic_error{"Canvases cannot be acquired while the frame is being recorded "
+                               "for pipelined rendering."};
+    }
+
+    LOAD_DEVICE_IMPL;
+    details::verify_canvas_pool_access(device_impl);
+
+    return device_impl.canvas_pool().acquire(width,
+                                             height,
+                                             format,
+                                             window,
+                                             device_impl.frame_stats_ref());
+}
+
+void cer::set_canvas_pool_max_idle_frames(uint32_t frame_count)
+{
+    LOAD_DEVICE_IMPL;
+    details::verify_canvas_pool_access(device_impl);
+    device_impl.canvas_pool().set_max_idle_frames(frame_count);
+}
+
+void cer::trim_canvas_pool()
+{
+    LOAD_DEVICE_IMPL;
+    details::verify_canvas_pool_access(device_impl);
+    device_impl.canvas_pool().trim();
+}
+
+void cer::read_canvas_data_into(
+    const Image& canvas, uint32_t x, uint32_t y, uint32_t width, uint32_t height, void* destination)
+{
+    details::verify_canvas_readable(canvas, x, y, width, height);
 
     LOAD_DEVICE_IMPL;
 
@@ -212,6 +368,18 @@ auto cer::read_canvas_data(
     return data;
 }
 
+auto cer::read_canvas_data_async(
+    const Image& canvas, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+    -> CanvasReadback
+{
+    details::verify_canvas_readable(canvas, x, y, width, height);
+
+    LOAD_DEVICE_IMPL;
+
+    return CanvasReadback{
+        device_impl.read_canvas_data_async(canvas, x, y, width, height).release()};
+}
+
 void cer::save_canvas_to_file(const Image&     canvas,
                               std::string_view filename,
                               ImageFileFormat  format)
@@ -1,7 +1,19 @@
 set(graphics_files
+  BlockCompression.cpp
+  BlockCompression.hpp
   CBufferPacker.cpp
   CBufferPacker.hpp
+  CanvasPool.cpp
+  CanvasPool.hpp
+  CanvasReadback.cpp
+  CanvasReadbackImpl.cpp
+  CanvasReadbackImpl.hpp
+  DrawCommandList.cpp
+  DrawCommandList.hpp
   Drawing.cpp
+  DrawList.cpp
+  DrawListImpl.cpp
+  DrawListImpl.hpp
   Font.cpp
   FontImpl.cpp
   FontImpl.hpp
@@ -13,11 +25,15 @@ set(graphics_files
   Image.cpp
   ImageImpl.cpp
   ImageImpl.hpp
+  Mipmaps.cpp
+  Mipmaps.hpp
   ParticleSystem.cpp
   Shader.cpp
   ShaderImpl.cpp
   ShaderImpl.hpp
   ShaderParameter.hpp
+  ShapedTextCache.cpp
+  ShapedTextCache.hpp
   SpriteBatch.cpp
   SpriteBatch.hpp
   Tessellation2D.cpp
@@ -21,35 +21,30 @@ static std::unique_ptr<FontImpl> s_built_in_font_regular;
 static std::unique_ptr<FontImpl> s_built_in_font_bold;
 
 FontImpl::FontImpl(std::span<const std::byte> data, bool create_copy_of_data)
-    : m_owns_font_data(create_copy_of_data)
 {
-    if (m_owns_font_data)
+    if (create_copy_of_data)
     {
-        m_font_data = std::make_unique<std::byte[]>(data.size()).release();
-        std::memcpy(m_font_data, data.data(), data.size());
+        auto copy = std::make_unique<std::byte[]>(data.size());
+        std::memcpy(copy.get(), data.data(), data.size());
+        m_font_data_owner = std::move(copy);
+        m_font_data       = m_font_data_owner.get();
     }
     else
     {
-        m_font_data = const_cast<std::byte*>(data.data()); // NOLINT
+        m_font_data = data.data();
     }
 
     initialize();
 }
 
-FontImpl::FontImpl(std::unique_ptr<std::byte[]> data)
-    : m_font_data(data.release())
-    , m_owns_font_data(true)
+FontImpl::FontImpl(std::shared_ptr<const std::byte[]> data)
+    : m_font_data_owner(std::move(data))
+    , m_font_data(m_font_data_owner.get())
 {
     initialize();
 }
 
-FontImpl::~FontImpl() noexcept
-{
-    if (m_owns_font_data)
-    {
-        delete[] m_font_data;
-    }
-}
+FontImpl::~FontImpl() noexcept = default;
 
 void FontImpl::create_built_in_fonts()
 {
@@ -148,6 +143,11 @@ auto FontImpl::line_height(uint32_t size) const -> float
     return float(ascent - descent + line_gap);
 }
 
+auto FontImpl::atlas_version() const -> uint64_t
+{
+    return m_atlas_version;
+}
+
 void FontImpl::initialize()
 {
     if (stbtt_InitFont(&m_font_info, reinterpret_cast<const unsigned char*>(m_font_data), 0) == 0)
@@ -259,6 +259,8 @@ void FontImpl::update_page_atlas_image(FontPage& page)
 {
     log_verbose("Updating font page image of size {}x{}", page.width, page.height);
 
+    ++m_atlas_version;
+
     if (!page.atlas)
     {
         log_verbose("  Reallocating page image");
@@ -45,7 +45,7 @@ class FontImpl final : public Object, public Asset
 
     explicit FontImpl(std::span<const std::byte> data, bool create_copy_of_data);
 
-    explicit FontImpl(std::unique_ptr<std::byte[]> data);
+    explicit FontImpl(std::shared_ptr<const std::byte[]> data);
 
     ~FontImpl() noexcept override;
 
@@ -197,6 +197,10 @@ class FontImpl final : public Object, public Asset
 
     auto line_height(uint32_t size) const -> float;
 
+    // Incremented whenever one of the font's page images is created or updated.
+    // Used by retained Text objects to detect when their cached vertex data is stale.
+    auto atlas_version() const -> uint64_t;
+
   private:
     struct RasterizedGlyphKey
     {
@@ -232,18 +236,20 @@ class FontImpl final : public Object, public Asset
 
     void append_new_page();
 
-    static void update_page_atlas_image(FontPage& page);
-
-    std::byte*                   m_font_data{};
-    bool                         m_owns_font_data{};
-    stbtt_fontinfo               m_font_info{};
-    int                          m_ascent{};
-    int                          m_descent{};
-    int                          m_line_gap{};
-    RasterizedGlyphsMap          m_rasterized_glyphs;
-    List<FontPage>               m_pages;
-    List<FontPage>::iterator     m_current_page_iterator;
-    std::unordered_set<uint32_t> m_initialized_sizes;
-    std::unordered_set<size_t>   m_page_images_to_update;
+    void update_page_atlas_image(FontPage& page);
+
+    // Keeps m_font_data alive, unless the font doesn't own its data (built-in fonts).
+    std::shared_ptr<const std::byte[]> m_font_data_owner;
+    const std::byte*                   m_font_data{};
+    stbtt_fontinfo                     m_font_info{};
+    int                                m_ascent{};
+    int                                m_descent{};
+    int                                m_line_gap{};
+    RasterizedGlyphsMap                m_rasterized_glyphs;
+    List<FontPage>                     m_pages;
+    List<FontPage>::iterator           m_current_page_iterator;
+    std::unordered_set<uint32_t>       m_initialized_sizes;
+    std::unordered_set<size_t>         m_page_images_to_update;
+    uint64_t                           m_atlas_version{};
 };
 } // namespace cer::details
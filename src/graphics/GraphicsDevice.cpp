@@ -23,13 +23,15 @@
 #include "shadercompiler/Type.hpp"
 #include "shadercompiler/TypeCache.hpp"
 #include "util/StringViewUnorderedSet.hpp"
+#include <array>
 #include <cassert>
 #include <ranges>
 
 namespace cer::details
 {
 GraphicsDevice::GraphicsDevice()
-    : m_must_flush_draw_calls(false)
+    : m_render_thread_id(std::this_thread::get_id())
+    , m_must_flush_draw_calls(false)
     , m_blend_state(non_premultiplied)
     , m_sampler(linear_clamp)
 {
@@ -38,24 +40,101 @@ GraphicsDevice::GraphicsDevice()
 
 void GraphicsDevice::notify_resource_created(GraphicsResourceImpl& resource)
 {
-    [[maybe_unused]] const auto it = std::ranges::find_if(m_resources, [&resource](const auto& e) {
-        return &e.get() == &resource;
-    });
+    // Resources know their index in the list, which makes adding and removing them O(1),
+    // no matter how many resources are alive.
+    resource.m_index_in_device = m_resources.size();
+    m_resources.push_back(&resource);
+}
+
+void GraphicsDevice::notify_resource_destroyed(GraphicsResourceImpl& resource)
+{
+    const auto index = resource.m_index_in_device;
 
-    assert(it == m_resources.cend());
+    assert(index < m_resources.size() && m_resources[index] == &resource);
 
-    m_resources.push_back(resource);
+    // Fill the gap with the last resource.
+    auto* last_resource = m_resources.back();
+
+    last_resource->m_index_in_device = index;
+    m_resources[index]               = last_resource;
+    m_resources.pop_back();
 }
 
-void GraphicsDevice::notify_resource_destroyed(GraphicsResourceImpl& resource)
+void GraphicsDevice::destroy_resource(GraphicsResourceImpl& resource)
+{
+    {
+        const auto lock = std::scoped_lock{m_released_resources_mutex};
+
+        // The content manager may have handed out a released resource again, in which
+        // case it's already in the list.
+        if (resource.m_is_awaiting_destruction)
+        {
+            return;
+        }
+
+        if (!is_render_thread())
+        {
+            resource.m_is_awaiting_destruction = true;
+            m_released_resources.push_back(&resource);
+            return;
+        }
+    }
+
+    delete &resource;
+}
+
+void GraphicsDevice::destroy_retained_text_data(std::unique_ptr<RetainedTextData> data)
+{
+    if (!is_render_thread())
+    {
+        const auto lock = std::scoped_lock{m_released_resources_mutex};
+        m_released_retained_text_data.push_back(std::move(data));
+    }
+}
+
+void GraphicsDevice::destroy_canvas_readback(CanvasReadbackImpl& readback)
+{
+    auto owned_readback = std::unique_ptr<CanvasReadbackImpl>{&readback};
+
+    if (!is_render_thread())
+    {
+        const auto lock = std::scoped_lock{m_released_resources_mutex};
+        m_released_canvas_readbacks.push_back(std::move(owned_readback));
+    }
+}
+
+void GraphicsDevice::destroy_released_resources()
 {
-    const auto it = std::ranges::find_if(m_resources, [&resource](const auto& e) {
-        return &e.get() == &resource;
-    });
+    assert(is_render_thread());
+
+    auto resources = List<GraphicsResourceImpl*>{};
+
+    {
+        const auto lock = std::scoped_lock{m_released_resources_mutex};
+
+        m_released_retained_text_data.clear();
+        m_released_canvas_readbacks.clear();
+        std::swap(resources, m_released_resources);
 
-    assert(it != m_resources.cend());
+        for (auto* resource : resources)
+        {
+            resource->m_is_awaiting_destruction = false;
+        }
+    }
+
+    for (auto* resource : resources)
+    {
+        // Skip resources that were handed out again and are still referenced.
+        if (resource->ref_count() == 0)
+        {
+            delete resource;
+        }
+    }
+}
 
-    m_resources.erase(it);
+auto GraphicsDevice::is_render_thread() const -> bool
+{
+    return std::this_thread::get_id() == m_render_thread_id;
 }
 
 void GraphicsDevice::notify_user_shader_destroyed(ShaderImpl& resource)
@@ -326,7 +405,16 @@ auto GraphicsDevice::demand_create_shader(std::string_view                  name
     return shader;
 }
 
-auto GraphicsDevice::all_resources() const -> const RefList<GraphicsResourceImpl>&
+auto GraphicsDevice::create_image(uint32_t    width,
+                                  uint32_t    height,
+                                  ImageFormat format,
+                                  const void* data) -> std::unique_ptr<ImageImpl>
+{
+    const auto mipmaps = std::array{data};
+    return create_image(width, height, format, mipmaps);
+}
+
+auto GraphicsDevice::all_resources() const -> std::span<GraphicsResourceImpl* const>
 {
     return m_resources;
 }
@@ -462,6 +550,11 @@ void GraphicsDevice::draw_text(const Text& text, Vector2 position, const Color&
     m_sprite_batch->draw_text(text, position, color);
 }
 
+void GraphicsDevice::set_text_cache_capacity(uint32_t capacity)
+{
+    m_sprite_batch->set_text_cache_capacity(capacity);
+}
+
 void GraphicsDevice::draw_particles(const ParticleSystem& particle_system)
 {
     const auto previous_blend_state = m_blend_state;
@@ -581,6 +674,11 @@ auto GraphicsDevice::current_canvas_size() const -> Vector2
     return m_viewport.size();
 }
 
+auto GraphicsDevice::canvas_pool() -> CanvasPool&
+{
+    return m_canvas_pool;
+}
+
 void GraphicsDevice::post_init(std::unique_ptr<SpriteBatch> sprite_batch)
 {
     assert(sprite_batch);
@@ -592,6 +690,8 @@ void GraphicsDevice::post_init(std::unique_ptr<SpriteBatch> sprite_batch)
 
 void GraphicsDevice::pre_backend_dtor()
 {
+    destroy_released_resources();
+    m_canvas_pool.clear();
     FontImpl::destroy_built_in_fonts();
 }
 } // namespace cer::details
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include "CanvasPool.hpp"
+#include "CanvasReadbackImpl.hpp"
 #include "ShaderImpl.hpp"
 #include "cerlib/BlendState.hpp"
 #include "cerlib/Drawing.hpp"
@@ -14,8 +16,10 @@
 #include "cerlib/Shader.hpp"
 #include "cerlib/Window.hpp"
 #include <cerlib/CopyMoveMacros.hpp>
+#include <mutex>
 #include <optional>
 #include <span>
+#include <thread>
 
 #define LOAD_DEVICE_IMPL auto& device_impl = details::GameImpl::instance().graphics_device()
 
@@ -28,6 +32,7 @@ namespace cer::details
 {
 class WindowImpl;
 class SpriteBatch;
+class RetainedTextData;
 
 class GraphicsDevice
 {
@@ -57,16 +62,51 @@ class GraphicsDevice
                                uint32_t      height,
                                ImageFormat   format) -> std::unique_ptr<ImageImpl> = 0;
 
-    virtual auto create_image(uint32_t width, uint32_t height, ImageFormat format, const void* data)
+    // Creates an image from the data of all of its mipmaps, starting with the full-size
+    // image.
+    virtual auto create_image(uint32_t                     width,
+                              uint32_t                     height,
+                              ImageFormat                  format,
+                              std::span<const void* const> mipmaps)
         -> std::unique_ptr<ImageImpl> = 0;
 
+    auto create_image(uint32_t width, uint32_t height, ImageFormat format, const void* data)
+        -> std::unique_ptr<ImageImpl>;
+
+    // Replaces the contents of an image that was created using create_image(). References
+    // to the image stay valid.
+    virtual void replace_image_contents(ImageImpl&                   image,
+                                        uint32_t                     width,
+                                        uint32_t                     height,
+                                        ImageFormat                  format,
+                                        std::span<const void* const> mipmaps) = 0;
+
     void notify_resource_created(GraphicsResourceImpl& resource);
 
     virtual void notify_resource_destroyed(GraphicsResourceImpl& resource);
 
     virtual void notify_user_shader_destroyed(ShaderImpl& resource);
 
-    auto all_resources() const -> const RefList<GraphicsResourceImpl>&;
+    // Deletes a resource whose last reference was released. Resources can only be
+    // destroyed on the render thread, so when this is called from another thread (i.e.
+    // from a pipelined update() or draw()), the resource is destroyed by the next call
+    // to destroy_released_resources() instead.
+    void destroy_resource(GraphicsResourceImpl& resource);
+
+    // The same as destroy_resource(), for the GPU data of a retained text.
+    void destroy_retained_text_data(std::unique_ptr<RetainedTextData> data);
+
+    // The same as destroy_resource(), for a canvas readback.
+    void destroy_canvas_readback(CanvasReadbackImpl& readback);
+
+    void destroy_released_resources();
+
+    // Gets a value indicating whether the calling thread is the one that created the
+    // device, which is the only one that may use the graphics API.
+    auto is_render_thread() const -> bool;
+
+    // All resources that are alive, in no particular order.
+    auto all_resources() const -> std::span<GraphicsResourceImpl* const>;
 
     auto current_canvas() const -> const Image&;
 
@@ -102,6 +142,8 @@ class GraphicsDevice
 
     void draw_text(const Text& text, Vector2 position, const Color& color);
 
+    void set_text_cache_capacity(uint32_t capacity);
+
     void draw_particles(const ParticleSystem& particle_system);
 
     auto frame_stats_ref() -> FrameStats&;
@@ -110,6 +152,8 @@ class GraphicsDevice
 
     auto current_canvas_size() const -> Vector2;
 
+    auto canvas_pool() -> CanvasPool&;
+
     virtual void read_canvas_data_into(const Image& canvas,
                                        uint32_t     x,
                                        uint32_t     y,
@@ -117,6 +161,10 @@ class GraphicsDevice
                                        uint32_t     height,
                                        void*        destination) = 0;
 
+    virtual auto read_canvas_data_async(
+        const Image& canvas, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+        -> std::unique_ptr<CanvasReadbackImpl> = 0;
+
   protected:
     void post_init(std::unique_ptr<SpriteBatch> sprite_batch);
 
@@ -154,7 +202,8 @@ class GraphicsDevice
 
     void compute_combined_transformation();
 
-    RefList<GraphicsResourceImpl> m_resources;
+    List<GraphicsResourceImpl*>   m_resources;
+    std::thread::id               m_render_thread_id;
     std::unique_ptr<SpriteBatch>  m_sprite_batch;
     Window                        m_current_window;
     bool                          m_must_flush_draw_calls;
@@ -167,6 +216,13 @@ class GraphicsDevice
     BlendState                    m_blend_state;
     Sampler                       m_sampler;
     Shader                        m_sprite_shader;
+    CanvasPool                    m_canvas_pool;
     std::optional<Category>       m_current_category;
+
+    // Resources that were released on another thread and await destruction.
+    std::mutex                                m_released_resources_mutex;
+    List<GraphicsResourceImpl*>               m_released_resources;
+    List<std::unique_ptr<RetainedTextData>>   m_released_retained_text_data;
+    List<std::unique_ptr<CanvasReadbackImpl>> m_released_canvas_readbacks;
 };
 } // namespace cer::details
@@ -21,6 +21,11 @@ GraphicsResourceImpl::~GraphicsResourceImpl() noexcept
     m_parent_device.notify_resource_destroyed(*this);
 }
 
+void GraphicsResourceImpl::on_unreferenced()
+{
+    m_parent_device.destroy_resource(*this);
+}
+
 auto GraphicsResourceImpl::name() const -> std::string_view
 {
     return m_name;
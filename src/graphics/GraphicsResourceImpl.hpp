@@ -19,6 +19,8 @@ class GraphicsDevice;
 
 class GraphicsResourceImpl : public Object, public Asset
 {
+    friend GraphicsDevice;
+
   protected:
     explicit GraphicsResourceImpl(GraphicsDevice& parent_device, GraphicsResourceType type);
 
@@ -35,9 +37,14 @@ class GraphicsResourceImpl : public Object, public Asset
 
     virtual void set_name(std::string_view name);
 
+  protected:
+    void on_unreferenced() override;
+
   private:
     GraphicsDevice&      m_parent_device;
     GraphicsResourceType m_resource_type;
     std::string          m_name;
+    size_t               m_index_in_device{};
+    bool                 m_is_awaiting_destruction{};
 };
 } // namespace cer::details
\ No newline at end of file
@@ -6,6 +6,7 @@
 
 #include "GraphicsDevice.hpp"
 #include "ImageImpl.hpp"
+#include "Mipmaps.hpp"
 #include "cerlib/Window.hpp"
 #include "contentmanagement/ContentManager.hpp"
 #include "contentmanagement/ImageLoading.hpp"
@@ -37,16 +38,16 @@ Image::Image(uint32_t width, uint32_t height, ImageFormat format, const void* da
     set_impl(*this, device_impl.create_image(width, height, format, data).release());
 }
 
-Image::Image(std::span<const std::byte> memory)
+Image::Image(std::span<const std::byte> memory, const ImageLoadOptions& options)
 {
     LOAD_DEVICE_IMPL;
-    set_impl(*this, details::load_image(device_impl, memory).release());
+    set_impl(*this, details::load_image(device_impl, memory, options).release());
 }
 
-Image::Image(std::string_view asset_name)
+Image::Image(std::string_view asset_name, const ImageLoadOptions& options)
 {
     auto& content = details::GameImpl::instance().content_manager();
-    *this         = content.load_image(asset_name);
+    *this         = content.load_image(asset_name, options);
 }
 
 Image::Image(uint32_t width, uint32_t height, ImageFormat format, const Window& window)
@@ -56,6 +57,13 @@ Image::Image(uint32_t width, uint32_t height, ImageFormat format, const Window&
         throw std::invalid_argument{"No window specified."};
     }
 
+    if (image_format_is_block_compressed(format))
+    {
+        throw std::invalid_argument{
+            fmt::format("Canvases can't have a block-compressed format ({}).",
+                        image_format_name(format))};
+    }
+
     LOAD_DEVICE_IMPL;
     set_impl(*this, device_impl.create_canvas(window, width, height, format).release());
 }
@@ -100,6 +108,12 @@ auto Image::format() const -> ImageFormat
     return impl->format();
 }
 
+auto Image::mipmap_count() const -> uint32_t
+{
+    DECLARE_IMAGE_IMPL;
+    return impl->mipmap_count();
+}
+
 auto Image::canvas_clear_color() const -> std::optional<Color>
 {
     DECLARE_IMAGE_IMPL;
@@ -115,7 +129,17 @@ void Image::set_canvas_clear_color(std::optional<Color> value)
 auto Image::size_in_bytes() const -> uint32_t
 {
     DECLARE_IMAGE_IMPL;
-    return image_slice_pitch(impl->width(), impl->height(), impl->format());
+
+    auto size = uint32_t(0);
+
+    for (uint32_t level = 0; level < impl->mipmap_count(); ++level)
+    {
+        size += image_slice_pitch(details::mipmap_extent(impl->width(), level),
+                                  details::mipmap_extent(impl->height(), level),
+                                  impl->format());
+    }
+
+    return size;
 }
 } // namespace cer
 
@@ -127,18 +151,58 @@ auto cer::image_format_bits_per_pixel(ImageFormat format) -> uint32_t
         case ImageFormat::R8G8B8A8_UNorm:
         case ImageFormat::R8G8B8A8_Srgb: return 8 * 4;
         case ImageFormat::R32G32B32A32_Float: return 32 * 4;
+        case ImageFormat::BC1_UNorm:
+        case ImageFormat::BC1_Srgb:
+        case ImageFormat::ETC2_RGB8_UNorm:
+        case ImageFormat::ETC2_RGB8_Srgb: return 4;
+        case ImageFormat::BC3_UNorm:
+        case ImageFormat::BC3_Srgb:
+        case ImageFormat::ETC2_RGBA8_UNorm:
+        case ImageFormat::ETC2_RGBA8_Srgb: return 8;
     }
 
     return 0;
 }
 
+auto cer::image_format_is_block_compressed(ImageFormat format) -> bool
+{
+    switch (format)
+    {
+        case ImageFormat::R8_UNorm:
+        case ImageFormat::R8G8B8A8_UNorm:
+        case ImageFormat::R8G8B8A8_Srgb:
+        case ImageFormat::R32G32B32A32_Float: return false;
+        case ImageFormat::BC1_UNorm:
+        case ImageFormat::BC1_Srgb:
+        case ImageFormat::BC3_UNorm:
+        case ImageFormat::BC3_Srgb:
+        case ImageFormat::ETC2_RGB8_UNorm:
+        case ImageFormat::ETC2_RGB8_Srgb:
+        case ImageFormat::ETC2_RGBA8_UNorm:
+        case ImageFormat::ETC2_RGBA8_Srgb: return true;
+    }
+
+    return false;
+}
+
 auto cer::image_row_pitch(uint32_t width, ImageFormat format) -> uint32_t
 {
+    if (image_format_is_block_compressed(format))
+    {
+        // A block of 4x4 pixels has 16 * bits_per_pixel bits.
+        return ((width + 3) / 4) * image_format_bits_per_pixel(format) * 2;
+    }
+
     return width * image_format_bits_per_pixel(format) / 8;
 }
 
 auto cer::image_slice_pitch(uint32_t width, uint32_t height, ImageFormat format) -> uint32_t
 {
+    if (image_format_is_block_compressed(format))
+    {
+        return ((height + 3) / 4) * image_row_pitch(width, format);
+    }
+
     return width * height * image_format_bits_per_pixel(format) / 8;
 }
 
@@ -150,6 +214,14 @@ auto cer::image_format_name(ImageFormat format) -> std::string_view
         case ImageFormat::R8G8B8A8_UNorm: return "R8G8B8A8_UNorm";
         case ImageFormat::R8G8B8A8_Srgb: return "R8G8B8A8_Srgb";
         case ImageFormat::R32G32B32A32_Float: return "R32G32B32A32_Float";
+        case ImageFormat::BC1_UNorm: return "BC1_UNorm";
+        case ImageFormat::BC1_Srgb: return "BC1_Srgb";
+        case ImageFormat::BC3_UNorm: return "BC3_UNorm";
+        case ImageFormat::BC3_Srgb: return "BC3_Srgb";
+        case ImageFormat::ETC2_RGB8_UNorm: return "ETC2_RGB8_UNorm";
+        case ImageFormat::ETC2_RGB8_Srgb: return "ETC2_RGB8_Srgb";
+        case ImageFormat::ETC2_RGBA8_UNorm: return "ETC2_RGBA8_UNorm";
+        case ImageFormat::ETC2_RGBA8_Srgb: return "ETC2_RGBA8_Srgb";
     }
 
     return {};
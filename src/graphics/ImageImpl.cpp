@@ -13,13 +13,15 @@ ImageImpl::ImageImpl(GraphicsDevice& parent_device,
                      WindowImpl*     window_for_canvas,
                      uint32_t        width,
                      uint32_t        height,
-                     ImageFormat     format)
+                     ImageFormat     format,
+                     uint32_t        mipmap_count)
     : GraphicsResourceImpl(parent_device, GraphicsResourceType::Image)
     , m_is_canvas(is_canvas)
     , m_window_for_canvas(window_for_canvas)
     , m_width(width)
     , m_height(height)
     , m_format(format)
+    , m_mipmap_count(mipmap_count)
 {
 }
 
@@ -48,6 +50,22 @@ auto ImageImpl::format() const -> ImageFormat
     return m_format;
 }
 
+auto ImageImpl::mipmap_count() const -> uint32_t
+{
+    return m_mipmap_count;
+}
+
+void ImageImpl::set_extent_and_format(uint32_t    width,
+                                      uint32_t    height,
+                                      ImageFormat format,
+                                      uint32_t    mipmap_count)
+{
+    m_width        = width;
+    m_height       = height;
+    m_format       = format;
+    m_mipmap_count = mipmap_count;
+}
+
 auto ImageImpl::canvas_clear_color() const -> std::optional<Color>
 {
     return m_canvas_clear_color;
@@ -27,7 +27,8 @@ class ImageImpl : public GraphicsResourceImpl
                        WindowImpl*     window_for_canvas,
                        uint32_t        width,
                        uint32_t        height,
-                       ImageFormat     format);
+                       ImageFormat     format,
+                       uint32_t        mipmap_count);
 
     auto is_canvas() const -> bool;
 
@@ -39,16 +40,27 @@ class ImageImpl : public GraphicsResourceImpl
 
     auto format() const -> ImageFormat;
 
+    auto mipmap_count() const -> uint32_t;
+
     auto canvas_clear_color() const -> std::optional<Color>;
 
     void set_canvas_clear_color(const std::optional<Color>& value);
 
+  protected:
+    // Called by backends when the image's contents were replaced by contents of a
+    // different extent or format.
+    void set_extent_and_format(uint32_t    width,
+                               uint32_t    height,
+                               ImageFormat format,
+                               uint32_t    mipmap_count);
+
   private:
     bool                 m_is_canvas{};
     WindowImpl*          m_window_for_canvas{};
     uint32_t             m_width{};
     uint32_t             m_height{};
     ImageFormat          m_format{};
+    uint32_t             m_mipmap_count{};
     std::optional<Color> m_canvas_clear_color{};
 };
 } // namespace cer::details
\ No newline at end of file
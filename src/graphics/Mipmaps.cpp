@@ -0,0 +1,252 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "Mipmaps.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace cer::details
+{
+static auto srgb_to_linear_table() -> const std::array<float, 256>&
+{
+    static const auto table = [] {
+        auto result = std::array<float, 256>{};
+
+        for (size_t i = 0; i < result.size(); ++i)
+        {
+            const auto value = float(i) / 255.0f;
+
+            result[i] = value <= 0.04045f ? value / 12.92f
+                                          : std::pow((value + 0.055f) / 1.055f, 2.4f);
+        }
+
+        return result;
+    }();
+
+    return table;
+}
+
+static auto linear_to_srgb(float value) -> float
+{
+    return value <= 0.0031308f ? value * 12.92f
+                               : (1.055f * std::pow(value, 1.0f / 2.4f)) - 0.055f;
+}
+
+static auto to_unorm8(float value) -> std::byte
+{
+    return std::byte(std::lrint(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+}
+
+// Pixels are averaged as floats with straight alpha, and every mipmap is computed from the
+// float version of the one above, so that rounding errors don't add up down the chain.
+static auto decode(uint32_t width, uint32_t height, ImageFormat format, const void* data)
+    -> List<float>
+{
+    const auto pixel_count = size_t(width) * height;
+    const auto channels    = format == ImageFormat::R8_UNorm ? size_t(1) : size_t(4);
+
+    auto result = List<float>(pixel_count * channels);
+
+    switch (format)
+    {
+        case ImageFormat::R8_UNorm:
+        case ImageFormat::R8G8B8A8_UNorm: {
+            const auto* src = static_cast<const uint8_t*>(data);
+
+            for (size_t i = 0; i < result.size(); ++i)
+            {
+                result[i] = float(src[i]) / 255.0f;
+            }
+
+            break;
+        }
+        case ImageFormat::R8G8B8A8_Srgb: {
+            const auto* src   = static_cast<const uint8_t*>(data);
+            const auto& table = srgb_to_linear_table();
+
+            for (size_t i = 0; i < result.size(); ++i)
+            {
+                result[i] = i % 4 == 3 ? float(src[i]) / 255.0f : table[src[i]];
+            }
+
+            break;
+        }
+        case ImageFormat::R32G32B32A32_Float:
+            std::memcpy(result.data(), data, result.size() * sizeof(float));
+            break;
+        default: break;
+    }
+
+    return result;
+}
+
+static auto encode(std::span<const float> pixels, ImageFormat format) -> List<std::byte>
+{
+    auto result = List<std::byte>();
+
+    switch (format)
+    {
+        case ImageFormat::R8_UNorm:
+        case ImageFormat::R8G8B8A8_UNorm:
+            result.resize(pixels.size());
+            std::ranges::transform(pixels, result.begin(), to_unorm8);
+            break;
+        case ImageFormat::R8G8B8A8_Srgb:
+            result.resize(pixels.size());
+
+            for (size_t i = 0; i < pixels.size(); ++i)
+            {
+                result[i] = to_unorm8(i % 4 == 3 ? pixels[i] : linear_to_srgb(pixels[i]));
+            }
+
+            break;
+        case ImageFormat::R32G32B32A32_Float:
+            result.resize(pixels.size() * sizeof(float));
+            std::memcpy(result.data(), pixels.data(), result.size());
+            break;
+        default: break;
+    }
+
+    return result;
+}
+
+// The range of pixels in the mipmap above that make up pixel i of a mipmap.
+static auto box_range(uint32_t i, uint32_t extent, uint32_t src_extent)
+    -> std::pair<uint32_t, uint32_t>
+{
+    const auto first = std::min(i * 2, src_extent - 1);
+    const auto last  = i + 1 == extent ? src_extent : first + 2;
+
+    return {first, last};
+}
+
+static auto downsample(std::span<const float> src,
+                       uint32_t               src_width,
+                       uint32_t               src_height,
+                       uint32_t               width,
+                       uint32_t               height,
+                       size_t                 channels) -> List<float>
+{
+    auto result = List<float>(size_t(width) * height * channels);
+
+    for (uint32_t y = 0; y < height; ++y)
+    {
+        const auto [first_y, last_y] = box_range(y, height, src_height);
+
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            const auto [first_x, last_x] = box_range(x, width, src_width);
+
+            auto sum          = std::array<float, 4>{};
+            auto weighted_sum = std::array<float, 3>{};
+            auto count        = 0.0f;
+
+            for (auto sy = first_y; sy < last_y; ++sy)
+            {
+                for (auto sx = first_x; sx < last_x; ++sx)
+                {
+                    const auto* pixel = src.data() + (((size_t(sy) * src_width) + sx) * channels);
+
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        sum[c] += pixel[c];
+                    }
+
+                    if (channels == 4)
+                    {
+                        for (size_t c = 0; c < 3; ++c)
+                        {
+                            weighted_sum[c] += pixel[c] * pixel[3];
+                        }
+                    }
+
+                    count += 1.0f;
+                }
+            }
+
+            auto* dst = result.data() + (((size_t(y) * width) + x) * channels);
+
+            for (size_t c = 0; c < channels; ++c)
+            {
+                dst[c] = sum[c] / count;
+            }
+
+            // Fully transparent boxes keep their plain average, which matters when
+            // the image is drawn with an additive blend state.
+            if (channels == 4 && sum[3] > 0.0f)
+            {
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    dst[c] = weighted_sum[c] / sum[3];
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+auto mipmap_extent(uint32_t extent, uint32_t level) -> uint32_t
+{
+    return std::max(extent >> level, 1u);
+}
+
+auto full_mipmap_count(uint32_t width, uint32_t height) -> uint32_t
+{
+    return uint32_t(std::bit_width(std::max({width, height, 1u})));
+}
+
+auto generate_mipmaps(uint32_t width, uint32_t height, ImageFormat format, const void* data)
+    -> List<List<std::byte>>
+{
+    switch (format)
+    {
+        case ImageFormat::R8_UNorm:
+        case ImageFormat::R8G8B8A8_UNorm:
+        case ImageFormat::R8G8B8A8_Srgb:
+        case ImageFormat::R32G32B32A32_Float: break;
+        case ImageFormat::BC1_UNorm:
+        case ImageFormat::BC1_Srgb:
+        case ImageFormat::BC3_UNorm:
+        case ImageFormat::BC3_Srgb:
+        case ImageFormat::ETC2_RGB8_UNorm:
+        case ImageFormat::ETC2_RGB8_Srgb:
+        case ImageFormat::ETC2_RGBA8_UNorm:
+        case ImageFormat::ETC2_RGBA8_Srgb:
+            throw std::invalid_argument{
+                fmt::format("Mipmaps can't be generated for images of format {}.",
+                            image_format_name(format))};
+    }
+
+    const auto channels = format == ImageFormat::R8_UNorm ? size_t(1) : size_t(4);
+    const auto count    = full_mipmap_count(width, height);
+
+    auto mipmaps = List<List<std::byte>>();
+    mipmaps.reserve(count - 1);
+
+    auto pixels = decode(width, height, format, data);
+
+    for (uint32_t level = 1; level < count; ++level)
+    {
+        const auto src_width  = mipmap_extent(width, level - 1);
+        const auto src_height = mipmap_extent(height, level - 1);
+
+        pixels = downsample(pixels,
+                            src_width,
+                            src_height,
+                            mipmap_extent(width, level),
+                            mipmap_extent(height, level),
+                            channels);
+
+        mipmaps.push_back(encode(pixels, format));
+    }
+
+    return mipmaps;
+}
+} // namespace cer::details
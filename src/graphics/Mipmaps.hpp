@@ -0,0 +1,30 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include "cerlib/Image.hpp"
+#include <cerlib/List.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace cer::details
+{
+// The width or height of a mipmap, given the width or height of the full-size image.
+auto mipmap_extent(uint32_t extent, uint32_t level) -> uint32_t;
+
+// Number of mipmaps down to 1x1, including the full-size image.
+auto full_mipmap_count(uint32_t width, uint32_t height) -> uint32_t;
+
+// Generates the mipmaps of an image by averaging boxes of 2x2 pixels of the mipmap above.
+// When a mipmap has an odd width or height, its last column or row is folded into the last
+// pixel of the next one.
+//
+// Color channels are weighted by their alpha, so that invisible pixels don't bleed their
+// color into visible ones, and sRGB images are averaged in linear space.
+//
+// Returns all mipmaps except the full-size image, largest first.
+auto generate_mipmaps(uint32_t width, uint32_t height, ImageFormat format, const void* data)
+    -> List<List<std::byte>>;
+} // namespace cer::details
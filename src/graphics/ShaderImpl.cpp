@@ -9,6 +9,8 @@
 #include "cerlib/Logging.hpp"
 #include "cerlib/Util.hpp"
 #include "shadercompiler/Type.hpp"
+#include <algorithm>
+#include <cstring>
 
 namespace cer::details
 {
@@ -64,25 +66,53 @@ ShaderImpl::ShaderImpl(GraphicsDevice& parent_device, ParameterList parameters)
         return lhs.name < rhs.name;
     });
 
-    for (auto& param : m_parameters)
+    collect_parameter_pointers();
+    set_default_parameter_values();
+}
+
+ShaderImpl::~ShaderImpl() noexcept
+{
+    log_verbose("~ShaderImpl({})", name());
+    parent_device().notify_user_shader_destroyed(*this);
+}
+
+void ShaderImpl::take_contents_of(ShaderImpl& other)
+{
+    for (auto& param : other.m_parameters)
     {
+        const auto* old_param = find_parameter(param.name);
+
+        if (old_param == nullptr || old_param->type != param.type)
+        {
+            continue;
+        }
+
         if (param.is_image)
         {
-            m_image_parameters.push_back(&param);
-            m_dirty_image_parameters.insert(&param);
+            param.image = old_param->image;
         }
         else
         {
-            m_dirty_scalar_parameters.insert(&param);
+            std::memcpy(other.m_cbuffer_data.data() + param.offset,
+                        m_cbuffer_data.data() + old_param->offset,
+                        std::min(param.size_in_bytes, old_param->size_in_bytes));
         }
     }
 
-    set_default_parameter_values();
-}
+    // The parameter lists store their elements inline, so pointers to parameters have to be
+    // collected again after moving them.
+    m_cbuffer_data  = std::move(other.m_cbuffer_data);
+    m_c_buffer_size = other.m_c_buffer_size;
+    m_parameters    = std::move(other.m_parameters);
 
-ShaderImpl::~ShaderImpl() noexcept
-{
-    log_verbose("~ShaderImpl({})", name());
+    other.m_image_parameters.clear();
+    other.m_dirty_scalar_parameters.clear();
+    other.m_dirty_image_parameters.clear();
+
+    collect_parameter_pointers();
+    swap_native_shader(other);
+
+    // Programs that were linked with the previous code have to be linked again.
     parent_device().notify_user_shader_destroyed(*this);
 }
 
@@ -203,6 +233,26 @@ void ShaderImpl::verify_parameter_update_condition()
     }
 }
 
+void ShaderImpl::collect_parameter_pointers()
+{
+    m_image_parameters.clear();
+    m_dirty_scalar_parameters.clear();
+    m_dirty_image_parameters.clear();
+
+    for (auto& param : m_parameters)
+    {
+        if (param.is_image)
+        {
+            m_image_parameters.push_back(&param);
+            m_dirty_image_parameters.insert(&param);
+        }
+        else
+        {
+            m_dirty_scalar_parameters.insert(&param);
+        }
+    }
+}
+
 void ShaderImpl::set_default_parameter_values()
 {
     for (auto& param : m_parameters)
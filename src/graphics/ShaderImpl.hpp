@@ -35,6 +35,10 @@ class ShaderImpl : public GraphicsResourceImpl
 
     ~ShaderImpl() noexcept override;
 
+    // Takes over the code and parameters of a shader that was compiled from changed source
+    // code. Parameters that kept their name and type keep their current values.
+    void take_contents_of(ShaderImpl& other);
+
     static auto shader_parameter_type_string(ShaderParameterType type) -> std::string;
 
     static void verify_parameter_read(std::string_view    parameter_name,
@@ -147,9 +151,15 @@ class ShaderImpl : public GraphicsResourceImpl
 
     auto image_parameters() const -> std::span<ShaderParameter* const>;
 
+  protected:
+    // Swaps the backend-specific shader objects with those of another shader.
+    virtual void swap_native_shader(ShaderImpl& other) = 0;
+
   private:
     void verify_parameter_update_condition();
 
+    void collect_parameter_pointers();
+
     void set_default_parameter_values();
 
     List<uint8_t, 512>                         m_cbuffer_data;
@@ -0,0 +1,150 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "ShapedTextCache.hpp"
+#include "cerlib/Hashing.hpp"
+
+namespace cer::details
+{
+ShapedTextCache::ShapedTextCache(uint32_t capacity)
+    : m_capacity(capacity)
+{
+}
+
+auto ShapedTextCache::shape(std::string_view                     text,
+                            const Font&                          font,
+                            uint32_t                             font_size,
+                            const std::optional<TextDecoration>& decoration,
+                            FrameStats&                          stats) -> const Entry&
+{
+    if (m_capacity == 0)
+    {
+        ++stats.text_cache_misses;
+
+        shape_text(text,
+                   font,
+                   font_size,
+                   decoration,
+                   m_uncached_entry.glyphs,
+                   m_uncached_entry.decoration_rects);
+
+        return m_uncached_entry;
+    }
+
+    const auto key = KeyView{
+        .text       = text,
+        .font       = font.impl(),
+        .font_size  = font_size,
+        .decoration = &decoration,
+    };
+
+    if (const auto it = m_lookup.find(key); it != m_lookup.cend())
+    {
+        ++stats.text_cache_hits;
+
+        // Mark as most recently used. Splicing keeps all iterators valid.
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+
+        return *it->second;
+    }
+
+    ++stats.text_cache_misses;
+
+    if (m_entries.size() >= m_capacity)
+    {
+        // Recycle the least recently used entry, including its buffers.
+        const auto it_last = std::prev(m_entries.end());
+        m_lookup.erase(&*it_last);
+        m_entries.splice(m_entries.begin(), m_entries, it_last);
+    }
+    else
+    {
+        m_entries.emplace_front();
+    }
+
+    auto& entry = m_entries.front();
+
+    entry.text.assign(text);
+    entry.font       = font;
+    entry.font_size  = font_size;
+    entry.decoration = decoration;
+
+    shape_text(text, font, font_size, decoration, entry.glyphs, entry.decoration_rects);
+
+    m_lookup.emplace(&entry, m_entries.begin());
+
+    return entry;
+}
+
+auto ShapedTextCache::capacity() const -> uint32_t
+{
+    return m_capacity;
+}
+
+void ShapedTextCache::set_capacity(uint32_t value)
+{
+    m_capacity = value;
+    evict_down_to(m_capacity);
+}
+
+void ShapedTextCache::clear()
+{
+    evict_down_to(0);
+    m_uncached_entry = {};
+}
+
+auto ShapedTextCache::key_of(const Entry& entry) -> KeyView
+{
+    return {
+        .text       = entry.text,
+        .font       = entry.font.impl(),
+        .font_size  = entry.font_size,
+        .decoration = &entry.decoration,
+    };
+}
+
+void ShapedTextCache::evict_down_to(uint32_t count)
+{
+    while (m_entries.size() > count)
+    {
+        m_lookup.erase(&m_entries.back());
+        m_entries.pop_back();
+    }
+}
+
+auto ShapedTextCache::KeyHash::operator()(const KeyView& key) const -> size_t
+{
+    auto seed = std::hash<std::string_view>{}(key.text);
+
+    hash_combine(seed, key.font, key.font_size);
+
+    if (key.decoration->has_value())
+    {
+        hash_combine(seed, (*key.decoration)->index());
+    }
+
+    return seed;
+}
+
+auto ShapedTextCache::KeyHash::operator()(const Entry* entry) const -> size_t
+{
+    return (*this)(key_of(*entry));
+}
+
+auto ShapedTextCache::KeyEqual::operator()(const KeyView& lhs, const Entry* rhs) const -> bool
+{
+    return lhs.font == rhs->font.impl() && lhs.font_size == rhs->font_size &&
+           lhs.text == rhs->text && *lhs.decoration == rhs->decoration;
+}
+
+auto ShapedTextCache::KeyEqual::operator()(const Entry* lhs, const KeyView& rhs) const -> bool
+{
+    return (*this)(rhs, lhs);
+}
+
+auto ShapedTextCache::KeyEqual::operator()(const Entry* lhs, const Entry* rhs) const -> bool
+{
+    return (*this)(key_of(*lhs), rhs);
+}
+} // namespace cer::details
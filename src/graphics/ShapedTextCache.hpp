@@ -0,0 +1,97 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include "cerlib/Drawing.hpp"
+#include "cerlib/Font.hpp"
+#include "graphics/TextImpl.hpp"
+#include <cerlib/CopyMoveMacros.hpp>
+#include <cerlib/List.hpp>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace cer::details
+{
+// A bounded LRU cache of shaped strings, used by draw_string() to avoid shaping
+// the same text (e.g. labels and counters) every frame.
+class ShapedTextCache final
+{
+  public:
+    static constexpr auto default_capacity = 256u;
+
+    struct Entry
+    {
+        std::string                   text;
+        Font                          font;
+        uint32_t                      font_size{};
+        std::optional<TextDecoration> decoration;
+        List<PreshapedGlyph>          glyphs;
+        List<TextDecorationRect>      decoration_rects;
+    };
+
+    explicit ShapedTextCache(uint32_t capacity = default_capacity);
+
+    forbid_copy_and_move(ShapedTextCache);
+
+    ~ShapedTextCache() noexcept = default;
+
+    // Gets the shaped version of a string, shaping and caching it if necessary.
+    // The returned entry stays valid until the next call to shape().
+    // Hits and misses are counted in the specified frame stats.
+    auto shape(std::string_view                     text,
+               const Font&                          font,
+               uint32_t                             font_size,
+               const std::optional<TextDecoration>& decoration,
+               FrameStats&                          stats) -> const Entry&;
+
+    auto capacity() const -> uint32_t;
+
+    void set_capacity(uint32_t value);
+
+    void clear();
+
+  private:
+    struct KeyView
+    {
+        std::string_view                     text;
+        const FontImpl*                      font{};
+        uint32_t                             font_size{};
+        const std::optional<TextDecoration>* decoration{};
+    };
+
+    struct KeyHash
+    {
+        using is_transparent = void;
+
+        auto operator()(const KeyView& key) const -> size_t;
+
+        auto operator()(const Entry* entry) const -> size_t;
+    };
+
+    struct KeyEqual
+    {
+        using is_transparent = void;
+
+        auto operator()(const KeyView& lhs, const Entry* rhs) const -> bool;
+
+        auto operator()(const Entry* lhs, const KeyView& rhs) const -> bool;
+
+        auto operator()(const Entry* lhs, const Entry* rhs) const -> bool;
+    };
+
+    using EntryList = std::list<Entry>;
+    using LookupMap = std::unordered_map<const Entry*, EntryList::iterator, KeyHash, KeyEqual>;
+
+    static auto key_of(const Entry& entry) -> KeyView;
+
+    void evict_down_to(uint32_t count);
+
+    uint32_t  m_capacity;
+    EntryList m_entries;
+    LookupMap m_lookup;
+    Entry     m_uncached_entry;
+};
+} // namespace cer::details
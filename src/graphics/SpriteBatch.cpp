@@ -13,8 +13,10 @@
 #include "cerlib/Logging.hpp"
 #include "cerlib/Text.hpp"
 #include "util/narrow_cast.hpp"
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <numeric>
 
 namespace cer::details
 {
@@ -87,9 +89,10 @@ void SpriteBatch::draw_string(std::string_view                     text,
     verify_has_begun();
     assert(font);
 
-    shape_text(text, font, font_size, decoration, m_tmp_glyphs, m_tmp_decoration_rects);
+    const auto& shaped =
+        m_shaped_text_cache.shape(text, font, font_size, decoration, m_frame_stats);
 
-    do_draw_text(m_tmp_glyphs, m_tmp_decoration_rects, position, color);
+    do_draw_text(shaped.glyphs, shaped.decoration_rects, position, color);
 }
 
 void SpriteBatch::draw_text(const Text& text, const Vector2& position, const Color& color)
@@ -97,9 +100,22 @@ void SpriteBatch::draw_text(const Text& text, const Vector2& position, const Col
     verify_has_begun();
     assert(text);
 
-    const TextImpl& text_impl = *text.impl();
+    TextImpl& text_impl = *text.impl();
 
-    do_draw_text(text_impl.glyphs(), text_impl.decoration_rects(), position, color);
+    if (text_impl.is_retained() && !text_impl.glyphs().empty())
+    {
+        do_draw_retained_text(text_impl, position, color);
+        do_draw_text({}, text_impl.decoration_rects(), position, color);
+    }
+    else
+    {
+        do_draw_text(text_impl.glyphs(), text_impl.decoration_rects(), position, color);
+    }
+}
+
+void SpriteBatch::set_text_cache_capacity(uint32_t capacity)
+{
+    m_shaped_text_cache.set_capacity(capacity);
 }
 
 void SpriteBatch::fill_rectangle(const Rectangle& rectangle,
@@ -140,6 +156,7 @@ void SpriteBatch::on_shader_destroyed([[maybe_unused]] ShaderImpl& shader)
 void SpriteBatch::release_resources()
 {
     m_sprite_queue.clear();
+    m_shaped_text_cache.clear();
     m_white_image   = {};
     m_sprite_shader = {};
 }
@@ -151,63 +168,89 @@ void SpriteBatch::verify_has_begun() const
 
 auto SpriteBatch::flush() -> void
 {
-    auto       batch_image  = Image{};
     auto       batch_start  = 0u;
     auto       batch_shader = SpriteShaderKind::Default;
     const auto sprite_count = narrow_cast<uint32_t>(m_sprite_queue.size());
 
+    m_batch_images.clear();
+
+    // A batch ends when the shader changes or when a sprite's image doesn't fit into the
+    // batch's image slots anymore. Sprites of the same batch may use different images.
     for (uint32_t i = 0; i < sprite_count; ++i)
     {
-        const auto& sprite      = m_sprite_queue[i];
-        const auto& image       = sprite.image;
-        const auto  shader_kind = sprite.shader_kind;
+        auto&      sprite      = m_sprite_queue[i];
+        const auto shader_kind = sprite.shader_kind;
 
-        if (image != batch_image || shader_kind != batch_shader)
+        auto image_index = narrow_cast<uint32_t>(
+            std::ranges::find(m_batch_images, sprite.image, &BatchImage::image) -
+            m_batch_images.begin());
+
+        const auto is_new_image = image_index == m_batch_images.size();
+
+        if (shader_kind != batch_shader ||
+            (is_new_image && image_index == batch_image_capacity(batch_shader)))
         {
             if (i > batch_start)
             {
-                render_batch(batch_image, batch_shader, batch_start, i - batch_start);
+                render_batch(batch_shader, batch_start, i - batch_start);
             }
 
-            batch_image  = image;
+            m_batch_images.clear();
             batch_shader = shader_kind;
             batch_start  = i;
+            image_index  = 0;
         }
-    }
 
-    render_batch(batch_image, batch_shader, batch_start, sprite_count - batch_start);
+        if (image_index == m_batch_images.size())
+        {
+            constexpr auto are_canvases_flipped_up_down = true;
+
+            const auto& image = sprite.image;
 
-    m_sprite_queue.clear();
-}
+            assert(image);
 
-void SpriteBatch::render_batch(const Image&     image,
-                               SpriteShaderKind shader,
-                               uint32_t         start,
-                               uint32_t         count)
-{
-    constexpr auto are_canvases_flipped_up_down = true;
+            const auto image_width  = image.widthf();
+            const auto image_height = image.heightf();
 
-    assert(image);
+            assert(!is_zero(image_width));
+            assert(!is_zero(image_height));
 
-    set_up_batch(image, shader, start, count);
+            m_batch_images.push_back({
+                .image = image,
+                .texture_size_and_inverse =
+                    Rectangle{
+                        image_width,
+                        image_height,
+                        1.0f / image_width,
+                        1.0f / image_height,
+                    },
+                .flip_image_up_down = are_canvases_flipped_up_down && image.is_canvas(),
+            });
+        }
 
-    const auto image_width  = image.widthf();
-    const auto image_height = image.heightf();
+        sprite.image_index = image_index;
+    }
 
-    assert(!is_zero(image_width));
-    assert(!is_zero(image_height));
+    render_batch(batch_shader, batch_start, sprite_count - batch_start);
 
-    const auto inverse_image_width  = 1.0f / image_width;
-    const auto inverse_image_height = 1.0f / image_height;
+    m_sprite_queue.clear();
+}
 
-    const auto texture_size_and_inverse = Rectangle{
-        image_width,
-        image_height,
-        inverse_image_width,
-        inverse_image_height,
-    };
+auto SpriteBatch::batch_image_capacity(SpriteShaderKind shader) const -> uint32_t
+{
+    // A user-defined sprite shader samples its sprite_image only, so its batches can't
+    // mix images.
+    if (shader == SpriteShaderKind::Default && m_sprite_shader)
+    {
+        return 1;
+    }
 
-    const auto flip_image_up_down = are_canvases_flipped_up_down && image.is_canvas();
+    return max_batch_image_count();
+}
+
+void SpriteBatch::render_batch(SpriteShaderKind shader, uint32_t start, uint32_t count)
+{
+    set_up_batch(m_batch_images, shader, start, count);
 
     while (count > 0)
     {
@@ -227,7 +270,7 @@ void SpriteBatch::render_batch(const Image&     image,
             }
         }
 
-        fill_vertices_and_draw(start, batch_size, texture_size_and_inverse, flip_image_up_down);
+        fill_vertices_and_draw(start, batch_size);
 
         m_vertex_buffer_position += batch_size;
         start += batch_size;
@@ -235,18 +278,14 @@ void SpriteBatch::render_batch(const Image&     image,
     }
 }
 
-void SpriteBatch::fill_sprite_vertices(Vertex*          dst,
-                                       uint32_t         batch_start,
-                                       uint32_t         batch_size,
-                                       const Rectangle& texture_size_and_inverse,
-                                       bool             flip_image_up_down) const
+void SpriteBatch::fill_sprite_vertices(Vertex* dst, uint32_t batch_start, uint32_t batch_size) const
 {
     for (uint32_t i = 0; i < batch_size; ++i)
     {
-        render_sprite(m_sprite_queue[batch_start + i],
-                      dst,
-                      texture_size_and_inverse,
-                      flip_image_up_down);
+        const auto& sprite = m_sprite_queue[batch_start + i];
+        const auto& image  = m_batch_images[sprite.image_index];
+
+        render_sprite(sprite, dst, image.texture_size_and_inverse, image.flip_image_up_down);
 
         dst += vertices_per_sprite; // NOLINT
     }
@@ -326,9 +365,10 @@ void SpriteBatch::render_sprite(const InternalSprite& sprite,
 
         // NOLINTBEGIN
         dst_vertices[i] = {
-            .position = position,
-            .color    = color,
-            .uv       = uv,
+            .position    = position,
+            .color       = color,
+            .uv          = uv,
+            .image_index = float(sprite.image_index),
         };
         // NOLINTEND
     }
@@ -356,4 +396,93 @@ void SpriteBatch::do_draw_text(std::span<const PreshapedGlyph>     glyphs,
         fill_rectangle(deco.rect.offset(offset), deco.color.value_or(color), 0.0f, {});
     }
 }
+
+void SpriteBatch::do_draw_retained_text(TextImpl& text, const Vector2& position, const Color& color)
+{
+    // Retained text bypasses the sprite queue, so everything that was queued before it
+    // has to be drawn first to preserve the drawing order.
+    prepare_for_rendering();
+
+    if (!m_sprite_queue.empty())
+    {
+        flush();
+    }
+
+    const auto& data = text.retained_data();
+
+    if (!data || data->atlas_version != text.font().impl()->atlas_version())
+    {
+        update_retained_text_data(text);
+        ++m_frame_stats.retained_text_updates;
+    }
+
+    draw_retained_text(*data, translate(position) * m_transformation, color);
+    ++m_frame_stats.retained_text_draws;
+}
+
+void SpriteBatch::update_retained_text_data(TextImpl& text)
+{
+    auto&       data   = text.retained_data();
+    const auto  glyphs = text.glyphs();
+    const auto* font   = text.font().impl();
+
+    if (!data)
+    {
+        data = create_retained_text_data();
+    }
+
+    // Group the glyphs by their page image, so that each page is drawn in one go.
+    m_tmp_glyph_indices.resize(glyphs.size());
+    std::iota(m_tmp_glyph_indices.begin(), m_tmp_glyph_indices.end(), 0u);
+
+    std::ranges::stable_sort(m_tmp_glyph_indices, [&glyphs](uint32_t lhs, uint32_t rhs) {
+        return glyphs[lhs].image < glyphs[rhs].image;
+    });
+
+    m_tmp_retained_vertices.resize(glyphs.size() * vertices_per_sprite);
+    data->runs.clear();
+
+    auto* dst = m_tmp_retained_vertices.data();
+
+    for (uint32_t i = 0; i < m_tmp_glyph_indices.size(); ++i)
+    {
+        const auto& glyph = glyphs[m_tmp_glyph_indices[i]];
+
+        if (data->runs.empty() || data->runs.back().image != glyph.image)
+        {
+            data->runs.push_back({.image = glyph.image, .start = i, .count = 0});
+        }
+
+        ++data->runs.back().count;
+
+        const auto image_size               = glyph.image.size();
+        const auto texture_size_and_inverse = Rectangle{
+            image_size.x,
+            image_size.y,
+            1.0f / image_size.x,
+            1.0f / image_size.y,
+        };
+
+        render_sprite(
+            InternalSprite{
+                .image       = glyph.image,
+                .dst         = glyph.dst_rect,
+                .src         = glyph.src_rect,
+                .color       = white,
+                .origin      = {},
+                .rotation    = 0.0f,
+                .flip        = SpriteFlip::None,
+                .shader_kind = SpriteShaderKind::Monochromatic,
+            },
+            dst,
+            texture_size_and_inverse,
+            false);
+
+        dst += vertices_per_sprite; // NOLINT
+    }
+
+    upload_retained_text_vertices(*data, m_tmp_retained_vertices);
+
+    data->atlas_version = font->atlas_version();
+}
 } // namespace cer::details
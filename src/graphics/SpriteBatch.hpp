@@ -14,6 +14,7 @@
 #include "cerlib/Shader.hpp"
 #include "cerlib/Vector2.hpp"
 #include "cerlib/Vector4.hpp"
+#include "graphics/ShapedTextCache.hpp"
 #include "graphics/TextImpl.hpp"
 #include <cerlib/CopyMoveMacros.hpp>
 #include <cerlib/List.hpp>
@@ -28,6 +29,29 @@ namespace cer::details
 {
 class GraphicsDevice;
 
+// Vertex data of a retained Text object that lives on the GPU across frames.
+// Backends derive from this to store their buffer objects.
+class RetainedTextData
+{
+  public:
+    // A range of glyph quads that share the same font page image.
+    struct Run
+    {
+        Image    image;
+        uint32_t start{};
+        uint32_t count{};
+    };
+
+    explicit RetainedTextData() = default;
+
+    forbid_copy_and_move(RetainedTextData);
+
+    virtual ~RetainedTextData() noexcept = default;
+
+    uint64_t  atlas_version{};
+    List<Run> runs;
+};
+
 class SpriteBatch
 {
   public:
@@ -36,6 +60,18 @@ class SpriteBatch
         Vector4 position;
         Color   color;
         Vector2 uv;
+
+        // The slot of the sprite's image among the images of its batch.
+        float image_index{};
+    };
+
+    // An image that is bound for a batch, along with what its sprites need to compute
+    // their texture coordinates.
+    struct BatchImage
+    {
+        Image     image;
+        Rectangle texture_size_and_inverse;
+        bool      flip_image_up_down{};
     };
 
     static constexpr auto max_batch_size      = 2048u;
@@ -72,6 +108,8 @@ class SpriteBatch
 
     void draw_text(const Text& text, const Vector2& position, const Color& color);
 
+    void set_text_cache_capacity(uint32_t capacity);
+
     void fill_rectangle(const Rectangle& rectangle,
                         const Color&     color,
                         float            rotation,
@@ -86,23 +124,31 @@ class SpriteBatch
   protected:
     virtual void prepare_for_rendering() = 0;
 
-    virtual void set_up_batch(const Image&     image,
-                              SpriteShaderKind shader_kind,
-                              uint32_t         start,
-                              uint32_t         count) = 0;
+    // The number of distinct images that the built-in sprite shaders can sample from
+    // within a single batch. Batches of a user-defined sprite shader always use one image.
+    virtual auto max_batch_image_count() const -> uint32_t = 0;
 
-    virtual void fill_vertices_and_draw(uint32_t         batch_start,
-                                        uint32_t         batch_size,
-                                        const Rectangle& texture_size_and_inverse,
-                                        bool             flip_image_up_down) = 0;
+    virtual void set_up_batch(std::span<const BatchImage> images,
+                              SpriteShaderKind            shader_kind,
+                              uint32_t                    start,
+                              uint32_t                    count) = 0;
+
+    virtual void fill_vertices_and_draw(uint32_t batch_start, uint32_t batch_size) = 0;
 
     virtual void on_end_rendering() = 0;
 
-    void fill_sprite_vertices(Vertex*          dst,
-                              uint32_t         batch_start,
-                              uint32_t         batch_size,
-                              const Rectangle& texture_size_and_inverse,
-                              bool             flip_image_up_down) const;
+    virtual auto create_retained_text_data() -> std::unique_ptr<RetainedTextData> = 0;
+
+    virtual void upload_retained_text_vertices(RetainedTextData&       data,
+                                               std::span<const Vertex> vertices) = 0;
+
+    // The vertices of retained text are white, so that the color can be applied when
+    // drawing without having to rebuild them.
+    virtual void draw_retained_text(const RetainedTextData& data,
+                                    const Matrix&           transformation,
+                                    const Color&            color) = 0;
+
+    void fill_sprite_vertices(Vertex* dst, uint32_t batch_start, uint32_t batch_size) const;
 
     auto parent_device() -> GraphicsDevice&
     {
@@ -150,13 +196,16 @@ class SpriteBatch
         float            rotation{};
         SpriteFlip       flip{SpriteFlip::None};
         SpriteShaderKind shader_kind{SpriteShaderKind::Default};
+        uint32_t         image_index{};
     };
 
     void verify_has_begun() const;
 
     void flush();
 
-    void render_batch(const Image& image, SpriteShaderKind shader, uint32_t start, uint32_t count);
+    auto batch_image_capacity(SpriteShaderKind shader) const -> uint32_t;
+
+    void render_batch(SpriteShaderKind shader, uint32_t start, uint32_t count);
 
     static void render_sprite(const InternalSprite& sprite,
                               Vertex*               dst_vertices,
@@ -168,10 +217,15 @@ class SpriteBatch
                       const Vector2&                      offset,
                       const Color&                        color);
 
+    void do_draw_retained_text(TextImpl& text, const Vector2& position, const Color& color);
+
+    void update_retained_text_data(TextImpl& text);
+
     bool                 m_is_in_begin_end_pair{};
     GraphicsDevice&      m_parent_device;
     FrameStats&          m_frame_stats;
     List<InternalSprite> m_sprite_queue;
+    List<BatchImage>     m_batch_images;
     uint32_t             m_vertex_buffer_position;
     Image                m_white_image;
     Matrix               m_transformation;
@@ -179,8 +233,10 @@ class SpriteBatch
     Shader               m_sprite_shader;
     Sampler              m_sampler;
 
-    // Used in draw_string() as temporary buffers for text shaping results.
-    List<PreshapedGlyph>     m_tmp_glyphs;
-    List<TextDecorationRect> m_tmp_decoration_rects;
+    ShapedTextCache m_shaped_text_cache;
+
+    // Used in update_retained_text_data() as temporary buffers.
+    List<uint32_t> m_tmp_glyph_indices;
+    List<Vertex>   m_tmp_retained_vertices;
 };
 } // namespace cer::details
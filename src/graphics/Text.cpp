@@ -19,4 +19,16 @@ Text::Text(std::string_view                     text,
 
     set_impl(*this, impl.release());
 }
+
+auto Text::is_retained() const -> bool
+{
+    DECLARE_THIS_IMPL;
+    return impl->is_retained();
+}
+
+void Text::set_retained(bool value)
+{
+    DECLARE_THIS_IMPL;
+    impl->set_retained(value);
+}
 } // namespace cer
@@ -4,6 +4,9 @@
 
 #include "TextImpl.hpp"
 
+#include "GraphicsDevice.hpp"
+#include "SpriteBatch.hpp"
+#include "game/GameImpl.hpp"
 #include "cerlib/Font.hpp"
 #include <cassert>
 
@@ -13,13 +16,25 @@ TextImpl::TextImpl(std::string_view                     text,
                    const Font&                          font,
                    uint32_t                             font_size,
                    const std::optional<TextDecoration>& decoration)
+    : m_font(font ? font : Font::built_in(false))
 {
-    shape_text(text,
-               font ? font : Font::built_in(false),
-               font_size,
-               decoration,
-               m_glyphs,
-               m_decoration_rects);
+    shape_text(text, m_font, font_size, decoration, m_glyphs, m_decoration_rects);
+}
+
+TextImpl::~TextImpl() noexcept
+{
+    // The GPU buffers may only be destroyed on the render thread. Without a game, there's
+    // no device to hand them to, so they're destroyed right away.
+    if (m_retained_data != nullptr && GameImpl::is_instance_initialized())
+    {
+        GameImpl::instance().graphics_device().destroy_retained_text_data(
+            std::move(m_retained_data));
+    }
+}
+
+auto TextImpl::font() const -> const Font&
+{
+    return m_font;
 }
 
 auto TextImpl::glyphs() const -> std::span<const PreshapedGlyph>
@@ -31,4 +46,24 @@ auto TextImpl::decoration_rects() const -> std::span<const TextDecorationRect>
 {
     return m_decoration_rects;
 }
+
+auto TextImpl::is_retained() const -> bool
+{
+    return m_is_retained;
+}
+
+void TextImpl::set_retained(bool value)
+{
+    m_is_retained = value;
+
+    if (!m_is_retained)
+    {
+        m_retained_data.reset();
+    }
+}
+
+auto TextImpl::retained_data() -> std::unique_ptr<RetainedTextData>&
+{
+    return m_retained_data;
+}
 } // namespace cer::details
@@ -14,6 +14,8 @@
 
 namespace cer::details
 {
+class RetainedTextData;
+
 struct PreshapedGlyph
 {
     Image     image;
@@ -122,12 +124,28 @@ class TextImpl final : public Object
              uint32_t                             font_size,
              const std::optional<TextDecoration>& decoration);
 
+    forbid_copy_and_move(TextImpl);
+
+    ~TextImpl() noexcept override;
+
+    auto font() const -> const Font&;
+
     auto glyphs() const -> std::span<const PreshapedGlyph>;
 
     auto decoration_rects() const -> std::span<const TextDecorationRect>;
 
+    auto is_retained() const -> bool;
+
+    void set_retained(bool value);
+
+    // The GPU-side data of a retained text. Created and refreshed by the sprite batch.
+    auto retained_data() -> std::unique_ptr<RetainedTextData>&;
+
   private:
-    List<PreshapedGlyph>     m_glyphs;
-    List<TextDecorationRect> m_decoration_rects;
+    Font                              m_font;
+    List<PreshapedGlyph>              m_glyphs;
+    List<TextDecorationRect>          m_decoration_rects;
+    bool                              m_is_retained{};
+    std::unique_ptr<RetainedTextData> m_retained_data;
 };
 } // namespace cer::details
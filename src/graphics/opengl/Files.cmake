@@ -1,6 +1,8 @@
 set(opengl_files
   OpenGLBuffer.cpp
   OpenGLBuffer.hpp
+  OpenGLCanvasReadback.cpp
+  OpenGLCanvasReadback.hpp
   OpenGLGraphicsDevice.cpp
   OpenGLGraphicsDevice.hpp
   OpenGLImage.cpp
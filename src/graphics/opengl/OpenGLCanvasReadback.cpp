@@ -0,0 +1,149 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "OpenGLCanvasReadback.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace cer::details
+{
+// How long read_into() waits for the fence at a time, in nanoseconds.
+static constexpr auto s_fence_wait_timeout = GLuint64(100'000'000);
+
+// OpenGL stores the bottom row of a canvas first, so the rows are flipped while they're
+// copied out.
+static void copy_rows_flipped(const std::byte* src,
+                              std::byte*       dst,
+                              size_t           row_pitch,
+                              uint32_t         height)
+{
+    for (uint32_t row = 0; row < height; ++row)
+    {
+        std::memcpy(dst + (row_pitch * row), src + (row_pitch * (height - row - 1)), row_pitch);
+    }
+}
+
+OpenGLCanvasReadback::OpenGLCanvasReadback(GraphicsDevice&            parent_device,
+                                           uint32_t                   x,
+                                           uint32_t                   y,
+                                           uint32_t                   width,
+                                           uint32_t                   height,
+                                           ImageFormat                format,
+                                           const OpenGLFormatTriplet& format_triplet,
+                                           bool                       is_async)
+    : CanvasReadbackImpl(parent_device, width, height, format)
+{
+    void* pixels = nullptr;
+
+    if (is_async)
+    {
+        // Binding the buffer makes glReadPixels() write to it instead of to client memory.
+        m_buffer = OpenGLBuffer{GL_PIXEL_PACK_BUFFER, size_in_bytes(), GL_STREAM_READ, nullptr};
+    }
+    else
+    {
+        m_data.resize(size_in_bytes());
+        pixels = m_data.data();
+    }
+
+    GL_CALL(glReadPixels(GLint(x),
+                         GLint(y),
+                         GLsizei(width),
+                         GLsizei(height),
+                         format_triplet.base_format,
+                         format_triplet.type,
+                         pixels));
+
+    if (is_async)
+    {
+        GL_CALL(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+        m_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        if (m_fence == nullptr)
+        {
+            throw std::runtime_error{"Failed to create the OpenGL fence"};
+        }
+    }
+}
+
+OpenGLCanvasReadback::~OpenGLCanvasReadback() noexcept
+{
+    if (m_fence != nullptr)
+    {
+        glDeleteSync(m_fence);
+    }
+}
+
+auto OpenGLCanvasReadback::is_ready() const -> bool
+{
+    return wait_for_fence(0);
+}
+
+void OpenGLCanvasReadback::read_into(void* destination)
+{
+    const auto row_pitch = size_t(image_row_pitch(width(), format()));
+    auto*      dst       = static_cast<std::byte*>(destination);
+
+    if (m_buffer.gl_handle == 0)
+    {
+        copy_rows_flipped(m_data.data(), dst, row_pitch, height());
+        return;
+    }
+
+    while (!wait_for_fence(s_fence_wait_timeout))
+    {
+    }
+
+    GL_CALL(glBindBuffer(GL_PIXEL_PACK_BUFFER, m_buffer.gl_handle));
+
+    defer
+    {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    };
+
+    const auto* src = static_cast<const std::byte*>(
+        glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, GLsizeiptr(size_in_bytes()), GL_MAP_READ_BIT));
+
+    if (src == nullptr)
+    {
+        throw std::runtime_error{"Failed to map the OpenGL buffer"};
+    }
+
+    copy_rows_flipped(src, dst, row_pitch, height());
+
+    if (glUnmapBuffer(GL_PIXEL_PACK_BUFFER) == GL_FALSE)
+    {
+        throw std::runtime_error{"The canvas data was lost while it was being read"};
+    }
+}
+
+auto OpenGLCanvasReadback::wait_for_fence(GLuint64 timeout) const -> bool
+{
+    if (m_fence == nullptr)
+    {
+        return true;
+    }
+
+    // Flushing ensures that the fence is eventually signaled, even if nothing else is
+    // drawn until then.
+    const auto result = glClientWaitSync(m_fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+
+    if (result == GL_WAIT_FAILED)
+    {
+        throw std::runtime_error{"Failed to wait for the OpenGL fence"};
+    }
+
+    if (result == GL_TIMEOUT_EXPIRED)
+    {
+        return false;
+    }
+
+    glDeleteSync(m_fence);
+    m_fence = nullptr;
+
+    return true;
+}
+} // namespace cer::details
@@ -0,0 +1,47 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include "OpenGLBuffer.hpp"
+#include "OpenGLPrerequisites.hpp"
+#include "graphics/CanvasReadbackImpl.hpp"
+#include <cerlib/List.hpp>
+
+namespace cer::details
+{
+// Reads a canvas into a pixel pack buffer, which the GPU fills once it has finished
+// drawing to the canvas. A fence tells when that has happened.
+//
+// Without support for fences, the data is read right away instead.
+class OpenGLCanvasReadback final : public CanvasReadbackImpl
+{
+  public:
+    // Starts reading from the framebuffer that is currently bound.
+    explicit OpenGLCanvasReadback(GraphicsDevice&            parent_device,
+                                  uint32_t                   x,
+                                  uint32_t                   y,
+                                  uint32_t                   width,
+                                  uint32_t                   height,
+                                  ImageFormat                format,
+                                  const OpenGLFormatTriplet& format_triplet,
+                                  bool                       is_async);
+
+    forbid_copy_and_move(OpenGLCanvasReadback);
+
+    ~OpenGLCanvasReadback() noexcept override;
+
+    auto is_ready() const -> bool override;
+
+    void read_into(void* destination) override;
+
+  private:
+    // Returns true if the fence was signaled within the timeout, in nanoseconds.
+    auto wait_for_fence(GLuint64 timeout) const -> bool;
+
+    OpenGLBuffer    m_buffer;
+    mutable GLsync  m_fence{};
+    List<std::byte> m_data;
+};
+} // namespace cer::details
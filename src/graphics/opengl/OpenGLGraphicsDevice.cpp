@@ -3,12 +3,15 @@
 // For conditions of distribution and use, see copyright notice in LICENSE.
 
 #include "OpenGLGraphicsDevice.hpp"
+#include "OpenGLCanvasReadback.hpp"
 #include "OpenGLImage.hpp"
 #include "OpenGLSpriteBatch.hpp"
 #include "OpenGLUserShader.hpp"
 #include "OpenGLWindow.hpp"
 #include "cerlib/Game.hpp"
 #include "cerlib/Logging.hpp"
+#include "graphics/BlockCompression.hpp"
+#include "graphics/Mipmaps.hpp"
 
 // clang-format off
 #ifdef CERLIB_ENABLE_IMGUI
@@ -22,8 +25,10 @@
 #endif
 // clang-format on
 
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstdlib>
 #include <cstring>
 
 namespace cer::details
@@ -61,6 +66,25 @@ static void open_gl_debug_message_callback([[maybe_unused]] GLenum      source,
 }
 #endif
 
+#ifdef CERLIB_GFX_IS_GLES
+// The GLES loader doesn't know about extensions, so they are queried directly.
+static auto has_extension(std::string_view name) -> bool
+{
+    auto count = GLint{};
+    GL_CALL(glGetIntegerv(GL_NUM_EXTENSIONS, &count));
+
+    for (GLint i = 0; i < count; ++i)
+    {
+        if (reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, GLuint(i))) == name)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+#endif
+
 void OpenGLGraphicsDevice::on_start_frame(const Window& window)
 {
     auto* opengl_window = dynamic_cast<OpenGLWindow*>(window.impl());
@@ -224,12 +248,98 @@ auto OpenGLGraphicsDevice::create_canvas(const Window& window,
     return std::make_unique<OpenGLImage>(*this, window.impl(), width, height, format);
 }
 
-auto OpenGLGraphicsDevice::create_image(uint32_t    width,
-                                        uint32_t    height,
-                                        ImageFormat format,
-                                        const void* data) -> std::unique_ptr<ImageImpl>
+// Calls func with mipmaps that the device can sample. Block-compressed mipmaps are decoded
+// on the CPU if the device doesn't support their format.
+template <typename Func>
+static auto with_sampleable_mipmaps(const OpenGLGraphicsDevice&  device,
+                                    uint32_t                     width,
+                                    uint32_t                     height,
+                                    ImageFormat                  format,
+                                    std::span<const void* const> mipmaps,
+                                    const Func&                  func)
 {
-    return std::make_unique<OpenGLImage>(*this, width, height, format, data);
+    if (image_format_is_block_compressed(format) && !device.supports_compressed_format(format))
+    {
+        log_verbose("Decoding image of format {}, which the device can't sample",
+                    image_format_name(format));
+
+        auto decoded_mipmaps     = List<List<std::byte>, 16>{};
+        auto decoded_mipmap_ptrs = List<const void*, 16>{};
+
+        for (size_t level = 0; level < mipmaps.size(); ++level)
+        {
+            decoded_mipmaps.push_back(
+                decode_block_compressed_image(mipmap_extent(width, uint32_t(level)),
+                                              mipmap_extent(height, uint32_t(level)),
+                                              format,
+                                              mipmaps[level]));
+
+            decoded_mipmap_ptrs.push_back(decoded_mipmaps.back().data());
+        }
+
+        return func(decoded_image_format(format),
+                    std::span<const void* const>{decoded_mipmap_ptrs});
+    }
+
+    return func(format, mipmaps);
+}
+
+auto OpenGLGraphicsDevice::create_image(uint32_t                     width,
+                                        uint32_t                     height,
+                                        ImageFormat                  format,
+                                        std::span<const void* const> mipmaps)
+    -> std::unique_ptr<ImageImpl>
+{
+    return with_sampleable_mipmaps(
+        *this,
+        width,
+        height,
+        format,
+        mipmaps,
+        [&](ImageFormat sampleable_format, std::span<const void* const> sampleable_mipmaps)
+            -> std::unique_ptr<ImageImpl> {
+            return std::make_unique<OpenGLImage>(*this,
+                                                 width,
+                                                 height,
+                                                 sampleable_format,
+                                                 sampleable_mipmaps);
+        });
+}
+
+void OpenGLGraphicsDevice::replace_image_contents(ImageImpl&                   image,
+                                                  uint32_t                     width,
+                                                  uint32_t                     height,
+                                                  ImageFormat                  format,
+                                                  std::span<const void* const> mipmaps)
+{
+    with_sampleable_mipmaps(
+        *this,
+        width,
+        height,
+        format,
+        mipmaps,
+        [&](ImageFormat sampleable_format, std::span<const void* const> sampleable_mipmaps) {
+            static_cast<OpenGLImage&>(image).replace_contents(width,
+                                                              height,
+                                                              sampleable_format,
+                                                              sampleable_mipmaps);
+        });
+}
+
+auto OpenGLGraphicsDevice::supports_compressed_format(ImageFormat format) const -> bool
+{
+    switch (format)
+    {
+        case ImageFormat::BC1_UNorm:
+        case ImageFormat::BC1_Srgb:
+        case ImageFormat::BC3_UNorm:
+        case ImageFormat::BC3_Srgb: return m_features.texture_compression_bc;
+        case ImageFormat::ETC2_RGB8_UNorm:
+        case ImageFormat::ETC2_RGB8_Srgb:
+        case ImageFormat::ETC2_RGBA8_UNorm:
+        case ImageFormat::ETC2_RGBA8_Srgb: return m_features.texture_compression_etc2;
+        default: return false;
+    }
 }
 
 auto OpenGLGraphicsDevice::opengl_features() const -> const OpenGLFeatures&
@@ -251,50 +361,73 @@ void OpenGLGraphicsDevice::use_program(GLuint program)
     }
 }
 
-void OpenGLGraphicsDevice::read_canvas_data_into(
-    const Image& canvas, uint32_t x, uint32_t y, uint32_t width, uint32_t height, void* destination)
+// Binds the framebuffer of a canvas while func reads from it.
+template <typename Func>
+static auto with_canvas_bound(const Image& canvas, const Func& func)
 {
     assert(canvas);
 
-    auto* opengl_image = dynamic_cast<OpenGLImage*>(canvas.impl());
-    assert(opengl_image != nullptr);
+    const auto& opengl_image = static_cast<const OpenGLImage&>(*canvas.impl());
 
     GLuint previously_bound_fbo = 0;
     glGetIntegerv(GL_FRAMEBUFFER_BINDING, reinterpret_cast<GLint*>(&previously_bound_fbo));
 
-    const auto fbo_handle = opengl_image->gl_framebuffer_handle;
+    const auto fbo_handle = opengl_image.gl_framebuffer_handle;
 
     // A canvas cannot be bound while we're trying to read from it.
-    // This is ensured by the top-level GetCanvasDataInto() function (via exception).
+    // This is ensured by the top-level read_canvas_data_into() function (via exception).
     assert(previously_bound_fbo != fbo_handle);
 
     glBindFramebuffer(GL_FRAMEBUFFER, fbo_handle);
 
-    const auto opengl_format_triplet = opengl_image->gl_format_triplet;
-    const auto canvas_format         = canvas.format();
-    const auto row_pitch             = image_row_pitch(width, canvas_format);
-    const auto pixel_data_size       = row_pitch * height;
-    const auto tmp_buffer            = std::make_unique<std::byte[]>(pixel_data_size);
-
-    glReadPixels(GLint(x),
-                 GLint(y),
-                 GLsizei(width),
-                 GLsizei(height),
-                 opengl_format_triplet.base_format,
-                 opengl_format_triplet.type,
-                 tmp_buffer.get());
+    defer
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, previously_bound_fbo);
+    };
 
-    // Flip data vertically because OpenGL.
-    auto* dst_row = static_cast<std::byte*>(destination);
+    return func(opengl_image.gl_format_triplet);
+}
 
-    for (uint32_t row = 0; row < height; ++row)
+void OpenGLGraphicsDevice::read_canvas_data_into(
+    const Image& canvas, uint32_t x, uint32_t y, uint32_t width, uint32_t height, void* destination)
+{
+    with_canvas_bound(canvas, [&](const OpenGLFormatTriplet& format_triplet) {
+        glReadPixels(GLint(x),
+                     GLint(y),
+                     GLsizei(width),
+                     GLsizei(height),
+                     format_triplet.base_format,
+                     format_triplet.type,
+                     destination);
+    });
+
+    // Flip data vertically because OpenGL. This is done in place, swapping the top and
+    // bottom rows towards the middle.
+    const auto row_pitch = image_row_pitch(width, canvas.format());
+    auto*      data      = static_cast<std::byte*>(destination);
+
+    for (uint32_t row = 0; row < height / 2; ++row)
     {
-        const auto src_row = tmp_buffer.get() + row_pitch * (height - row - 1); // NOLINT
-        std::memcpy(dst_row, src_row, row_pitch);
-        dst_row += row_pitch; // NOLINT
+        auto* top_row    = data + (row_pitch * row);                // NOLINT
+        auto* bottom_row = data + (row_pitch * (height - row - 1)); // NOLINT
+        std::swap_ranges(top_row, top_row + row_pitch, bottom_row); // NOLINT
     }
+}
 
-    glBindFramebuffer(GL_FRAMEBUFFER, previously_bound_fbo);
+auto OpenGLGraphicsDevice::read_canvas_data_async(
+    const Image& canvas, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+    -> std::unique_ptr<CanvasReadbackImpl>
+{
+    return with_canvas_bound(canvas, [&](const OpenGLFormatTriplet& format_triplet) {
+        return std::make_unique<OpenGLCanvasReadback>(*this,
+                                                      x,
+                                                      y,
+                                                      width,
+                                                      height,
+                                                      canvas.format(),
+                                                      format_triplet,
+                                                      m_features.sync_objects);
+    });
 }
 
 auto OpenGLGraphicsDevice::create_native_user_shader(std::string_view          native_code,
@@ -410,13 +543,66 @@ OpenGLGraphicsDevice::OpenGLGraphicsDevice(WindowImpl& main_window)
         m_features.texture_storage = true;
     }
 
-    if (GLAD_GL_ARB_bindless_texture != 0 && glCreateTextures != nullptr)
+    // Bindless sprite images are sampled by GLSL 4.00 shaders.
+    if (GLAD_GL_ARB_bindless_texture != 0 && gl_major_version >= 4 &&
+        glGetTextureSamplerHandleARB != nullptr && glMakeTextureHandleResidentARB != nullptr)
     {
-        log_verbose("  Device supports OpenGL feature BindlessTextures");
-        m_features.bindless_textures = true;
+        // Read from the process environment each time a device is created, so that both
+        // paths can be compared within one process.
+        if (const auto* env = std::getenv("CERLIB_DISABLE_BINDLESS_TEXTURES");
+            env != nullptr && std::strncmp(env, "1", 1) == 0)
+        {
+            log_verbose("  Not using OpenGL feature BindlessTextures due to environment variable");
+        }
+        else
+        {
+            log_verbose("  Device supports OpenGL feature BindlessTextures");
+            m_features.bindless_textures = true;
+        }
     }
+
+    m_features.texture_compression_bc =
+        GLAD_GL_EXT_texture_compression_s3tc != 0 && GLAD_GL_EXT_texture_sRGB != 0;
+
+    // ETC2 is part of OpenGL 4.3 and OpenGL ES 3.0.
+    m_features.texture_compression_etc2 =
+        GLAD_GL_ARB_ES3_compatibility != 0 || gl_major_version > 4 ||
+        (gl_major_version == 4 && gl_minor_version >= 3);
+#else
+    m_features.texture_compression_bc = has_extension("GL_EXT_texture_compression_s3tc") &&
+                                        has_extension("GL_EXT_texture_compression_s3tc_srgb");
+
+    m_features.texture_compression_etc2 = true;
 #endif
 
+    if (m_features.texture_compression_bc)
+    {
+        log_verbose("  Device supports OpenGL feature TextureCompressionBC");
+    }
+
+    if (m_features.texture_compression_etc2)
+    {
+        log_verbose("  Device supports OpenGL feature TextureCompressionETC2");
+    }
+
+    // Fences are part of OpenGL 3.2 and OpenGL ES 3.0. They're only used to read canvases
+    // into buffers asynchronously, which WebGL doesn't support because it can't map buffers.
+#if defined(__EMSCRIPTEN__)
+    m_features.sync_objects = false;
+#elif defined(CERLIB_GFX_IS_GLES)
+    m_features.sync_objects = true;
+#else
+    m_features.sync_objects =
+        (GLAD_GL_ARB_sync != 0 || gl_major_version > 3 ||
+         (gl_major_version == 3 && gl_minor_version >= 2)) &&
+        glFenceSync != nullptr;
+#endif
+
+    if (m_features.sync_objects)
+    {
+        log_verbose("  Device supports OpenGL feature SyncObjects");
+    }
+
     log_verbose("Initialized OpenGL device. Now calling post_init().");
 
     post_init(std::make_unique<OpenGLSpriteBatch>(*this, frame_stats_ref()));
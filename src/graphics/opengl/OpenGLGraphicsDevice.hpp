@@ -35,11 +35,24 @@ class OpenGLGraphicsDevice final : public GraphicsDevice
     auto create_canvas(const Window& window, uint32_t width, uint32_t height, ImageFormat format)
         -> std::unique_ptr<ImageImpl> override;
 
-    auto create_image(uint32_t width, uint32_t height, ImageFormat format, const void* data)
+    using GraphicsDevice::create_image;
+
+    auto create_image(uint32_t                     width,
+                      uint32_t                     height,
+                      ImageFormat                  format,
+                      std::span<const void* const> mipmaps)
         -> std::unique_ptr<ImageImpl> override;
 
+    void replace_image_contents(ImageImpl&                   image,
+                                uint32_t                     width,
+                                uint32_t                     height,
+                                ImageFormat                  format,
+                                std::span<const void* const> mipmaps) override;
+
     auto opengl_features() const -> const OpenGLFeatures&;
 
+    auto supports_compressed_format(ImageFormat format) const -> bool;
+
     void bind_vao(const OpenGLVao& vao);
 
     void use_program(GLuint program);
@@ -51,6 +64,10 @@ class OpenGLGraphicsDevice final : public GraphicsDevice
                                uint32_t     height,
                                void*        destination) override;
 
+    auto read_canvas_data_async(
+        const Image& canvas, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+        -> std::unique_ptr<CanvasReadbackImpl> override;
+
   protected:
     auto create_native_user_shader(std::string_view          native_code,
                                    ShaderImpl::ParameterList parameters)
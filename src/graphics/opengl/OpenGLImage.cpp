@@ -3,59 +3,18 @@
 // For conditions of distribution and use, see copyright notice in LICENSE.
 
 #include "OpenGLImage.hpp"
+#include "graphics/Mipmaps.hpp"
 
 namespace cer::details
 {
-OpenGLImage::OpenGLImage(GraphicsDevice& parent_device,
-                         uint32_t        width,
-                         uint32_t        height,
-                         ImageFormat     format,
-                         const void*     data)
-    : ImageImpl(parent_device, false, nullptr, width, height, format)
+OpenGLImage::OpenGLImage(GraphicsDevice&              parent_device,
+                         uint32_t                     width,
+                         uint32_t                     height,
+                         ImageFormat                  format,
+                         std::span<const void* const> mipmaps)
+    : ImageImpl(parent_device, false, nullptr, width, height, format, uint32_t(mipmaps.size()))
 {
-    const auto format_gl = convert_to_opengl_pixel_format(format);
-
-    verify_opengl_state();
-    GL_CALL(glGenTextures(1, &gl_handle));
-
-    if (gl_handle == 0)
-    {
-        throw std::runtime_error{"Failed to create the texture handle."};
-    }
-
-    verify_opengl_state();
-
-    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
-
-    GLuint previous_texture = 0;
-    GL_CALL(glGetIntegerv(GL_TEXTURE_BINDING_2D, reinterpret_cast<GLint*>(&previous_texture)));
-
-    GL_CALL(glBindTexture(GL_TEXTURE_2D, gl_handle));
-
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
-
-#ifndef CERLIB_GFX_IS_GLES
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0));
-#endif
-
-    last_applied_sampler = linear_clamp;
-
-    GL_CALL(glTexImage2D(GL_TEXTURE_2D,
-                         /*level: */ 0,
-                         format_gl.internal_format,
-                         GLsizei(width),
-                         GLsizei(height),
-                         /*border: */ 0,
-                         format_gl.base_format,
-                         format_gl.type,
-                         data));
-
-    GL_CALL(glBindTexture(GL_TEXTURE_2D, previous_texture));
-    verify_opengl_state();
+    create_texture(mipmaps);
 }
 
 OpenGLImage::OpenGLImage(GraphicsDevice& parent_device,
@@ -63,7 +22,7 @@ OpenGLImage::OpenGLImage(GraphicsDevice& parent_device,
                          uint32_t        width,
                          uint32_t        height,
                          ImageFormat     format)
-    : ImageImpl(parent_device, true, window_for_canvas, width, height, format)
+    : ImageImpl(parent_device, true, window_for_canvas, width, height, format, 1)
 {
     gl_format_triplet = convert_to_opengl_pixel_format(format);
 
@@ -91,10 +50,8 @@ OpenGLImage::OpenGLImage(GraphicsDevice& parent_device,
     GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
     GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
 
-#ifndef CERLIB_GFX_IS_GLES
     GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0));
     GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0));
-#endif
 
     GL_CALL(glTexImage2D(GL_TEXTURE_2D,
                          0,
@@ -141,6 +98,159 @@ OpenGLImage::OpenGLImage(GraphicsDevice& parent_device,
 
 OpenGLImage::~OpenGLImage() noexcept
 {
+    destroy_texture();
+}
+
+void OpenGLImage::replace_contents(uint32_t                     width,
+                                   uint32_t                     height,
+                                   ImageFormat                  format,
+                                   std::span<const void* const> mipmaps)
+{
+    assert(!is_canvas());
+    assert(!mipmaps.empty());
+
+    if (width != this->width() || height != this->height() || format != this->format() ||
+        mipmaps.size() != mipmap_count())
+    {
+        // The texture's storage can't change once bindless handles exist for it, so it's
+        // replaced by a new texture instead.
+        destroy_texture();
+        set_extent_and_format(width, height, format, uint32_t(mipmaps.size()));
+        create_texture(mipmaps);
+        return;
+    }
+
+    const auto format_gl     = convert_to_opengl_pixel_format(format);
+    const auto is_compressed = image_format_is_block_compressed(format);
+
+    verify_opengl_state();
+
+    GLuint previous_texture = 0;
+    GL_CALL(glGetIntegerv(GL_TEXTURE_BINDING_2D, reinterpret_cast<GLint*>(&previous_texture)));
+
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, gl_handle));
+
+    for (size_t level = 0; level < mipmaps.size(); ++level)
+    {
+        const auto level_width  = mipmap_extent(width, uint32_t(level));
+        const auto level_height = mipmap_extent(height, uint32_t(level));
+
+        if (is_compressed)
+        {
+            GL_CALL(glCompressedTexSubImage2D(
+                GL_TEXTURE_2D,
+                GLint(level),
+                /*xoffset: */ 0,
+                /*yoffset: */ 0,
+                GLsizei(level_width),
+                GLsizei(level_height),
+                GLenum(format_gl.internal_format),
+                GLsizei(image_slice_pitch(level_width, level_height, format)),
+                mipmaps[level]));
+        }
+        else
+        {
+            GL_CALL(glTexSubImage2D(GL_TEXTURE_2D,
+                                    GLint(level),
+                                    /*xoffset: */ 0,
+                                    /*yoffset: */ 0,
+                                    GLsizei(level_width),
+                                    GLsizei(level_height),
+                                    format_gl.base_format,
+                                    format_gl.type,
+                                    mipmaps[level]));
+        }
+    }
+
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, previous_texture));
+    verify_opengl_state();
+}
+
+void OpenGLImage::create_texture(std::span<const void* const> mipmaps)
+{
+    const auto width     = this->width();
+    const auto height    = this->height();
+    const auto format    = this->format();
+    const auto format_gl = convert_to_opengl_pixel_format(format);
+
+    verify_opengl_state();
+    GL_CALL(glGenTextures(1, &gl_handle));
+
+    if (gl_handle == 0)
+    {
+        throw std::runtime_error{"Failed to create the texture handle."};
+    }
+
+    verify_opengl_state();
+
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+
+    GLuint previous_texture = 0;
+    GL_CALL(glGetIntegerv(GL_TEXTURE_BINDING_2D, reinterpret_cast<GLint*>(&previous_texture)));
+
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, gl_handle));
+
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+
+    // The texture only has the mipmaps that were specified, which keeps it complete for
+    // samplers that use a mip filter.
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, GLint(mipmaps.size() - 1)));
+
+    last_applied_sampler = linear_clamp;
+
+    const auto is_compressed = image_format_is_block_compressed(format);
+
+    for (size_t level = 0; level < mipmaps.size(); ++level)
+    {
+        const auto level_width  = mipmap_extent(width, uint32_t(level));
+        const auto level_height = mipmap_extent(height, uint32_t(level));
+
+        if (is_compressed)
+        {
+            GL_CALL(glCompressedTexImage2D(
+                GL_TEXTURE_2D,
+                GLint(level),
+                GLenum(format_gl.internal_format),
+                GLsizei(level_width),
+                GLsizei(level_height),
+                /*border: */ 0,
+                GLsizei(image_slice_pitch(level_width, level_height, format)),
+                mipmaps[level]));
+        }
+        else
+        {
+            GL_CALL(glTexImage2D(GL_TEXTURE_2D,
+                                 GLint(level),
+                                 format_gl.internal_format,
+                                 GLsizei(level_width),
+                                 GLsizei(level_height),
+                                 /*border: */ 0,
+                                 format_gl.base_format,
+                                 format_gl.type,
+                                 mipmaps[level]));
+        }
+    }
+
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, previous_texture));
+    verify_opengl_state();
+}
+
+void OpenGLImage::destroy_texture() noexcept
+{
+#ifndef CERLIB_GFX_IS_GLES
+    for (const auto& handle : bindless_handles)
+    {
+        glMakeTextureHandleNonResidentARB(handle.second);
+    }
+
+    bindless_handles.clear();
+#endif
+
     if (gl_framebuffer_handle != 0)
     {
         glDeleteFramebuffers(1, &gl_framebuffer_handle);
@@ -8,17 +8,18 @@
 #include "cerlib/Image.hpp"
 #include "cerlib/Sampler.hpp"
 #include "graphics/ImageImpl.hpp"
+#include <cerlib/List.hpp>
 
 namespace cer::details
 {
 class OpenGLImage final : public ImageImpl
 {
   public:
-    explicit OpenGLImage(GraphicsDevice& parent_device,
-                         uint32_t        width,
-                         uint32_t        height,
-                         ImageFormat     format,
-                         const void*     data);
+    explicit OpenGLImage(GraphicsDevice&              parent_device,
+                         uint32_t                     width,
+                         uint32_t                     height,
+                         ImageFormat                  format,
+                         std::span<const void* const> mipmaps);
 
     // Canvas overload
     explicit OpenGLImage(GraphicsDevice& parent_device,
@@ -31,9 +32,24 @@ class OpenGLImage final : public ImageImpl
 
     ~OpenGLImage() noexcept override;
 
+    // Replaces the contents of a non-canvas image. The texture is updated in place if the
+    // extent, format and number of mipmaps stay the same.
+    void replace_contents(uint32_t                     width,
+                          uint32_t                     height,
+                          ImageFormat                  format,
+                          std::span<const void* const> mipmaps);
+
     GLuint              gl_handle{};
     GLuint              gl_framebuffer_handle{};
     OpenGLFormatTriplet gl_format_triplet{};
     Sampler             last_applied_sampler{};
+
+    // Resident bindless handles of the image, by the sampler object they were created with.
+    PairList<GLuint, GLuint64> bindless_handles;
+
+  private:
+    void create_texture(std::span<const void* const> mipmaps);
+
+    void destroy_texture() noexcept;
 };
 } // namespace cer::details
@@ -50,6 +50,25 @@ auto cer::details::convert_to_opengl_pixel_format(ImageFormat format) -> OpenGLF
     constexpr auto red_gl = GL_RED_EXT;
 #endif
 
+#ifdef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+    constexpr auto bc1      = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+    constexpr auto bc1_srgb = GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT;
+    constexpr auto bc3      = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    constexpr auto bc3_srgb = GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT;
+#else
+    // GL_EXT_texture_compression_s3tc and GL_EXT_texture_compression_s3tc_srgb
+    constexpr auto bc1      = 0x83F1;
+    constexpr auto bc1_srgb = 0x8C4D;
+    constexpr auto bc3      = 0x83F3;
+    constexpr auto bc3_srgb = 0x8C4F;
+#endif
+
+    // Compressed formats are uploaded with glCompressedTexImage2D(), which only needs
+    // the internal format.
+    const auto compressed = [](GLint internal_format) {
+        return OpenGLFormatTriplet{.internal_format = internal_format};
+    };
+
     switch (format)
     {
         case ImageFormat::R8G8B8A8_UNorm:
@@ -72,6 +91,15 @@ auto cer::details::convert_to_opengl_pixel_format(ImageFormat format) -> OpenGLF
                 .type            = GL_UNSIGNED_BYTE,
             };
 
+        case ImageFormat::BC1_UNorm: return compressed(bc1);
+        case ImageFormat::BC1_Srgb: return compressed(bc1_srgb);
+        case ImageFormat::BC3_UNorm: return compressed(bc3);
+        case ImageFormat::BC3_Srgb: return compressed(bc3_srgb);
+        case ImageFormat::ETC2_RGB8_UNorm: return compressed(GL_COMPRESSED_RGB8_ETC2);
+        case ImageFormat::ETC2_RGB8_Srgb: return compressed(GL_COMPRESSED_SRGB8_ETC2);
+        case ImageFormat::ETC2_RGBA8_UNorm: return compressed(GL_COMPRESSED_RGBA8_ETC2_EAC);
+        case ImageFormat::ETC2_RGBA8_Srgb: return compressed(GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC);
+
         default:
             throw std::runtime_error{fmt::format("Unsupported texture format {}", int(format))};
     }
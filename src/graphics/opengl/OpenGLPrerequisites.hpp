@@ -41,6 +41,9 @@ struct OpenGLFeatures
     bool buffer_storage{};
     bool texture_storage{};
     bool bindless_textures{};
+    bool texture_compression_bc{};
+    bool texture_compression_etc2{};
+    bool sync_objects{};
 };
 
 struct OpenGLFormatTriplet
@@ -11,7 +11,8 @@ namespace cer::details
 {
 OpenGLPrivateShader::OpenGLPrivateShader(std::string_view name,
                                          GLenum           type,
-                                         std::string_view glsl_code)
+                                         std::string_view glsl_code,
+                                         std::string_view glsl_header)
     : name(name)
 {
     log_verbose("Compiling OpenGL shader '{}'", name);
@@ -58,11 +59,18 @@ OpenGLPrivateShader::OpenGLPrivateShader(std::string_view name,
     auto code_strings = List<std::string_view>{};
 
     // https://en.wikipedia.org/wiki/OpenGL_Shading_Language#Versions
+    if (!glsl_header.empty())
+    {
+        code_strings.push_back(glsl_header);
+    }
+    else
+    {
 #ifdef CERLIB_GFX_IS_GLES
-    code_strings.emplace_back("#version 300 es\n\n");
+        code_strings.emplace_back("#version 300 es\n\n");
 #else
-    code_strings.emplace_back("#version 140\n\n");
+        code_strings.emplace_back("#version 140\n\n");
 #endif
+    }
 
     if (type == GL_FRAGMENT_SHADER)
     {
@@ -18,7 +18,12 @@ class OpenGLPrivateShader final
   public:
     explicit OpenGLPrivateShader() = default;
 
-    explicit OpenGLPrivateShader(std::string_view name, GLenum type, std::string_view glsl_code);
+    // glsl_header replaces the default #version directive, e.g. to require a newer version
+    // or to enable extensions.
+    explicit OpenGLPrivateShader(std::string_view name,
+                                 GLenum           type,
+                                 std::string_view glsl_code,
+                                 std::string_view glsl_header = {});
 
     forbid_copy(OpenGLPrivateShader);
 
@@ -6,15 +6,42 @@
 #include "OpenGLGraphicsDevice.hpp"
 #include "OpenGLImage.hpp"
 #include "cerlib/Logging.hpp"
+#include "util/narrow_cast.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <numeric>
 
+#include "SpriteBatchImages.glsl.hpp"
+#include "SpriteBatchImagesBindless.glsl.hpp"
 #include "SpriteBatchPSDefault.frag.hpp"
 #include "SpriteBatchPSMonochromatic.frag.hpp"
 #include "SpriteBatchVS.vert.hpp"
 
 namespace cer::details
 {
+class OpenGLRetainedTextData final : public RetainedTextData
+{
+  public:
+    OpenGLBuffer vbo;
+    OpenGLBuffer ibo;
+    OpenGLVao    vao;
+
+    // The number of glyph quads the buffers can hold.
+    uint32_t capacity{};
+};
+
+static constexpr auto sprite_vertex_elements = std::array{
+    VertexElement::Vector4,
+    VertexElement::Vector4,
+    VertexElement::Vector2,
+    VertexElement::Float,
+};
+
+// The attribute location of SpriteBatch::Vertex::color.
+static constexpr auto color_attribute_index = GLuint(1);
+
 OpenGLSpriteBatch::OpenGLSpriteBatch(GraphicsDevice& device_impl, FrameStats& draw_stats)
     : SpriteBatch(device_impl, draw_stats)
 {
@@ -22,19 +49,69 @@ OpenGLSpriteBatch::OpenGLSpriteBatch(GraphicsDevice& device_impl, FrameStats& dr
     verify_opengl_state_x();
     log_verbose("  - State is clean");
 
+    const auto& opengl_device = static_cast<const OpenGLGraphicsDevice&>(parent_device());
+
+    m_use_bindless_images = opengl_device.opengl_features().bindless_textures;
+
+    // Bindless images are passed to the shaders as handles, so their number is only limited
+    // by the size of the handle array. Each handle occupies two of the fragment shader's
+    // uniform components, a few of which are left to the driver.
+    if (m_use_bindless_images)
+    {
+        auto max_uniform_components = GLint{};
+        GL_CALL(glGetIntegerv(GL_MAX_FRAGMENT_UNIFORM_COMPONENTS, &max_uniform_components));
+
+        const auto handle_capacity = uint32_t(std::max(max_uniform_components - 16, 0)) / 2;
+
+        m_sprite_image_count = std::min(handle_capacity, max_bindless_sprite_images);
+
+        // Texture units would allow for more images per batch.
+        m_use_bindless_images = m_sprite_image_count > max_sprite_images;
+    }
+
+    // Otherwise every image of a batch occupies its own texture unit. OpenGL guarantees 16
+    // of them, but don't rely on that.
+    if (!m_use_bindless_images)
+    {
+        auto max_texture_units = GLint{};
+        GL_CALL(glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &max_texture_units));
+
+        m_sprite_image_count =
+            max_texture_units >= GLint(max_sprite_images) ? max_sprite_images : 8u;
+    }
+
+    log_verbose("  - Sprite batches use up to {} {}images",
+                m_sprite_image_count,
+                m_use_bindless_images ? "bindless " : "");
+
     log_verbose("Creating OpenGLSpriteBatch shaders");
 
     m_sprite_vertex_shader = OpenGLPrivateShader("SpriteBatchVSMain",
                                                  GL_VERTEX_SHADER,
                                                  SpriteBatchVS_vert_string_view());
 
-    auto ps_default = OpenGLPrivateShader{"SpriteBatchPSDefault",
-                                          GL_FRAGMENT_SHADER,
-                                          SpriteBatchPSDefault_frag_string_view()};
-
-    auto ps_monochromatic = OpenGLPrivateShader{"SpriteBatchPSMonochromatic",
-                                                GL_FRAGMENT_SHADER,
-                                                SpriteBatchPSMonochromatic_frag_string_view()};
+    const auto ps_header =
+        m_use_bindless_images
+            ? std::string_view{"#version 400\n#extension GL_ARB_bindless_texture : require\n\n"}
+            : std::string_view{};
+
+    const auto ps_prologue =
+        fmt::format("#define SPRITE_IMAGE_COUNT {}\n{}",
+                    m_sprite_image_count,
+                    m_use_bindless_images ? SpriteBatchImagesBindless_glsl_string_view()
+                                          : SpriteBatchImages_glsl_string_view());
+
+    auto ps_default = OpenGLPrivateShader{
+        "SpriteBatchPSDefault",
+        GL_FRAGMENT_SHADER,
+        ps_prologue + std::string{SpriteBatchPSDefault_frag_string_view()},
+        ps_header};
+
+    auto ps_monochromatic = OpenGLPrivateShader{
+        "SpriteBatchPSMonochromatic",
+        GL_FRAGMENT_SHADER,
+        ps_prologue + std::string{SpriteBatchPSMonochromatic_frag_string_view()},
+        ps_header};
 
     m_default_sprite_shader_program = OpenGLShaderProgram{m_sprite_vertex_shader, ps_default};
     m_default_sprite_shader_program_u_transformation =
@@ -44,6 +121,35 @@ OpenGLSpriteBatch::OpenGLSpriteBatch(GraphicsDevice& device_impl, FrameStats& dr
     m_monochromatic_shader_program_u_transformation =
         GL_CALL(glGetUniformLocation(m_monochromatic_shader_program.gl_handle, "Transformation"));
 
+    if (m_use_bindless_images)
+    {
+        m_default_sprite_shader_program_u_image_handles =
+            m_default_sprite_shader_program.uniform_location("SpriteImageHandles[0]");
+
+        m_monochromatic_shader_program_u_image_handles =
+            m_monochromatic_shader_program.uniform_location("SpriteImageHandles[0]");
+    }
+    else
+    {
+        // The sprite image with index i is bound to texture slot i.
+        auto image_slots = std::array<GLint, max_sprite_images>{};
+        std::iota(image_slots.begin(), image_slots.end(), 0);
+
+        GLuint previous_program = 0;
+        GL_CALL(glGetIntegerv(GL_CURRENT_PROGRAM, reinterpret_cast<GLint*>(&previous_program)));
+
+        for (const auto* program :
+             {&m_default_sprite_shader_program, &m_monochromatic_shader_program})
+        {
+            GL_CALL(glUseProgram(program->gl_handle));
+            GL_CALL(glUniform1iv(program->uniform_location("SpriteImages[0]"),
+                                 GLsizei(m_sprite_image_count),
+                                 image_slots.data()));
+        }
+
+        GL_CALL(glUseProgram(previous_program));
+    }
+
     log_verbose("  - Success");
 
     // Vertex buffer
@@ -85,18 +191,16 @@ OpenGLSpriteBatch::OpenGLSpriteBatch(GraphicsDevice& device_impl, FrameStats& dr
     }
 
     // VAO
-    m_vao = OpenGLVao{
-        m_vbo.gl_handle,
-        m_ibo.gl_handle,
-        {{
-            VertexElement::Vector4,
-            VertexElement::Vector4,
-            VertexElement::Vector2,
-        }},
-    };
+    m_vao = OpenGLVao{m_vbo.gl_handle, m_ibo.gl_handle, sprite_vertex_elements};
 }
 
-OpenGLSpriteBatch::~OpenGLSpriteBatch() noexcept = default;
+OpenGLSpriteBatch::~OpenGLSpriteBatch() noexcept
+{
+    for (const auto& sampler_object : m_sampler_objects)
+    {
+        glDeleteSamplers(1, &sampler_object.gl_handle);
+    }
+}
 
 void OpenGLSpriteBatch::prepare_for_rendering()
 {
@@ -107,6 +211,9 @@ void OpenGLSpriteBatch::prepare_for_rendering()
 
     opengl_device.bind_vao(m_vao);
 
+    // Retained text may have bound its own vertex buffer in the meantime.
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, m_vbo.gl_handle));
+
     if (const auto* sprite_shader =
             static_cast<const OpenGLUserShader*>(this->sprite_shader().impl());
         sprite_shader != nullptr)
@@ -132,15 +239,28 @@ void OpenGLSpriteBatch::prepare_for_rendering()
     }
 }
 
-void OpenGLSpriteBatch::set_up_batch(const Image&              image,
-                                     SpriteShaderKind          shader_kind,
-                                     [[maybe_unused]] uint32_t start,
-                                     [[maybe_unused]] uint32_t count)
+auto OpenGLSpriteBatch::max_batch_image_count() const -> uint32_t
+{
+    return m_sprite_image_count;
+}
+
+void OpenGLSpriteBatch::set_up_batch(std::span<const BatchImage> images,
+                                     SpriteShaderKind            shader_kind,
+                                     [[maybe_unused]] uint32_t   start,
+                                     [[maybe_unused]] uint32_t   count)
+{
+    apply_batch_state(images, shader_kind, current_transformation());
+}
+
+void OpenGLSpriteBatch::apply_batch_state(std::span<const BatchImage> images,
+                                          SpriteShaderKind            shader_kind,
+                                          const Matrix&               transformation)
 {
     auto& opengl_device = static_cast<OpenGLGraphicsDevice&>(parent_device());
 
     const OpenGLShaderProgram* shader_program   = nullptr;
     GLint                      u_transformation = -1;
+    GLint                      u_image_handles  = -1;
 
     switch (shader_kind)
     {
@@ -155,12 +275,14 @@ void OpenGLSpriteBatch::set_up_batch(const Image&              image,
             {
                 shader_program   = &m_default_sprite_shader_program;
                 u_transformation = m_default_sprite_shader_program_u_transformation;
+                u_image_handles  = m_default_sprite_shader_program_u_image_handles;
             }
             break;
         }
         case SpriteShaderKind::Monochromatic: {
             shader_program   = &m_monochromatic_shader_program;
             u_transformation = m_monochromatic_shader_program_u_transformation;
+            u_image_handles  = m_monochromatic_shader_program_u_image_handles;
             break;
         }
     }
@@ -257,56 +379,91 @@ void OpenGLSpriteBatch::set_up_batch(const Image&              image,
 
         shader_impl->clear_dirty_scalar_parameters();
 
-        for (const auto& param : shader_impl->dirty_image_parameters())
-        {
+        const auto bind_image_parameter = [this](const ShaderParameter& param) {
             // We don't have to update the shader program's uniforms, because they were
             // already set during construction.
             // Instead, we have to figure out which texture slots those parameters correspond
             // to and bind the parameter's images to those slots.
-            auto* opengl_image = static_cast<OpenGLImage*>(param->image.impl());
+            auto* opengl_image = static_cast<OpenGLImage*>(param.image.impl());
 
-            glActiveTexture(GL_TEXTURE0 + texture_slot_base_offset + param->offset);
+            glActiveTexture(GL_TEXTURE0 + texture_slot_base_offset + param.offset);
             glBindTexture(GL_TEXTURE_2D, opengl_image != nullptr ? opengl_image->gl_handle : 0);
 
             if (opengl_image != nullptr)
             {
                 // TODO: make the sampler a parameter-based setting
-                constexpr auto sampler = linear_repeat;
-                apply_sampler_to_gl_context(sampler);
-                opengl_image->last_applied_sampler = sampler;
+                apply_sampler(GLuint(texture_slot_base_offset + param.offset),
+                              *opengl_image,
+                              linear_repeat);
+            }
+        };
+
+        if (m_have_image_parameter_slots_changed)
+        {
+            // A batch of the built-in shaders has replaced the parameters' images with its
+            // own, so all of them have to be bound again.
+            for (const auto* param : shader_impl->image_parameters())
+            {
+                bind_image_parameter(*param);
+            }
+
+            m_have_image_parameter_slots_changed = false;
+        }
+        else
+        {
+            for (const auto* param : shader_impl->dirty_image_parameters())
+            {
+                bind_image_parameter(*param);
             }
         }
 
         shader_impl->clear_dirty_image_parameters();
     }
 
-    const auto transformation = current_transformation();
     GL_CALL(glUniformMatrix4fv(u_transformation, 1, GL_FALSE, transformation.data()));
 
-    auto* opengl_image = static_cast<OpenGLImage*>(image.impl());
+    assert(!images.empty() && images.size() <= m_sprite_image_count);
 
-    GL_CALL(glActiveTexture(GL_TEXTURE0));
-    GL_CALL(glBindTexture(GL_TEXTURE_2D, opengl_image->gl_handle));
+    // Text is drawn with nearest neighbor interpolation.
+    const auto sampler =
+        *shader_program == m_monochromatic_shader_program ? point_clamp : current_sampler();
 
-    const auto sampler = current_sampler();
+    if (u_image_handles != -1)
+    {
+        m_image_handles.clear();
+
+        for (const auto& image : images)
+        {
+            m_image_handles.push_back(
+                bindless_image_handle(*static_cast<OpenGLImage*>(image.image.impl()), sampler));
+        }
 
-    if (*shader_program == m_monochromatic_shader_program)
+        // Each uvec2 of the handle array holds the low and high half of a handle.
+        GL_CALL(glUniform2uiv(u_image_handles,
+                              GLsizei(m_image_handles.size()),
+                              reinterpret_cast<const GLuint*>(m_image_handles.data())));
+
+        return;
+    }
+
+    // Bind the images in reverse order, so that slot 0 is the active one afterwards.
+    for (auto i = images.size(); i-- > 0;)
     {
-        // We're drawing text. Use nearest neighbor interpolation.
-        apply_sampler_to_gl_context(point_clamp);
+        auto* opengl_image = static_cast<OpenGLImage*>(images[i].image.impl());
+
+        GL_CALL(glActiveTexture(GL_TEXTURE0 + GLenum(i)));
+        GL_CALL(glBindTexture(GL_TEXTURE_2D, opengl_image->gl_handle));
+
+        apply_sampler(GLuint(i), *opengl_image, sampler);
     }
-    else if (opengl_image->last_applied_sampler != sampler)
+
+    if (images.size() > size_t(texture_slot_base_offset))
     {
-        // We're drawing sprites.
-        apply_sampler_to_gl_context(sampler);
-        opengl_image->last_applied_sampler = sampler;
+        m_have_image_parameter_slots_changed = true;
     }
 }
 
-void OpenGLSpriteBatch::fill_vertices_and_draw(uint32_t         batch_start,
-                                               uint32_t         batch_size,
-                                               const Rectangle& texture_size_and_inverse,
-                                               bool             flip_image_up_down)
+void OpenGLSpriteBatch::fill_vertices_and_draw(uint32_t batch_start, uint32_t batch_size)
 {
     constexpr bool use_buffer_sub_data = true;
 
@@ -342,11 +499,7 @@ void OpenGLSpriteBatch::fill_vertices_and_draw(uint32_t         batch_start,
                                                   map_flags));
     }
 
-    fill_sprite_vertices(vertices,
-                         batch_start,
-                         batch_size,
-                         texture_size_and_inverse,
-                         flip_image_up_down);
+    fill_sprite_vertices(vertices, batch_start, batch_size);
 
     if (use_buffer_sub_data)
     {
@@ -373,9 +526,110 @@ void OpenGLSpriteBatch::fill_vertices_and_draw(uint32_t         batch_start,
 
 void OpenGLSpriteBatch::on_end_rendering()
 {
+    // Sampler objects would override the sampling state of textures that others bind.
+    for (GLuint slot = 0; slot < m_bound_sampler_object_count; ++slot)
+    {
+        GL_CALL(glBindSampler(slot, 0));
+    }
+
+    m_bound_sampler_object_count = 0;
+
     verify_opengl_state();
 }
 
+auto OpenGLSpriteBatch::create_retained_text_data() -> std::unique_ptr<RetainedTextData>
+{
+    return std::make_unique<OpenGLRetainedTextData>();
+}
+
+void OpenGLSpriteBatch::upload_retained_text_vertices(RetainedTextData&       data,
+                                                      std::span<const Vertex> vertices)
+{
+    auto&      gl_data      = static_cast<OpenGLRetainedTextData&>(data);
+    const auto sprite_count = narrow_cast<uint32_t>(vertices.size() / vertices_per_sprite);
+
+    if (sprite_count <= gl_data.capacity)
+    {
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, gl_data.vbo.gl_handle));
+        GL_CALL(glBufferSubData(GL_ARRAY_BUFFER,
+                                0,
+                                GLsizeiptr(vertices.size_bytes()),
+                                vertices.data()));
+        return;
+    }
+
+    // Don't let the new index buffer binding leak into the sprite VAO.
+    GL_CALL(glBindVertexArray(0));
+
+    auto indices = List<uint32_t>{};
+    indices.reserve(size_t(sprite_count) * indices_per_sprite);
+
+    for (uint32_t i = 0; i < sprite_count * vertices_per_sprite; i += vertices_per_sprite)
+    {
+        indices.push_back(i);
+        indices.push_back(i + 1);
+        indices.push_back(i + 2);
+
+        indices.push_back(i + 1);
+        indices.push_back(i + 3);
+        indices.push_back(i + 2);
+    }
+
+    gl_data.vbo =
+        OpenGLBuffer{GL_ARRAY_BUFFER, vertices.size_bytes(), GL_STATIC_DRAW, vertices.data()};
+
+    gl_data.ibo = OpenGLBuffer{GL_ELEMENT_ARRAY_BUFFER,
+                               sizeof(uint32_t) * indices.size(),
+                               GL_STATIC_DRAW,
+                               indices.data()};
+
+    gl_data.vao = OpenGLVao{gl_data.vbo.gl_handle, gl_data.ibo.gl_handle, sprite_vertex_elements};
+
+    // The color is specified when drawing, see draw_retained_text().
+    GL_CALL(glBindVertexArray(gl_data.vao.gl_handle));
+    GL_CALL(glDisableVertexAttribArray(color_attribute_index));
+    GL_CALL(glBindVertexArray(0));
+
+    gl_data.capacity = sprite_count;
+}
+
+void OpenGLSpriteBatch::draw_retained_text(const RetainedTextData& data,
+                                           const Matrix&           transformation,
+                                           const Color&            color)
+{
+    auto&       opengl_device = static_cast<OpenGLGraphicsDevice&>(parent_device());
+    const auto& gl_data       = static_cast<const OpenGLRetainedTextData&>(data);
+
+    opengl_device.bind_vao(gl_data.vao);
+
+    // The VAO doesn't source the color from the vertex buffer, so the constant attribute
+    // value is used for all vertices instead.
+    GL_CALL(glVertexAttrib4f(color_attribute_index, color.r, color.g, color.b, color.a));
+
+    for (const auto& run : data.runs)
+    {
+        const auto image_size  = run.image.size();
+        const auto batch_image = BatchImage{
+            .image = run.image,
+            .texture_size_and_inverse =
+                Rectangle{image_size.x, image_size.y, 1.0f / image_size.x, 1.0f / image_size.y},
+        };
+
+        // Glyphs are set up exactly like the ones that draw_string() queues.
+        apply_batch_state({&batch_image, 1}, SpriteShaderKind::Monochromatic, transformation);
+
+        const auto start_index = size_t(run.start) * indices_per_sprite;
+        const auto index_count = run.count * indices_per_sprite;
+
+        GL_CALL(glDrawElements(GL_TRIANGLES,
+                               GLsizei(index_count),
+                               GL_UNSIGNED_INT,
+                               reinterpret_cast<const void*>(start_index * sizeof(uint32_t))));
+
+        ++frame_stats().draw_calls;
+    }
+}
+
 void OpenGLSpriteBatch::set_default_render_state()
 {
     GL_CALL(glDisable(GL_DEPTH_TEST));
@@ -384,6 +638,33 @@ void OpenGLSpriteBatch::set_default_render_state()
     GL_CALL(glCullFace(GL_FRONT));
 }
 
+static auto convert(ImageFilter filter) -> GLint
+{
+    switch (filter)
+    {
+        case ImageFilter::Point: return GL_NEAREST;
+        case ImageFilter::Linear: return GL_LINEAR;
+    }
+
+    return GL_LINEAR;
+}
+
+static auto min_filter(const Sampler& sampler) -> GLint
+{
+    const auto is_point = sampler.filter == ImageFilter::Point;
+
+    switch (sampler.mip_filter)
+    {
+        case MipFilter::None: return convert(sampler.filter);
+        case MipFilter::Point:
+            return is_point ? GL_NEAREST_MIPMAP_NEAREST : GL_LINEAR_MIPMAP_NEAREST;
+        case MipFilter::Linear:
+            return is_point ? GL_NEAREST_MIPMAP_LINEAR : GL_LINEAR_MIPMAP_LINEAR;
+    }
+
+    return convert(sampler.filter);
+}
+
 static auto convert(ImageAddressMode mode) -> GLenum
 {
     switch (mode)
@@ -405,17 +686,8 @@ static auto convert(ImageAddressMode mode) -> GLenum
 
 void OpenGLSpriteBatch::apply_sampler_to_gl_context(const Sampler& sampler)
 {
-    switch (sampler.filter)
-    {
-        case ImageFilter::Point:
-            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
-            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
-            break;
-        case ImageFilter::Linear:
-            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
-            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
-            break;
-    }
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, min_filter(sampler)));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, convert(sampler.filter)));
 
     GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GLint(convert(sampler.address_u))));
     GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GLint(convert(sampler.address_v))));
@@ -425,6 +697,73 @@ void OpenGLSpriteBatch::apply_sampler_to_gl_context(const Sampler& sampler)
     // TODO: sampler.borderColor
 }
 
+void OpenGLSpriteBatch::apply_sampler(GLuint slot, OpenGLImage& image, const Sampler& sampler)
+{
+    if (m_use_bindless_images)
+    {
+        // Bindless handles make the state of their texture immutable, so the sampler has
+        // to be applied as a sampler object instead.
+        GL_CALL(glBindSampler(slot, sampler_object(sampler)));
+        m_bound_sampler_object_count = std::max(m_bound_sampler_object_count, slot + 1);
+    }
+    else if (image.last_applied_sampler != sampler)
+    {
+        apply_sampler_to_gl_context(sampler);
+        image.last_applied_sampler = sampler;
+    }
+}
+
+auto OpenGLSpriteBatch::sampler_object(const Sampler& sampler) -> GLuint
+{
+    if (const auto it = std::ranges::find(m_sampler_objects, sampler, &SamplerObject::sampler);
+        it != m_sampler_objects.cend())
+    {
+        return it->gl_handle;
+    }
+
+    auto gl_handle = GLuint{};
+    GL_CALL(glGenSamplers(1, &gl_handle));
+
+    GL_CALL(glSamplerParameteri(gl_handle, GL_TEXTURE_MIN_FILTER, min_filter(sampler)));
+    GL_CALL(glSamplerParameteri(gl_handle, GL_TEXTURE_MAG_FILTER, convert(sampler.filter)));
+    GL_CALL(
+        glSamplerParameteri(gl_handle, GL_TEXTURE_WRAP_S, GLint(convert(sampler.address_u))));
+    GL_CALL(
+        glSamplerParameteri(gl_handle, GL_TEXTURE_WRAP_T, GLint(convert(sampler.address_v))));
+
+    m_sampler_objects.push_back({.sampler = sampler, .gl_handle = gl_handle});
+
+    return gl_handle;
+}
+
+auto OpenGLSpriteBatch::bindless_image_handle([[maybe_unused]] OpenGLImage&   image,
+                                              [[maybe_unused]] const Sampler& sampler)
+    -> GLuint64
+{
+#ifdef CERLIB_GFX_IS_GLES
+    throw std::logic_error{"Bindless images are not supported by OpenGL ES."};
+#else
+    const auto gl_sampler = sampler_object(sampler);
+
+    if (const auto it = std::ranges::find(image.bindless_handles,
+                                          gl_sampler,
+                                          &std::pair<GLuint, GLuint64>::first);
+        it != image.bindless_handles.cend())
+    {
+        return it->second;
+    }
+
+    // The handle is created once per image and sampler, and stays resident until the
+    // image is destroyed.
+    const auto handle = GL_CALL(glGetTextureSamplerHandleARB(image.gl_handle, gl_sampler));
+    GL_CALL(glMakeTextureHandleResidentARB(handle));
+
+    image.bindless_handles.emplace_back(gl_sampler, handle);
+
+    return handle;
+#endif
+}
+
 static auto convert(BlendFunction function) -> GLenum
 {
     switch (function)
@@ -14,6 +14,8 @@
 
 namespace cer::details
 {
+class OpenGLImage;
+
 class OpenGLSpriteBatch final : public SpriteBatch
 {
   public:
@@ -21,6 +23,13 @@ class OpenGLSpriteBatch final : public SpriteBatch
     // So image parameters in user-defined shaders must begin after that.
     static constexpr int texture_slot_base_offset = 1;
 
+    // The most images that a batch of the built-in sprite shaders binds at once.
+    static constexpr uint32_t max_sprite_images = 16;
+
+    // The same, when the images are passed as bindless handles. Devices with few uniform
+    // components allow for less.
+    static constexpr uint32_t max_bindless_sprite_images = 256;
+
     explicit OpenGLSpriteBatch(GraphicsDevice& device_impl, FrameStats& draw_stats);
 
     forbid_copy_and_move(OpenGLSpriteBatch);
@@ -30,23 +39,42 @@ class OpenGLSpriteBatch final : public SpriteBatch
   protected:
     void prepare_for_rendering() override;
 
-    void set_up_batch(const Image&     image,
-                      SpriteShaderKind shader_kind,
-                      uint32_t         start,
-                      uint32_t         count) override;
+    auto max_batch_image_count() const -> uint32_t override;
+
+    void set_up_batch(std::span<const BatchImage> images,
+                      SpriteShaderKind            shader_kind,
+                      uint32_t                    start,
+                      uint32_t                    count) override;
 
-    void fill_vertices_and_draw(uint32_t         batch_start,
-                                uint32_t         batch_size,
-                                const Rectangle& texture_size_and_inverse,
-                                bool             flip_image_up_down) override;
+    void fill_vertices_and_draw(uint32_t batch_start, uint32_t batch_size) override;
 
     void on_end_rendering() override;
 
+    auto create_retained_text_data() -> std::unique_ptr<RetainedTextData> override;
+
+    void upload_retained_text_vertices(RetainedTextData&       data,
+                                       std::span<const Vertex> vertices) override;
+
+    void draw_retained_text(const RetainedTextData& data,
+                            const Matrix&           transformation,
+                            const Color&            color) override;
+
   private:
     void set_default_render_state();
 
+    // Selects the shader program, sampler and images of a batch.
+    void apply_batch_state(std::span<const BatchImage> images,
+                           SpriteShaderKind            shader_kind,
+                           const Matrix&               transformation);
+
     static void apply_sampler_to_gl_context(const Sampler& sampler);
 
+    void apply_sampler(GLuint slot, OpenGLImage& image, const Sampler& sampler);
+
+    auto sampler_object(const Sampler& sampler) -> GLuint;
+
+    auto bindless_image_handle(OpenGLImage& image, const Sampler& sampler) -> GLuint64;
+
     void apply_blend_state_to_gl_context(const BlendState& blend_state);
 
     void on_shader_destroyed(ShaderImpl& shader) override;
@@ -60,11 +88,31 @@ class OpenGLSpriteBatch final : public SpriteBatch
     // Uniform locations for built-in shader programs.
     GLint m_default_sprite_shader_program_u_transformation{-1};
     GLint m_monochromatic_shader_program_u_transformation{-1};
+    GLint m_default_sprite_shader_program_u_image_handles{-1};
+    GLint m_monochromatic_shader_program_u_image_handles{-1};
 
     std::unordered_map<const OpenGLUserShader*, OpenGLShaderProgram> m_custom_shader_programs;
 
     OpenGLShaderProgram* m_current_custom_shader_program{};
 
+    uint32_t m_sprite_image_count{};
+    bool     m_use_bindless_images{};
+
+    struct SamplerObject
+    {
+        Sampler sampler;
+        GLuint  gl_handle{};
+    };
+
+    // Sampler objects are only used together with bindless images. They are never modified
+    // once created, because bindless handles make their state immutable.
+    List<SamplerObject> m_sampler_objects;
+    GLuint              m_bound_sampler_object_count{};
+    List<GLuint64>      m_image_handles;
+
+    // Set when a batch bound images to the slots of user-defined shader image parameters.
+    bool m_have_image_parameter_slots_changed{};
+
     OpenGLBuffer              m_vbo;
     OpenGLBuffer              m_ibo;
     OpenGLVao                 m_vao;
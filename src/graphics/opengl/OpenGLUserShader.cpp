@@ -48,4 +48,18 @@ OpenGLUserShader::OpenGLUserShader(GraphicsDevice&  parent_device,
             fmt::format("Failed to compile the generated internal shader: {}", msg)};
     }
 }
+
+OpenGLUserShader::~OpenGLUserShader() noexcept
+{
+    if (gl_handle != 0)
+    {
+        glDeleteShader(gl_handle);
+        gl_handle = 0;
+    }
+}
+
+void OpenGLUserShader::swap_native_shader(ShaderImpl& other)
+{
+    std::swap(gl_handle, static_cast<OpenGLUserShader&>(other).gl_handle);
+}
 } // namespace cer::details
\ No newline at end of file
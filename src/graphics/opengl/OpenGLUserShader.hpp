@@ -16,6 +16,13 @@ class OpenGLUserShader final : public ShaderImpl
                               std::string_view glsl_code,
                               ParameterList    parameters);
 
+    forbid_copy_and_move(OpenGLUserShader);
+
+    ~OpenGLUserShader() noexcept override;
+
     GLuint gl_handle{};
+
+  protected:
+    void swap_native_shader(ShaderImpl& other) override;
 };
 } // namespace cer::details
\ No newline at end of file
@@ -208,6 +208,13 @@ STBIWDEF int stbi_write_jpg_to_func(
 
 STBIWDEF void stbi_flip_vertically_on_write(int flip_boolean);
 
+// cerlib: declared for the asset archive packer. Returns memory that must be released using
+// free().
+STBIWDEF unsigned char* stbi_zlib_compress(unsigned char* data,
+                                           int            data_len,
+                                           int*           out_len,
+                                           int            quality);
+
 #endif // INCLUDE_STB_IMAGE_WRITE_H
 
 #ifdef STB_IMAGE_WRITE_IMPLEMENTATION
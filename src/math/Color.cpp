@@ -58,44 +58,3 @@ auto cer::fastrand_color(const ColorInterval& interval) -> Color
         fastrand_float(interval.min.a, interval.max.a),
     };
 }
-
-
-auto cer::operator+(const Color& lhs, const Color& rhs) -> Color
-{
-    return {
-        lhs.r + rhs.r,
-        lhs.g + rhs.g,
-        lhs.b + rhs.b,
-        lhs.a + rhs.a,
-    };
-}
-
-auto cer::operator-(const Color& lhs, const Color& rhs) -> Color
-{
-    return {
-        lhs.r - rhs.r,
-        lhs.g - rhs.g,
-        lhs.b - rhs.b,
-        lhs.a - rhs.a,
-    };
-}
-
-auto cer::operator*(const Color& lhs, float rhs) -> Color
-{
-    return {
-        lhs.r * rhs,
-        lhs.g * rhs,
-        lhs.b * rhs,
-        lhs.a * rhs,
-    };
-}
-
-auto cer::operator*(float lhs, const Color& rhs) -> Color
-{
-    return {
-        lhs * rhs.r,
-        lhs * rhs.g,
-        lhs * rhs.b,
-        lhs * rhs.a,
-    };
-}
@@ -5,6 +5,7 @@ set(math_files
   Vector3.cpp
   Vector4.cpp
   Matrix.cpp
+  Float4.hpp
   Rectangle.cpp
   Color.cpp
 )
\ No newline at end of file
@@ -0,0 +1,256 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+// Internal header that provides a minimal 4-wide float vector on top of SSE or NEON,
+// with a scalar fallback. Math routines that process four floats at a time
+// (matrix rows, pairs of 2D points) are written once against this interface.
+//
+// Define CERLIB_DISABLE_SIMD to force the scalar implementation.
+
+#pragma once
+
+// clang-format off
+
+#if !defined(CERLIB_DISABLE_SIMD)
+#  if defined(__x86_64__) || defined(_M_X64) || defined(__SSE__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#    define CERLIB_SIMD_SSE 1
+#  elif defined(__aarch64__) || defined(_M_ARM64)
+#    define CERLIB_SIMD_NEON 1
+#  endif
+#endif
+
+// clang-format on
+
+#if CERLIB_SIMD_SSE
+#include <xmmintrin.h>
+#elif CERLIB_SIMD_NEON
+#include <arm_neon.h>
+#else
+#include <algorithm>
+#include <array>
+#endif
+
+namespace cer::details
+{
+#if CERLIB_SIMD_SSE
+using Float4 = __m128;
+
+inline auto load4(const float* values) -> Float4
+{
+    return _mm_loadu_ps(values);
+}
+
+inline void store4(float* destination, Float4 value)
+{
+    _mm_storeu_ps(destination, value);
+}
+
+inline auto set4(float x, float y, float z, float w) -> Float4
+{
+    return _mm_setr_ps(x, y, z, w);
+}
+
+inline auto splat4(float value) -> Float4
+{
+    return _mm_set1_ps(value);
+}
+
+inline auto add4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return _mm_add_ps(lhs, rhs);
+}
+
+inline auto sub4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return _mm_sub_ps(lhs, rhs);
+}
+
+inline auto mul4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return _mm_mul_ps(lhs, rhs);
+}
+
+inline auto div4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return _mm_div_ps(lhs, rhs);
+}
+
+inline auto min4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return _mm_min_ps(lhs, rhs);
+}
+
+inline auto max4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return _mm_max_ps(lhs, rhs);
+}
+
+inline auto first4(Float4 value) -> float
+{
+    return _mm_cvtss_f32(value);
+}
+
+// Returns {lhs[X], lhs[Y], rhs[Z], rhs[W]}.
+template <int X, int Y, int Z, int W>
+auto shuffle4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return _mm_shuffle_ps(lhs, rhs, _MM_SHUFFLE(W, Z, Y, X));
+}
+#elif CERLIB_SIMD_NEON
+using Float4 = float32x4_t;
+
+inline auto load4(const float* values) -> Float4
+{
+    return vld1q_f32(values);
+}
+
+inline void store4(float* destination, Float4 value)
+{
+    vst1q_f32(destination, value);
+}
+
+inline auto set4(float x, float y, float z, float w) -> Float4
+{
+    const float values[4]{x, y, z, w};
+    return vld1q_f32(values);
+}
+
+inline auto splat4(float value) -> Float4
+{
+    return vdupq_n_f32(value);
+}
+
+inline auto add4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return vaddq_f32(lhs, rhs);
+}
+
+inline auto sub4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return vsubq_f32(lhs, rhs);
+}
+
+inline auto mul4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return vmulq_f32(lhs, rhs);
+}
+
+inline auto div4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return vdivq_f32(lhs, rhs);
+}
+
+inline auto min4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return vminq_f32(lhs, rhs);
+}
+
+inline auto max4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return vmaxq_f32(lhs, rhs);
+}
+
+inline auto first4(Float4 value) -> float
+{
+    return vgetq_lane_f32(value, 0);
+}
+
+// Returns {lhs[X], lhs[Y], rhs[Z], rhs[W]}.
+// The compiler folds the lane moves into the matching permute instructions.
+template <int X, int Y, int Z, int W>
+auto shuffle4(Float4 lhs, Float4 rhs) -> Float4
+{
+    auto result = vdupq_n_f32(vgetq_lane_f32(lhs, X));
+    result      = vsetq_lane_f32(vgetq_lane_f32(lhs, Y), result, 1);
+    result      = vsetq_lane_f32(vgetq_lane_f32(rhs, Z), result, 2);
+    result      = vsetq_lane_f32(vgetq_lane_f32(rhs, W), result, 3);
+    return result;
+}
+#else
+struct Float4
+{
+    std::array<float, 4> values;
+};
+
+template <typename Func>
+auto apply4(Float4 lhs, Float4 rhs, Func&& func) -> Float4
+{
+    return {{
+        func(lhs.values[0], rhs.values[0]),
+        func(lhs.values[1], rhs.values[1]),
+        func(lhs.values[2], rhs.values[2]),
+        func(lhs.values[3], rhs.values[3]),
+    }};
+}
+
+inline auto load4(const float* values) -> Float4
+{
+    return {{values[0], values[1], values[2], values[3]}};
+}
+
+inline void store4(float* destination, Float4 value)
+{
+    std::ranges::copy(value.values, destination);
+}
+
+inline auto set4(float x, float y, float z, float w) -> Float4
+{
+    return {{x, y, z, w}};
+}
+
+inline auto splat4(float value) -> Float4
+{
+    return {{value, value, value, value}};
+}
+
+inline auto add4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return apply4(lhs, rhs, [](float a, float b) { return a + b; });
+}
+
+inline auto sub4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return apply4(lhs, rhs, [](float a, float b) { return a - b; });
+}
+
+inline auto mul4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return apply4(lhs, rhs, [](float a, float b) { return a * b; });
+}
+
+inline auto div4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return apply4(lhs, rhs, [](float a, float b) { return a / b; });
+}
+
+inline auto min4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return apply4(lhs, rhs, [](float a, float b) { return b < a ? b : a; });
+}
+
+inline auto max4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return apply4(lhs, rhs, [](float a, float b) { return a < b ? b : a; });
+}
+
+inline auto first4(Float4 value) -> float
+{
+    return value.values[0];
+}
+
+// Returns {lhs[X], lhs[Y], rhs[Z], rhs[W]}.
+template <int X, int Y, int Z, int W>
+auto shuffle4(Float4 lhs, Float4 rhs) -> Float4
+{
+    return {{lhs.values[X], lhs.values[Y], rhs.values[Z], rhs.values[W]}};
+}
+#endif
+
+// Returns {value[X], value[Y], value[Z], value[W]}.
+template <int X, int Y, int Z, int W>
+auto swizzle4(Float4 value) -> Float4
+{
+    return shuffle4<X, Y, Z, W>(value, value);
+}
+} // namespace cer::details
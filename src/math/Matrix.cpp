@@ -3,138 +3,47 @@
 // For conditions of distribution and use, see copyright notice in LICENSE.
 
 #include "cerlib/Matrix.hpp"
+#include "Float4.hpp"
+#include "cerlib/Rectangle.hpp"
 #include "cerlib/Vector2.hpp"
+#include <stdexcept>
 
-namespace cer
+namespace cer::details
 {
-auto Matrix::data() const -> const float*
-{
-    return &m11;
-}
-
-auto Matrix::begin() -> float*
-{
-    return &m11;
-}
+// Row-major 2x2 matrices packed as {m11, m12, m21, m22}.
 
-auto Matrix::begin() const -> const float*
+// Returns lhs * rhs.
+static auto mul_2x2(Float4 lhs, Float4 rhs) -> Float4
 {
-    return &m11;
+    return add4(mul4(lhs, swizzle4<0, 3, 0, 3>(rhs)),
+                mul4(swizzle4<1, 0, 3, 2>(lhs), swizzle4<2, 1, 2, 1>(rhs)));
 }
 
-auto Matrix::cbegin() const -> const float*
+// Returns adjugate(lhs) * rhs.
+static auto adj_mul_2x2(Float4 lhs, Float4 rhs) -> Float4
 {
-    return &m11;
-}
-
-auto Matrix::end() -> float*
-{
-    return &m11 + 16;
-}
-
-auto Matrix::end() const -> const float*
-{
-    return &m11 + 16;
-}
-
-auto Matrix::cend() const -> const float*
-{
-    return &m11 + 16;
-}
-} // namespace cer
-
-auto cer::operator*(const Matrix& lhs, const Matrix& rhs) -> Matrix
-{
-    return {
-        (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21) + (lhs.m13 * rhs.m31) + (lhs.m14 * rhs.m41),
-        (lhs.m11 * rhs.m12) + (lhs.m12 * rhs.m22) + (lhs.m13 * rhs.m32) + (lhs.m14 * rhs.m42),
-        (lhs.m11 * rhs.m13) + (lhs.m12 * rhs.m23) + (lhs.m13 * rhs.m33) + (lhs.m14 * rhs.m43),
-        (lhs.m11 * rhs.m14) + (lhs.m12 * rhs.m24) + (lhs.m13 * rhs.m34) + (lhs.m14 * rhs.m44),
-        (lhs.m21 * rhs.m11) + (lhs.m22 * rhs.m21) + (lhs.m23 * rhs.m31) + (lhs.m24 * rhs.m41),
-        (lhs.m21 * rhs.m12) + (lhs.m22 * rhs.m22) + (lhs.m23 * rhs.m32) + (lhs.m24 * rhs.m42),
-        (lhs.m21 * rhs.m13) + (lhs.m22 * rhs.m23) + (lhs.m23 * rhs.m33) + (lhs.m24 * rhs.m43),
-        (lhs.m21 * rhs.m14) + (lhs.m22 * rhs.m24) + (lhs.m23 * rhs.m34) + (lhs.m24 * rhs.m44),
-        (lhs.m31 * rhs.m11) + (lhs.m32 * rhs.m21) + (lhs.m33 * rhs.m31) + (lhs.m34 * rhs.m41),
-        (lhs.m31 * rhs.m12) + (lhs.m32 * rhs.m22) + (lhs.m33 * rhs.m32) + (lhs.m34 * rhs.m42),
-        (lhs.m31 * rhs.m13) + (lhs.m32 * rhs.m23) + (lhs.m33 * rhs.m33) + (lhs.m34 * rhs.m43),
-        (lhs.m31 * rhs.m14) + (lhs.m32 * rhs.m24) + (lhs.m33 * rhs.m34) + (lhs.m34 * rhs.m44),
-        (lhs.m41 * rhs.m11) + (lhs.m42 * rhs.m21) + (lhs.m43 * rhs.m31) + (lhs.m44 * rhs.m41),
-        (lhs.m41 * rhs.m12) + (lhs.m42 * rhs.m22) + (lhs.m43 * rhs.m32) + (lhs.m44 * rhs.m42),
-        (lhs.m41 * rhs.m13) + (lhs.m42 * rhs.m23) + (lhs.m43 * rhs.m33) + (lhs.m44 * rhs.m43),
-        (lhs.m41 * rhs.m14) + (lhs.m42 * rhs.m24) + (lhs.m43 * rhs.m34) + (lhs.m44 * rhs.m44),
-    };
+    return sub4(mul4(swizzle4<3, 3, 0, 0>(lhs), rhs),
+                mul4(swizzle4<1, 1, 2, 2>(lhs), swizzle4<2, 3, 0, 1>(rhs)));
 }
 
-auto cer::transpose(const Matrix& matrix) -> Matrix
+// Returns lhs * adjugate(rhs).
+static auto mul_adj_2x2(Float4 lhs, Float4 rhs) -> Float4
 {
-    // NOLINTBEGIN
-    return {
-        matrix.m11,
-        matrix.m21,
-        matrix.m31,
-        matrix.m41,
-        matrix.m12,
-        matrix.m22,
-        matrix.m32,
-        matrix.m42,
-        matrix.m13,
-        matrix.m23,
-        matrix.m33,
-        matrix.m43,
-        matrix.m14,
-        matrix.m24,
-        matrix.m34,
-        matrix.m44,
-    };
-    // NOLINTEND
-}
-
-auto cer::translate(Vector2 translation) -> Matrix
-{
-    const float x = translation.x;
-    const float y = translation.y;
-
-    return {
-        1,
-        0,
-        0,
-        0,
-        0,
-        1,
-        0,
-        0,
-        0,
-        0,
-        1,
-        0,
-        x,
-        y,
-        0,
-        1,
-    };
+    return sub4(mul4(lhs, swizzle4<3, 0, 3, 0>(rhs)),
+                mul4(swizzle4<1, 0, 3, 2>(lhs), swizzle4<2, 1, 2, 1>(rhs)));
 }
 
-auto cer::scale(Vector2 scale) -> Matrix
+static void verify_destination_size(size_t source_size, size_t destination_size)
 {
-    return {
-        scale.x,
-        0,
-        0,
-        0,
-        0,
-        scale.y,
-        0,
-        0,
-        0,
-        0,
-        1,
-        0,
-        0,
-        0,
-        0,
-        1,
-    };
+    if (destination_size < source_size)
+    {
+        throw std::invalid_argument{
+            fmt::format("The destination ({} elements) is smaller than the source ({} elements).",
+                        destination_size,
+                        source_size)};
+    }
 }
+} // namespace cer::details
 
 auto cer::rotate(float radians) -> Matrix
 {
@@ -171,4 +80,153 @@ auto cer::are_equal_within(const Matrix& lhs, const Matrix& rhs, float threshold
            equal_within(lhs.m33, rhs.m33, threshold) && equal_within(lhs.m34, rhs.m34, threshold) &&
            equal_within(lhs.m41, rhs.m41, threshold) && equal_within(lhs.m42, rhs.m42, threshold) &&
            equal_within(lhs.m43, rhs.m43, threshold) && equal_within(lhs.m44, rhs.m44, threshold);
-}
\ No newline at end of file
+}
+
+auto cer::inverse(const Matrix& matrix) -> std::optional<Matrix>
+{
+    using namespace details;
+
+    // Block-wise inversion: the matrix is split into the 2x2 matrices
+    // | A B |
+    // | C D |
+    // and the inverse is assembled from their adjugates and determinants.
+    const auto* data = matrix.data();
+    const auto  row0 = load4(data);
+    const auto  row1 = load4(data + 4);
+    const auto  row2 = load4(data + 8);
+    const auto  row3 = load4(data + 12);
+
+    const auto a = shuffle4<0, 1, 0, 1>(row0, row1);
+    const auto b = shuffle4<2, 3, 2, 3>(row0, row1);
+    const auto c = shuffle4<0, 1, 0, 1>(row2, row3);
+    const auto d = shuffle4<2, 3, 2, 3>(row2, row3);
+
+    // {|A|, |B|, |C|, |D|}
+    const auto det_sub = sub4(mul4(shuffle4<0, 2, 0, 2>(row0, row2), shuffle4<1, 3, 1, 3>(row1, row3)),
+                              mul4(shuffle4<1, 3, 1, 3>(row0, row2), shuffle4<0, 2, 0, 2>(row1, row3)));
+
+    const auto det_a = swizzle4<0, 0, 0, 0>(det_sub);
+    const auto det_b = swizzle4<1, 1, 1, 1>(det_sub);
+    const auto det_c = swizzle4<2, 2, 2, 2>(det_sub);
+    const auto det_d = swizzle4<3, 3, 3, 3>(det_sub);
+
+    const auto d_c = adj_mul_2x2(d, c);
+    const auto a_b = adj_mul_2x2(a, b);
+
+    auto x = sub4(mul4(det_d, a), mul_2x2(b, d_c));
+    auto w = sub4(mul4(det_a, d), mul_2x2(c, a_b));
+    auto y = sub4(mul4(det_b, c), mul_adj_2x2(d, a_b));
+    auto z = sub4(mul4(det_c, b), mul_adj_2x2(a, d_c));
+
+    // |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+    auto trace = mul4(a_b, swizzle4<0, 2, 1, 3>(d_c));
+    trace      = add4(trace, swizzle4<1, 0, 3, 2>(trace));
+    trace      = add4(trace, swizzle4<2, 3, 0, 1>(trace));
+
+    const auto det_m = sub4(add4(mul4(det_a, det_d), mul4(det_b, det_c)), trace);
+
+    if (first4(det_m) == 0.0f)
+    {
+        return std::nullopt;
+    }
+
+    const auto rcp_det_m = div4(set4(1.0f, -1.0f, -1.0f, 1.0f), det_m);
+
+    x = mul4(x, rcp_det_m);
+    y = mul4(y, rcp_det_m);
+    z = mul4(z, rcp_det_m);
+    w = mul4(w, rcp_det_m);
+
+    auto  result = Matrix{};
+    auto* dst    = result.begin();
+
+    store4(dst, shuffle4<3, 1, 3, 1>(x, y));
+    store4(dst + 4, shuffle4<2, 0, 2, 0>(x, y));
+    store4(dst + 8, shuffle4<3, 1, 3, 1>(z, w));
+    store4(dst + 12, shuffle4<2, 0, 2, 0>(z, w));
+
+    return result;
+}
+
+void cer::transform_points(std::span<const Vector2> points,
+                           const Matrix&            matrix,
+                           std::span<Vector2>       destination)
+{
+    using namespace details;
+
+    static_assert(sizeof(Vector2) == sizeof(float) * 2);
+
+    verify_destination_size(points.size(), destination.size());
+
+    // Two points are transformed at once, packed as {x0, y0, x1, y1}.
+    const auto x_axis = set4(matrix.m11, matrix.m12, matrix.m11, matrix.m12);
+    const auto y_axis = set4(matrix.m21, matrix.m22, matrix.m21, matrix.m22);
+    const auto offset = set4(matrix.m41, matrix.m42, matrix.m41, matrix.m42);
+
+    const auto* src   = reinterpret_cast<const float*>(points.data());
+    auto*       dst   = reinterpret_cast<float*>(destination.data());
+    const auto  count = points.size();
+    auto        i     = size_t(0);
+
+    for (; i + 2 <= count; i += 2)
+    {
+        const auto xy = load4(src + (i * 2));
+        const auto xs = swizzle4<0, 0, 2, 2>(xy);
+        const auto ys = swizzle4<1, 1, 3, 3>(xy);
+
+        store4(dst + (i * 2), add4(add4(mul4(xs, x_axis), mul4(ys, y_axis)), offset));
+    }
+
+    if (i < count)
+    {
+        destination[i] = transform_point(points[i], matrix);
+    }
+}
+
+void cer::transform_rects(std::span<const Rectangle> rects,
+                          const Matrix&              matrix,
+                          std::span<Rectangle>       destination)
+{
+    using namespace details;
+
+    verify_destination_size(rects.size(), destination.size());
+
+    const auto m11 = splat4(matrix.m11);
+    const auto m12 = splat4(matrix.m12);
+    const auto m21 = splat4(matrix.m21);
+    const auto m22 = splat4(matrix.m22);
+    const auto m41 = splat4(matrix.m41);
+    const auto m42 = splat4(matrix.m42);
+
+    for (size_t i = 0; i < rects.size(); ++i)
+    {
+        const auto& rect   = rects[i];
+        const auto  right  = rect.x + rect.width;
+        const auto  bottom = rect.y + rect.height;
+
+        // The four corners, as {top-left, top-right, bottom-left, bottom-right}.
+        const auto xs = set4(rect.x, right, rect.x, right);
+        const auto ys = set4(rect.y, rect.y, bottom, bottom);
+
+        const auto tx = add4(add4(mul4(xs, m11), mul4(ys, m21)), m41);
+        const auto ty = add4(add4(mul4(xs, m12), mul4(ys, m22)), m42);
+
+        // Reduce to {min_x, min_x, min_y, min_y} and {max_x, max_x, max_y, max_y}.
+        auto lo = min4(shuffle4<0, 1, 0, 1>(tx, ty), shuffle4<2, 3, 2, 3>(tx, ty));
+        auto hi = max4(shuffle4<0, 1, 0, 1>(tx, ty), shuffle4<2, 3, 2, 3>(tx, ty));
+        lo      = min4(lo, swizzle4<1, 0, 3, 2>(lo));
+        hi      = max4(hi, swizzle4<1, 0, 3, 2>(hi));
+
+        float lo_values[4];
+        float hi_values[4];
+        store4(lo_values, lo);
+        store4(hi_values, hi);
+
+        destination[i] = Rectangle{
+            lo_values[0],
+            lo_values[2],
+            hi_values[0] - lo_values[0],
+            hi_values[2] - lo_values[2],
+        };
+    }
+}
@@ -7,112 +7,6 @@
 
 namespace cer
 {
-auto Rectangle::left() const -> float
-{
-    return x;
-}
-
-auto Rectangle::top() const -> float
-{
-    return y;
-}
-
-auto Rectangle::right() const -> float
-{
-    return x + width;
-}
-
-auto Rectangle::bottom() const -> float
-{
-    return y + height;
-}
-
-auto Rectangle::center() const -> Vector2
-{
-    return {x + (width / 2), y + (height / 2)};
-}
-
-auto Rectangle::top_left() const -> Vector2
-{
-    return {x, y};
-}
-
-auto Rectangle::top_center() const -> Vector2
-{
-    return {x + (width / 2), y};
-}
-
-auto Rectangle::top_right() const -> Vector2
-{
-    return {x + width, y};
-}
-
-auto Rectangle::bottom_left() const -> Vector2
-{
-    return {x, y + height};
-}
-
-auto Rectangle::bottom_center() const -> Vector2
-{
-    return {x + (width / 2), y + height};
-}
-
-auto Rectangle::bottom_right() const -> Vector2
-{
-    return {x + width, y + height};
-}
-
-auto Rectangle::scaled(const Vector2& scale) const -> Rectangle
-{
-    return {x * scale.x, y * scale.y, width * scale.x, height * scale.y};
-}
-
-auto Rectangle::contains(const Vector2& vector) const -> bool
-{
-    if (x <= vector.x && vector.x < x + width && y <= vector.y)
-    {
-        return vector.y < y + height;
-    }
-
-    return false;
-}
-
-auto Rectangle::contains(const Rectangle& other) const -> bool
-{
-    if (x <= other.x && other.x + other.width <= x + width && y <= other.y)
-    {
-        return other.y + other.height <= y + height;
-    }
-
-    return false;
-}
-
-auto Rectangle::inflated(float amount) const -> Rectangle
-{
-    return {
-        x - amount,
-        y - amount,
-        width + (amount * 2),
-        height + (amount * 2),
-    };
-}
-
-auto Rectangle::offset(const Vector2& offset) const -> Rectangle
-{
-    return {
-        x + offset.x,
-        y + offset.y,
-        width,
-        height,
-    };
-}
-
-auto Rectangle::intersects(const Rectangle& other) const -> bool
-{
-    return other.left() < right() && left() < other.right() && other.top() < bottom() &&
-           top() < other.bottom();
-}
-
 auto Rectangle::intersects(const Circle& circle) const -> bool
 {
     const auto center = circle.center;
@@ -180,14 +74,4 @@ auto Rectangle::make_union(const Rectangle& lhs, const Rectangle& rhs) -> Rectan
         max(lhs.bottom(), rhs.bottom()) - y,
     };
 }
-
-auto Rectangle::position() const -> Vector2
-{
-    return {x, y};
-}
-
-auto Rectangle::size() const -> Vector2
-{
-    return {width, height};
-}
-} // namespace cer
\ No newline at end of file
+} // namespace cer
@@ -10,11 +10,6 @@ auto cer::length(const Vector3& vector) -> float
     return std::sqrt(length_squared(vector));
 }
 
-auto cer::length_squared(const Vector3& vector) -> float
-{
-    return vector.x * vector.x + vector.y * vector.y + vector.z * vector.z;
-}
-
 auto cer::normalize(const Vector3& vector) -> Vector3
 {
     const auto len = length(vector);
@@ -102,57 +97,11 @@ auto cer::random_vector3(float min, float max) -> Vector3
     };
 }
 
-auto cer::dot(const Vector3& lhs, const Vector3& rhs) -> float
-{
-    return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
-}
-
-auto cer::cross(const Vector3& lhs, const Vector3& rhs) -> Vector3
-{
-    return {
-        lhs.y * rhs.z - rhs.y * lhs.z,
-        lhs.z * rhs.x - rhs.z * lhs.x,
-        lhs.x * rhs.y - rhs.x * lhs.y,
-    };
-}
-
 auto cer::distance(const Vector3& lhs, const Vector3& rhs) -> float
 {
     return length(rhs - lhs);
 }
 
-auto cer::distance_squared(const Vector3& lhs, const Vector3& rhs) -> float
-{
-    return length_squared(rhs - lhs);
-}
-
-auto cer::lerp(const Vector3& start, const Vector3& end, float t) -> Vector3
-{
-    return {
-        lerp(start.x, end.x, t),
-        lerp(start.y, end.y, t),
-        lerp(start.z, end.z, t),
-    };
-}
-
-auto cer::smoothstep(const Vector3& start, const Vector3& end, float t) -> Vector3
-{
-    return {
-        smoothstep(start.x, end.x, t),
-        smoothstep(start.y, end.y, t),
-        smoothstep(start.z, end.z, t),
-    };
-}
-
-auto cer::clamp(const Vector3& value, const Vector3& min, const Vector3& max) -> Vector3
-{
-    return {
-        clamp(value.x, min.x, max.x),
-        clamp(value.y, min.y, max.y),
-        clamp(value.z, min.z, max.z),
-    };
-}
-
 auto cer::is_zero(const Vector3& vector) -> bool
 {
     return is_zero(vector.x) && is_zero(vector.y) && is_zero(vector.z);
@@ -163,137 +112,3 @@ auto cer::are_equal_within(const Vector3& lhs, const Vector3& rhs, float thresho
     return equal_within(lhs.x, rhs.x, threshold) && equal_within(lhs.y, rhs.y, threshold) &&
            equal_within(lhs.z, rhs.z, threshold);
 }
-
-auto cer::min(const Vector3& lhs, const Vector3& rhs) -> Vector3
-{
-    return {
-        min(lhs.x, rhs.x),
-        min(lhs.y, rhs.y),
-        min(lhs.z, rhs.z),
-    };
-}
-
-auto cer::max(const Vector3& lhs, const Vector3& rhs) -> Vector3
-{
-    return {
-        max(lhs.x, rhs.x),
-        max(lhs.y, rhs.y),
-        max(lhs.z, rhs.z),
-    };
-}
-
-auto cer::operator+=(Vector3& vector, const Vector3& rhs) -> Vector3&
-{
-    vector.x += rhs.x;
-    vector.y += rhs.y;
-    vector.z += rhs.z;
-    return vector;
-}
-
-auto cer::operator-=(Vector3& vector, const Vector3& rhs) -> Vector3&
-{
-    vector.x -= rhs.x;
-    vector.y -= rhs.y;
-    vector.z -= rhs.z;
-    return vector;
-}
-
-auto cer::operator*=(Vector3& vector, const Vector3& rhs) -> Vector3&
-{
-    vector.x *= rhs.x;
-    vector.y *= rhs.y;
-    vector.z *= rhs.z;
-    return vector;
-}
-
-auto cer::operator*=(Vector3& vector, float rhs) -> Vector3&
-{
-    vector.x *= rhs;
-    vector.y *= rhs;
-    vector.z *= rhs;
-    return vector;
-}
-
-auto cer::operator/=(Vector3& vector, const Vector3& rhs) -> Vector3&
-{
-    vector.x /= rhs.x;
-    vector.y /= rhs.y;
-    vector.z /= rhs.z;
-    return vector;
-}
-
-auto cer::operator/=(Vector3& vector, float rhs) -> Vector3&
-{
-    vector.x /= rhs;
-    vector.y /= rhs;
-    vector.z /= rhs;
-    return vector;
-}
-
-auto cer::operator-(const Vector3& value) -> Vector3
-{
-    return {
-        -value.x,
-        -value.y,
-        -value.z,
-    };
-}
-
-auto cer::operator+(const Vector3& lhs, const Vector3& rhs) -> Vector3
-{
-    return {
-        lhs.x + rhs.x,
-        lhs.y + rhs.y,
-        lhs.z + rhs.z,
-    };
-}
-
-auto cer::operator-(const Vector3& lhs, const Vector3& rhs) -> Vector3
-{
-    return {
-        lhs.x - rhs.x,
-        lhs.y - rhs.y,
-        lhs.z - rhs.z,
-    };
-}
-
-auto cer::operator*(const Vector3& lhs, const Vector3& rhs) -> Vector3
-{
-    return {
-        lhs.x * rhs.x,
-        lhs.y * rhs.y,
-        lhs.z * rhs.z,
-    };
-}
-
-auto cer::operator*(const Vector3& lhs, float rhs) -> Vector3
-{
-    return {
-        lhs.x * rhs,
-        lhs.y * rhs,
-        lhs.z * rhs,
-    };
-}
-
-auto cer::operator*(float lhs, const Vector3& rhs) -> Vector3
-{
-    return rhs * lhs;
-}
-
-auto cer::operator/(const Vector3& lhs, const Vector3& rhs) -> Vector3
-{
-    return {
-        lhs.x / rhs.x,
-        lhs.y / rhs.y,
-        lhs.z / rhs.z,
-    };
-}
-
-auto cer::operator/(const Vector3& lhs, float rhs) -> Vector3
-{
-    return {
-        lhs.x / rhs,
-        lhs.y / rhs,
-        lhs.z / rhs,
-    };
-}
@@ -0,0 +1,37 @@
+// Prepended to the built-in sprite pixel shaders, after a definition of
+// SPRITE_IMAGE_COUNT (8 or 16).
+
+uniform sampler2D SpriteImages[SPRITE_IMAGE_COUNT];
+
+flat in float cer_v2f_ImageIndex;
+
+// Sampler arrays may only be indexed with constant expressions, which is why the sprite's
+// image is selected by branching. Neighboring pixels may belong to sprites of different
+// images, so the branch isn't uniform and implicit derivatives inside of it are undefined.
+// The gradients are therefore computed up front and passed explicitly.
+vec4 sample_sprite_image(vec2 uv) {
+    int  index = int(cer_v2f_ImageIndex);
+    vec2 dx    = dFdx(uv);
+    vec2 dy    = dFdy(uv);
+
+    if (index == 0) return textureGrad(SpriteImages[0], uv, dx, dy);
+    if (index == 1) return textureGrad(SpriteImages[1], uv, dx, dy);
+    if (index == 2) return textureGrad(SpriteImages[2], uv, dx, dy);
+    if (index == 3) return textureGrad(SpriteImages[3], uv, dx, dy);
+    if (index == 4) return textureGrad(SpriteImages[4], uv, dx, dy);
+    if (index == 5) return textureGrad(SpriteImages[5], uv, dx, dy);
+    if (index == 6) return textureGrad(SpriteImages[6], uv, dx, dy);
+#if SPRITE_IMAGE_COUNT > 8
+    if (index == 7) return textureGrad(SpriteImages[7], uv, dx, dy);
+    if (index == 8) return textureGrad(SpriteImages[8], uv, dx, dy);
+    if (index == 9) return textureGrad(SpriteImages[9], uv, dx, dy);
+    if (index == 10) return textureGrad(SpriteImages[10], uv, dx, dy);
+    if (index == 11) return textureGrad(SpriteImages[11], uv, dx, dy);
+    if (index == 12) return textureGrad(SpriteImages[12], uv, dx, dy);
+    if (index == 13) return textureGrad(SpriteImages[13], uv, dx, dy);
+    if (index == 14) return textureGrad(SpriteImages[14], uv, dx, dy);
+#endif
+
+    return textureGrad(SpriteImages[SPRITE_IMAGE_COUNT - 1], uv, dx, dy);
+}
+
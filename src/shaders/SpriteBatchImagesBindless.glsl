@@ -0,0 +1,11 @@
+// Replaces SpriteBatchImages.glsl when the system supports bindless textures. Every image
+// of a batch is passed as a handle, so no texture units are needed.
+
+uniform uvec2 SpriteImageHandles[SPRITE_IMAGE_COUNT];
+
+flat in float cer_v2f_ImageIndex;
+
+vec4 sample_sprite_image(vec2 uv) {
+    return texture(sampler2D(SpriteImageHandles[int(cer_v2f_ImageIndex)]), uv);
+}
+
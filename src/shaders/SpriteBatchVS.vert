@@ -3,6 +3,7 @@ uniform mat4 Transformation;
 in vec4 vsin_Position;
 in vec4 vsin_Color;
 in vec2 vsin_UV;
+in float vsin_ImageIndex;
 
 // !!!
 // Keep this in sync with GLSLShaderGenerator fragment shader input stage!
@@ -10,8 +11,12 @@ in vec2 vsin_UV;
 out vec4 cer_v2f_Color;
 out vec2 cer_v2f_UV;
 
+// Only read by the sprite batch's own pixel shaders.
+flat out float cer_v2f_ImageIndex;
+
 void main() {
     gl_Position = Transformation * vsin_Position;
     cer_v2f_Color = vsin_Color;
     cer_v2f_UV = vsin_UV;
+    cer_v2f_ImageIndex = vsin_ImageIndex;
 }
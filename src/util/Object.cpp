@@ -25,12 +25,17 @@ auto Object::release() -> uint64_t
 
     if (new_ref_count == 0)
     {
-        delete this;
+        on_unreferenced();
     }
 
     return new_ref_count;
 }
 
+void Object::on_unreferenced()
+{
+    delete this;
+}
+
 auto Object::ref_count() const -> uint64_t
 {
 #ifdef CERLIB_ATOMIC_REFCOUNTING
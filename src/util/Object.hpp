@@ -143,6 +143,10 @@ class Object
 
     auto ref_count() const -> uint64_t;
 
+  protected:
+    // Called when the last reference is released. Deletes the object by default.
+    virtual void on_unreferenced();
+
   private:
 #ifdef CERLIB_ATOMIC_REFCOUNTING
     std::atomic<uint64_t> m_ref_count;
@@ -0,0 +1,111 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "contentmanagement/AssetArchive.hpp"
+#include <array>
+#include <cstring>
+#include <snitch/snitch.hpp>
+
+using cer::details::AssetArchive;
+using cer::details::AssetArchiveFile;
+
+namespace
+{
+auto to_asset_data(const cer::List<std::byte>& bytes) -> cer::AssetData
+{
+    auto data = std::make_unique<std::byte[]>(bytes.size());
+    std::memcpy(data.get(), bytes.data(), bytes.size());
+
+    return {
+        .data = std::move(data),
+        .size = bytes.size(),
+    };
+}
+} // namespace
+
+TEST_CASE("Asset archives", "[content]")
+{
+    // Text compresses well, while noise doesn't and is stored as it is.
+    auto text  = cer::List<std::byte>{};
+    auto noise = cer::List<std::byte>(5000);
+
+    for (int i = 0; i < 200; ++i)
+    {
+        for (const auto ch : std::string_view{"The quick brown fox jumps over the lazy dog. "})
+        {
+            text.push_back(std::byte(ch));
+        }
+    }
+
+    auto state = uint32_t(12345);
+
+    for (auto& value : noise)
+    {
+        state = (state * 1664525) + 1013904223;
+        value = std::byte(state >> 24);
+    }
+
+    const auto files = std::array{
+        AssetArchiveFile{.name = "text.txt", .data = text},
+        AssetArchiveFile{.name = "images/noise.bin", .data = noise},
+        AssetArchiveFile{.name = "empty.bin", .data = {}},
+    };
+
+    SECTION("Round trip")
+    {
+        for (const auto compress : {true, false})
+        {
+            const auto packed  = AssetArchive::pack(files, compress);
+            const auto archive = AssetArchive{to_asset_data(packed)};
+
+            REQUIRE(archive.entry_count() == files.size());
+
+            for (const auto& file : files)
+            {
+                const auto data = archive.find(file.name);
+
+                REQUIRE(data.has_value());
+                REQUIRE(std::ranges::equal(data->as_span(), file.data));
+            }
+
+            REQUIRE(archive.contains("images/noise.bin"));
+            REQUIRE(!archive.contains("noise.bin"));
+            REQUIRE(!archive.find("images/missing.png").has_value());
+
+            if (compress)
+            {
+                REQUIRE(packed.size() < text.size() + noise.size());
+            }
+        }
+    }
+
+    SECTION("Stored entries share the archive's memory")
+    {
+        const auto archive_data = to_asset_data(AssetArchive::pack(files, true));
+        const auto archive      = AssetArchive{archive_data};
+        const auto noise_data   = archive.find("images/noise.bin");
+
+        const auto offset = size_t(noise_data->data.get() - archive_data.data.get());
+
+        REQUIRE(offset < archive_data.size);
+        REQUIRE(offset % AssetArchive::s_alignment == 0);
+    }
+
+    SECTION("Invalid archives")
+    {
+        auto packed = AssetArchive::pack(files, true);
+
+        REQUIRE_THROWS_AS(AssetArchive::pack(std::array{files[0], files[0]}, true),
+                          std::invalid_argument);
+
+        // Truncated data
+        auto truncated = to_asset_data(packed);
+        truncated.size = 40;
+        REQUIRE_THROWS_AS(AssetArchive{truncated}, std::runtime_error);
+
+        // Wrong magic number
+        packed[0] = std::byte{'X'};
+        REQUIRE_THROWS_AS(AssetArchive{to_asset_data(packed)}, std::runtime_error);
+    }
+}
@@ -0,0 +1,152 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "WavTestHelper.hpp"
+#include "contentmanagement/AssetReloader.hpp"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <snitch/snitch.hpp>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#ifdef CERLIB_HAVE_ASSET_HOT_RELOADING
+
+namespace
+{
+using namespace std::chrono_literals;
+using cer::details::AssetReloader;
+
+void write_file(const std::filesystem::path& path, std::span<const std::byte> contents)
+{
+    auto ofs = std::ofstream{path, std::ios::binary | std::ios::trunc};
+    ofs.write(reinterpret_cast<const char*>(contents.data()), std::streamsize(contents.size()));
+}
+
+void write_file(const std::filesystem::path& path, std::string_view contents)
+{
+    write_file(path, std::as_bytes(std::span{contents}));
+}
+
+auto make_wav(uint32_t sample_count) -> cer::List<std::byte>
+{
+    return make_wav_data(44100, 1, cer::List<int16_t>(sample_count, int16_t(1000)));
+}
+
+// Waits until the reloader has decoded assets, or until the timeout has passed.
+auto wait_for_reloaded_assets(AssetReloader& reloader, std::chrono::milliseconds timeout = 5s)
+    -> cer::List<AssetReloader::ReloadedAsset>
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        if (auto assets = reloader.take_reloaded_assets(); !assets.empty())
+        {
+            return assets;
+        }
+
+        std::this_thread::sleep_for(10ms);
+    }
+
+    return {};
+}
+} // namespace
+
+TEST_CASE("Asset reloading", "[content]")
+{
+    const auto directory = std::filesystem::temp_directory_path() / "cerlib_asset_reloader";
+    std::filesystem::create_directories(directory);
+
+    auto reloader = AssetReloader{};
+
+    SECTION("Shaders")
+    {
+        const auto path = directory / "Shader.shd";
+        write_file(path, "first");
+
+        reloader.add_asset("Shader", path.string(), AssetReloader::ShaderSource{});
+        reloader.set_enabled(true);
+
+        write_file(path, "second");
+
+        const auto assets = wait_for_reloaded_assets(reloader);
+
+        REQUIRE(assets.size() == 1);
+        REQUIRE(assets[0].key == "Shader");
+
+        const auto* shader = std::get_if<AssetReloader::ReloadedShader>(&assets[0].contents);
+
+        REQUIRE(shader != nullptr);
+        REQUIRE(shader->source_code == "second");
+    }
+
+    SECTION("Sounds")
+    {
+        const auto path = directory / "Sound.wav";
+        write_file(path, make_wav(100));
+
+        reloader.add_asset("Sound",
+                           path.string(),
+                           AssetReloader::SoundSource{.options = {}, .sample_rate = 44100.0f});
+        reloader.set_enabled(true);
+
+        const auto wav_data = make_wav(200);
+        write_file(path, wav_data);
+
+        const auto assets = wait_for_reloaded_assets(reloader);
+
+        REQUIRE(assets.size() == 1);
+
+        const auto* sound = std::get_if<AssetReloader::ReloadedSound>(&assets[0].contents);
+
+        REQUIRE(sound != nullptr);
+        REQUIRE(sound->audio_source != nullptr);
+        REQUIRE(sound->data.size == wav_data.size());
+
+        // Files that fail to decode are skipped, and the loaded sound stays as it is.
+        write_file(path, "not a sound");
+
+        REQUIRE(wait_for_reloaded_assets(reloader, 500ms).empty());
+    }
+
+    SECTION("Debouncing")
+    {
+        const auto path = directory / "Debounced.shd";
+        write_file(path, "0");
+
+        reloader.add_asset("Debounced", path.string(), AssetReloader::ShaderSource{});
+        reloader.set_enabled(true);
+
+        // Writes that follow each other quickly are reloaded once they have settled. A slow
+        // machine may see the writes settle in between, so only the final state is checked.
+        for (int i = 1; i <= 10; ++i)
+        {
+            write_file(path, std::to_string(i));
+            std::this_thread::sleep_for(10ms);
+        }
+
+        auto source_code = std::string{};
+        auto assets      = wait_for_reloaded_assets(reloader);
+
+        while (!assets.empty())
+        {
+            REQUIRE(assets.back().key == "Debounced");
+
+            source_code =
+                std::get<AssetReloader::ReloadedShader>(assets.back().contents).source_code;
+
+            assets = wait_for_reloaded_assets(reloader, 500ms);
+        }
+
+        REQUIRE(source_code == "10");
+    }
+
+    reloader.set_enabled(false);
+    std::filesystem::remove_all(directory);
+}
+
+#endif
@@ -0,0 +1,321 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "WavTestHelper.hpp"
+#include "audio/AudioDevice.hpp"
+#include "audio/Filter.hpp"
+#include "audio/Noise.hpp"
+#include "audio/Resampler.hpp"
+#include "audio/SoundImpl.hpp"
+#include "audio/Wav.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerlib/List.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <snitch/snitch.hpp>
+#include <thread>
+
+namespace
+{
+constexpr size_t sample_rate     = 44100;
+constexpr size_t channels        = 2;
+constexpr size_t frame_count     = 120;
+constexpr size_t calls_per_frame = 2000;
+
+// A 16-bit mono sine wave.
+auto make_sine_wav(uint32_t sample_count) -> cer::List<std::byte>
+{
+    auto samples = cer::List<int16_t>(sample_count);
+
+    for (uint32_t i = 0; i < sample_count; ++i)
+    {
+        samples[i] = int16_t(8000.0 * std::sin(double(i) * 0.1));
+    }
+
+    return make_wav_data(uint32_t(sample_rate), 1, samples);
+}
+} // namespace
+
+// Fires thousands of sounds per game frame while another thread mixes as fast as it can.
+// This measures how long the game thread is held up by the mixer.
+TEST_CASE("Audio command contention", "[.benchmark]")
+{
+    using clock = std::chrono::steady_clock;
+
+    auto device = cer::AudioDevice{cer::EngineFlags{},
+                                   sample_rate,
+                                   1024,
+                                   channels,
+                                   cer::AudioBackend::NullDriver};
+
+    // A short sound, so that voices end quickly and free their slots.
+    const auto wav_data = make_sine_wav(512);
+
+    {
+        const auto sound = cer::Sound{new cer::details::SoundImpl{device, wav_data}};
+
+        auto is_mixing = std::atomic<bool>{true};
+
+        auto mixer_thread = std::thread{[&] {
+            auto buffer = cer::List<float>(1024 * channels);
+
+            while (is_mixing.load(std::memory_order_relaxed))
+            {
+                device.render_offline(buffer);
+            }
+        }};
+
+        auto total_time     = clock::duration{};
+        auto max_frame_time = clock::duration{};
+
+        for (size_t frame = 0; frame < frame_count; ++frame)
+        {
+            const auto start = clock::now();
+
+            for (size_t i = 0; i < calls_per_frame; ++i)
+            {
+                device.play_sound_fire_and_forget(sound, 0.01f, 0.0f, std::nullopt);
+            }
+
+            const auto frame_time = clock::now() - start;
+
+            total_time += frame_time;
+            max_frame_time = std::max(max_frame_time, frame_time);
+        }
+
+        is_mixing.store(false);
+        mixer_thread.join();
+
+        using ms = std::chrono::duration<double, std::milli>;
+        using ns = std::chrono::duration<double, std::nano>;
+
+        std::printf("play_sound_fire_and_forget: %8.1f ns/call, %6.3f ms/frame (max %6.3f ms)\n",
+                    ns(total_time).count() / double(frame_count * calls_per_frame),
+                    ms(total_time).count() / double(frame_count),
+                    ms(max_frame_time).count());
+
+        REQUIRE(device.mixer_stats().mixed_frames > 0);
+
+        device.stop_all_sounds();
+        device.purge_sounds();
+    }
+}
+
+// Measures every resampler implementation that this CPU supports, at the device rate and
+// when converting 44.1 kHz sources to a 48 kHz device.
+TEST_CASE("Resampler throughput", "[.benchmark]")
+{
+    using clock = std::chrono::steady_clock;
+    using ns    = std::chrono::duration<double, std::nano>;
+
+    constexpr auto iterations = size_t(20000);
+
+    auto prev_src = cer::List<float>(cer::sample_granularity);
+    auto src      = cer::List<float>(cer::sample_granularity);
+    auto dst      = cer::List<float>(cer::sample_granularity * 2);
+
+    for (size_t i = 0; i < cer::sample_granularity; ++i)
+    {
+        prev_src[i] = std::sin(float(i) * 0.37f);
+        src[i]      = std::sin(float(i) * 0.11f);
+    }
+
+    const auto resamplers = std::array{
+        std::pair{cer::Resampler::Point, "point"},
+        std::pair{cer::Resampler::Linear, "linear"},
+        std::pair{cer::Resampler::CatmullRom, "catmull-rom"},
+    };
+
+    // Keeps the compiler from discarding the resampled samples.
+    auto checksum = 0.0f;
+
+    for (const auto& kernels : cer::details::supported_resample_kernels())
+    {
+        for (const auto& [resampler, resampler_name] : resamplers)
+        {
+            for (const auto step : {1.0, 44100.0 / 48000.0})
+            {
+                const auto step_fixed = size_t(step * cer::s_fixpoint_frac_mul);
+                const auto count =
+                    ((cer::sample_granularity << cer::s_fixpoint_frac_bits) - 1) / step_fixed + 1;
+                const auto resample = kernels.get(resampler);
+                const auto start    = clock::now();
+
+                for (size_t i = 0; i < iterations; ++i)
+                {
+                    resample(src.data(), prev_src.data(), dst.data(), 0, count, step_fixed);
+                }
+
+                const auto duration = ns(clock::now() - start).count();
+
+                checksum += dst[count - 1];
+
+                std::printf("%-6s %-12s step %.3f: %6.3f ns/sample\n",
+                            kernels.name,
+                            resampler_name,
+                            step,
+                            duration / double(iterations * count));
+            }
+        }
+    }
+
+    REQUIRE(checksum != 0.0f);
+}
+
+// Compares the memory that a sound takes in every sample format with the time it takes
+// to read its samples during mixing.
+TEST_CASE("Sample storage", "[.benchmark]")
+{
+    using clock = std::chrono::steady_clock;
+    using ns    = std::chrono::duration<double, std::nano>;
+
+    constexpr auto iterations = size_t(50);
+
+    // Ten seconds
+    const auto wav_data = make_sine_wav(uint32_t(sample_rate * 10));
+
+    const auto formats = std::array{
+        std::pair{cer::SoundSampleFormat::Float32, "float32"},
+        std::pair{cer::SoundSampleFormat::Int16, "int16"},
+        std::pair{cer::SoundSampleFormat::Adpcm, "adpcm"},
+    };
+
+    auto buffer = cer::List<float>(cer::sample_granularity);
+
+    // Keeps the compiler from discarding the decoded samples.
+    auto checksum = 0.0f;
+
+    for (const auto& [format, format_name] : formats)
+    {
+        auto wav      = cer::Wav{wav_data, cer::SoundLoadOptions{.sample_format = format}};
+        auto instance = wav.create_instance();
+
+        instance->init(wav, 0);
+
+        auto       sample_count = size_t(0);
+        const auto start        = clock::now();
+
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            instance->rewind();
+
+            while (!instance->has_ended())
+            {
+                sample_count +=
+                    instance->audio(buffer.data(), buffer.size(), buffer.size());
+
+                checksum += buffer[0];
+            }
+        }
+
+        const auto duration = ns(clock::now() - start).count();
+
+        std::printf("%-8s %8.1f KiB, %6.3f ns/sample\n",
+                    format_name,
+                    double(wav.sample_data_size()) / 1024.0,
+                    duration / double(sample_count));
+    }
+
+    REQUIRE(checksum != 0.0f);
+}
+
+// Measures the convolution filter with impulse responses of different lengths, next to the
+// Freeverb filter, filtering stereo blocks of sample_granularity like a bus does.
+TEST_CASE("Convolution reverb", "[.benchmark]")
+{
+    using clock = std::chrono::steady_clock;
+    using ns    = std::chrono::duration<double, std::nano>;
+
+    constexpr auto block_count = size_t(2000);
+
+    auto device = cer::AudioDevice{cer::EngineFlags{},
+                                   sample_rate,
+                                   1024,
+                                   channels,
+                                   cer::AudioBackend::NullDriver};
+
+    auto input  = cer::List<float>(cer::sample_granularity * channels);
+    auto buffer = cer::List<float>(input.size());
+
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = std::sin(float(i) * 0.01f);
+    }
+
+    const auto measure = [&](cer::Filter& filter) {
+        auto       instance = filter.create_instance();
+        const auto start    = clock::now();
+
+        for (size_t i = 0; i < block_count; ++i)
+        {
+            std::ranges::copy(input, buffer.begin());
+
+            instance->filter(cer::FilterArgs{
+                .buffer      = buffer.data(),
+                .samples     = cer::sample_granularity,
+                .buffer_size = cer::sample_granularity,
+                .channels    = channels,
+                .sample_rate = float(sample_rate),
+            });
+        }
+
+        return ns(clock::now() - start).count() /
+               double(block_count * cer::sample_granularity * channels);
+    };
+
+    for (const auto seconds : {0.5, 2.0, 5.0})
+    {
+        const auto wav_data = make_sine_wav(uint32_t(double(sample_rate) * seconds));
+        const auto sound    = cer::Sound{new cer::details::SoundImpl{device, wav_data}};
+
+        auto filter = cer::ConvolutionFilter{sound};
+
+        // The multiply-add count is derived from the partitioning, only the time is measured.
+        std::printf("convolution %.1f s: %7.3f ns/sample/channel (%.1f multiply-adds/sample)\n",
+                    seconds,
+                    measure(filter),
+                    filter.multiply_adds_per_sample());
+    }
+
+    auto freeverb = cer::FreeverbFilter{};
+
+    std::printf("freeverb:         %7.3f ns/sample/channel\n", measure(freeverb));
+
+    REQUIRE(std::isfinite(buffer[0]));
+}
+
+// Mixes many voices offline, which runs the mixer as fast as it can without a device
+// pulling the audio.
+TEST_CASE("Offline mixing", "[.benchmark]")
+{
+    constexpr auto voice_count = size_t(32);
+
+    auto device = cer::AudioDevice{cer::EngineFlags{},
+                                   sample_rate,
+                                   1024,
+                                   channels,
+                                   cer::AudioBackend::NullDriver};
+
+    device.set_max_active_voice_count(voice_count);
+
+    auto noise = cer::Noise{};
+
+    for (size_t i = 0; i < voice_count; ++i)
+    {
+        device.play(noise, 0.1f);
+    }
+
+    auto buffer = cer::List<float>(sample_rate * 10 * channels);
+    device.render_offline(buffer);
+
+    const auto stats = device.mixer_stats();
+
+    std::printf("offline mixer:    %.0f voice frames/s\n", stats.voice_frames_per_second);
+
+    REQUIRE(stats.mixed_voice_frames == voice_count * sample_rate * 10);
+}
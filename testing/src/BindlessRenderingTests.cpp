@@ -0,0 +1,108 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <array>
+#include <cerlib/Drawing.hpp>
+#include <cerlib/Font.hpp>
+#include <cerlib/Game.hpp>
+#include <cerlib/Image.hpp>
+#include <cerlib/OStreamCompat.hpp>
+#include <cerlib/Text.hpp>
+#include <cstdlib>
+#include <snitch/snitch.hpp>
+
+using namespace cer;
+
+// Picked up by the graphics device when the game creates it.
+static void set_bindless_textures_disabled(bool disabled)
+{
+#ifdef _WIN32
+    _putenv_s("CERLIB_DISABLE_BINDLESS_TEXTURES", disabled ? "1" : "0");
+#else
+    setenv("CERLIB_DISABLE_BINDLESS_TEXTURES", disabled ? "1" : "0", 1);
+#endif
+}
+
+// Draws sprites of more images than fit into one batch of texture units, together with
+// text, and keeps the result.
+class BindlessGame final : public Game
+{
+  public:
+    explicit BindlessGame(List<std::byte>& result)
+        : m_window("Bindless Test Window", 0, {}, {}, 300, 300, false)
+        , m_result(result)
+    {
+    }
+
+    void load_content() override
+    {
+        m_logo = Image(cer_fmt::format("{}/cerlib-logo300.png", TEST_ASSETS_DIR));
+
+        for (size_t i = 0; i < m_images.size(); ++i)
+        {
+            const auto value = uint8_t(i * 10);
+            const auto pixel = std::array<uint8_t, 4>{value, uint8_t(255 - value), 128, 255};
+
+            m_images[i] = Image{1, 1, ImageFormat::R8G8B8A8_UNorm, pixel.data()};
+        }
+
+        m_canvas = Image{128, 64, ImageFormat::R8G8B8A8_UNorm, m_window};
+        m_canvas.set_canvas_clear_color(black);
+
+        m_text = Text{"Retained", Font::built_in(), 16};
+        m_text.set_retained(true);
+    }
+
+    bool update([[maybe_unused]] const GameTime& time) override
+    {
+        return m_result.empty();
+    }
+
+    void draw([[maybe_unused]] const Window& window) override
+    {
+        set_canvas(m_canvas);
+
+        draw_sprite(m_logo, {-100, -120});
+
+        for (size_t i = 0; i < m_images.size(); ++i)
+        {
+            draw_sprite({
+                .image    = m_images[i],
+                .dst_rect = {float(i * 5), 0, 5, 8},
+            });
+        }
+
+        draw_string("Text", Font::built_in(), 16, {4, 12}, yellow);
+        draw_text(m_text, {4, 36}, red);
+
+        set_canvas({});
+
+        m_result = read_canvas_data(m_canvas, 0, 0, m_canvas.width(), m_canvas.height());
+    }
+
+  private:
+    Window                m_window;
+    List<std::byte>&      m_result;
+    Image                 m_logo;
+    std::array<Image, 24> m_images;
+    Image                 m_canvas;
+    Text                  m_text;
+};
+
+TEST_CASE("BindlessRenderingTests", "[drawing]")
+{
+    // Without support for bindless textures, both runs take the same path.
+    auto bindless = List<std::byte>{};
+    set_bindless_textures_disabled(false);
+    REQUIRE(run_game<BindlessGame>(bindless) == 0);
+
+    auto texture_units = List<std::byte>{};
+    set_bindless_textures_disabled(true);
+    REQUIRE(run_game<BindlessGame>(texture_units) == 0);
+
+    set_bindless_textures_disabled(false);
+
+    REQUIRE_FALSE(bindless.empty());
+    REQUIRE(bindless == texture_units);
+}
@@ -0,0 +1,257 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "contentmanagement/KTX2.hpp"
+#include "graphics/BlockCompression.hpp"
+#include <array>
+#include <cerlib/Image.hpp>
+#include <cerlib/List.hpp>
+#include <cstring>
+#include <snitch/snitch.hpp>
+
+using cer::ImageFormat;
+
+namespace
+{
+struct Pixel
+{
+    int r{};
+    int g{};
+    int b{};
+    int a{};
+
+    auto operator==(const Pixel&) const -> bool = default;
+};
+
+auto decode(ImageFormat format, std::span<const uint8_t> block) -> cer::List<std::byte>
+{
+    return cer::details::decode_block_compressed_image(4, 4, format, block.data());
+}
+
+auto pixel_at(const cer::List<std::byte>& pixels, size_t x, size_t y, size_t width = 4) -> Pixel
+{
+    const auto* p = pixels.data() + (((y * width) + x) * 4);
+    return {int(p[0]), int(p[1]), int(p[2]), int(p[3])};
+}
+
+// ETC2 blocks are big-endian.
+auto store_be64(uint64_t value, uint8_t* dst)
+{
+    for (size_t i = 0; i < 8; ++i)
+    {
+        dst[i] = uint8_t(value >> (56 - (i * 8)));
+    }
+}
+
+auto etc_index_bits(size_t x, size_t y, int index) -> uint64_t
+{
+    const auto i = (x * 4) + y;
+    return (uint64_t(index >> 1) << (i + 16)) | (uint64_t(index & 1) << i);
+}
+} // namespace
+
+TEST_CASE("Block-compressed images", "[graphics]")
+{
+    SECTION("Pitches")
+    {
+        REQUIRE(cer::image_format_is_block_compressed(ImageFormat::BC3_Srgb));
+        REQUIRE(!cer::image_format_is_block_compressed(ImageFormat::R8G8B8A8_UNorm));
+        REQUIRE(cer::image_row_pitch(5, ImageFormat::BC1_UNorm) == 16);
+        REQUIRE(cer::image_slice_pitch(5, 3, ImageFormat::BC1_UNorm) == 16);
+        REQUIRE(cer::image_slice_pitch(8, 8, ImageFormat::ETC2_RGBA8_UNorm) == 64);
+        REQUIRE(cer::image_slice_pitch(1, 1, ImageFormat::BC3_UNorm) == 16);
+    }
+
+    SECTION("BC1")
+    {
+        // Red and blue endpoints, with the first four pixels using the four colors.
+        constexpr auto block = std::array<uint8_t, 8>{0x00, 0xF8, 0x1F, 0x00, 0xE4, 0, 0, 0};
+
+        const auto pixels = decode(ImageFormat::BC1_UNorm, block);
+
+        REQUIRE(pixel_at(pixels, 0, 0) == Pixel{255, 0, 0, 255});
+        REQUIRE(pixel_at(pixels, 1, 0) == Pixel{0, 0, 255, 255});
+        REQUIRE(pixel_at(pixels, 2, 0) == Pixel{170, 0, 85, 255});
+        REQUIRE(pixel_at(pixels, 3, 0) == Pixel{85, 0, 170, 255});
+        REQUIRE(pixel_at(pixels, 3, 3) == Pixel{255, 0, 0, 255});
+
+        // Swapped endpoints select three colors and transparent black.
+        constexpr auto alpha_block =
+            std::array<uint8_t, 8>{0x1F, 0x00, 0x00, 0xF8, 0xE4, 0, 0, 0};
+
+        const auto alpha_pixels = decode(ImageFormat::BC1_UNorm, alpha_block);
+
+        REQUIRE(pixel_at(alpha_pixels, 2, 0) == Pixel{127, 0, 127, 255});
+        REQUIRE(pixel_at(alpha_pixels, 3, 0) == Pixel{0, 0, 0, 0});
+    }
+
+    SECTION("BC3")
+    {
+        // Pixel 0 uses alpha index 2, pixel 1 index 7, the rest index 0.
+        constexpr auto block = std::array<uint8_t, 16>{
+            255, 0, 0b00111010, 0, 0, 0, 0, 0, 0x00, 0xF8, 0x1F, 0x00, 0xE4, 0, 0, 0};
+
+        const auto pixels = decode(ImageFormat::BC3_UNorm, block);
+
+        REQUIRE(pixel_at(pixels, 0, 0) == Pixel{255, 0, 0, 218});
+        REQUIRE(pixel_at(pixels, 1, 0) == Pixel{0, 0, 255, 36});
+        REQUIRE(pixel_at(pixels, 2, 0) == Pixel{170, 0, 85, 255});
+
+        // BC3 never switches its colors to three-color mode.
+        constexpr auto swapped_block = std::array<uint8_t, 16>{
+            0, 255, 0b00111010, 0, 0, 0, 0, 0, 0x1F, 0x00, 0x00, 0xF8, 0xE4, 0, 0, 0};
+
+        const auto swapped_pixels = decode(ImageFormat::BC3_UNorm, swapped_block);
+
+        REQUIRE(pixel_at(swapped_pixels, 0, 0) == Pixel{0, 0, 255, 51});
+        REQUIRE(pixel_at(swapped_pixels, 1, 0) == Pixel{255, 0, 0, 255});
+        REQUIRE(pixel_at(swapped_pixels, 3, 0) == Pixel{170, 0, 85, 0});
+    }
+
+    SECTION("ETC2 individual mode")
+    {
+        // Base colors 0x88 and 0x44 with modifier tables 0 and 7, side by side.
+        auto value = (uint64_t(0x84) << 56) | (uint64_t(0x84) << 48) | (uint64_t(0x84) << 40) |
+                     (uint64_t(0) << 37) | (uint64_t(7) << 34);
+
+        value |= etc_index_bits(0, 0, 3);
+        value |= etc_index_bits(3, 0, 1);
+
+        auto block = std::array<uint8_t, 8>{};
+        store_be64(value, block.data());
+
+        const auto pixels = decode(ImageFormat::ETC2_RGB8_UNorm, block);
+
+        REQUIRE(pixel_at(pixels, 0, 0) == Pixel{128, 128, 128, 255});
+        REQUIRE(pixel_at(pixels, 1, 0) == Pixel{138, 138, 138, 255});
+        REQUIRE(pixel_at(pixels, 3, 0) == Pixel{251, 251, 251, 255});
+        REQUIRE(pixel_at(pixels, 2, 1) == Pixel{115, 115, 115, 255});
+    }
+
+    SECTION("ETC2 planar mode")
+    {
+        // A blue delta that overflows selects planar mode. The origin is black, red
+        // increases to the right and green increases downwards.
+        auto value = uint64_t(1) << 33;
+        value |= uint64_t(1) << 42;
+        value |= (uint64_t(0b11111) << 34) | (uint64_t(1) << 32);
+        value |= uint64_t(127) << 6;
+
+        auto block = std::array<uint8_t, 8>{};
+        store_be64(value, block.data());
+
+        const auto pixels = decode(ImageFormat::ETC2_RGB8_UNorm, block);
+
+        REQUIRE(pixel_at(pixels, 0, 0) == Pixel{0, 0, 0, 255});
+        REQUIRE(pixel_at(pixels, 1, 0) == Pixel{64, 0, 0, 255});
+        REQUIRE(pixel_at(pixels, 3, 0) == Pixel{191, 0, 0, 255});
+        REQUIRE(pixel_at(pixels, 0, 3) == Pixel{0, 191, 0, 255});
+        REQUIRE(pixel_at(pixels, 3, 3) == Pixel{191, 191, 0, 255});
+    }
+
+    SECTION("ETC2 EAC alpha")
+    {
+        // Base 128, multiplier 2 and modifier table 13. Pixel 0 uses index 7, the rest
+        // index 3.
+        auto alpha = (uint64_t(128) << 56) | (uint64_t(2) << 52) | (uint64_t(13) << 48);
+
+        for (size_t i = 0; i < 16; ++i)
+        {
+            alpha |= uint64_t(i == 0 ? 7 : 3) << (45 - (i * 3));
+        }
+
+        auto block = std::array<uint8_t, 16>{};
+        store_be64(alpha, block.data());
+        store_be64((uint64_t(0x84) << 56) | (uint64_t(0x84) << 48) | (uint64_t(0x84) << 40),
+                   block.data() + 8);
+
+        const auto pixels = decode(ImageFormat::ETC2_RGBA8_UNorm, block);
+
+        REQUIRE(pixel_at(pixels, 0, 0).a == 146);
+        REQUIRE(pixel_at(pixels, 1, 0).a == 108);
+        REQUIRE(pixel_at(pixels, 0, 1).a == 108);
+        REQUIRE(pixel_at(pixels, 0, 0).r == 138);
+    }
+
+    SECTION("Partial blocks")
+    {
+        // A 5x3 image needs two blocks, of which only parts are visible.
+        constexpr auto blocks = std::array<uint8_t, 16>{
+            0x00, 0xF8, 0x00, 0x00, 0, 0, 0, 0, 0x1F, 0x00, 0x00, 0x00, 0, 0, 0, 0};
+
+        const auto pixels =
+            cer::details::decode_block_compressed_image(5, 3, ImageFormat::BC1_Srgb, &blocks);
+
+        REQUIRE(pixels.size() == 5 * 3 * 4);
+        REQUIRE(pixel_at(pixels, 3, 2, 5) == Pixel{255, 0, 0, 255});
+        REQUIRE(pixel_at(pixels, 4, 2, 5) == Pixel{0, 0, 255, 255});
+
+        REQUIRE(cer::details::decoded_image_format(ImageFormat::BC1_Srgb) ==
+                ImageFormat::R8G8B8A8_Srgb);
+        REQUIRE(cer::details::decoded_image_format(ImageFormat::ETC2_RGB8_UNorm) ==
+                ImageFormat::R8G8B8A8_UNorm);
+    }
+}
+
+TEST_CASE("KTX2 loading", "[graphics]")
+{
+    // A 4x4 BC1 image with two mipmaps.
+    constexpr auto header_size = size_t(80);
+    constexpr auto index_size  = size_t(24);
+
+    auto file = cer::List<std::byte>(header_size + (2 * index_size) + 16);
+
+    const auto write_u32 = [&](size_t offset, uint32_t value) {
+        std::memcpy(file.data() + offset, &value, sizeof(value));
+    };
+
+    const auto write_u64 = [&](size_t offset, uint64_t value) {
+        std::memcpy(file.data() + offset, &value, sizeof(value));
+    };
+
+    constexpr auto identifier = std::array<uint8_t, 12>{
+        0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+    std::memcpy(file.data(), identifier.data(), identifier.size());
+
+    write_u32(12, 133); // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+    write_u32(20, 4);
+    write_u32(24, 4);
+    write_u32(36, 1);
+    write_u32(40, 2);
+
+    const auto data_offset = header_size + (2 * index_size);
+
+    write_u64(header_size, data_offset);
+    write_u64(header_size + 8, 8);
+    write_u64(header_size + index_size, data_offset + 8);
+    write_u64(header_size + index_size + 8, 8);
+
+    const auto image = cer::ktx2::load(file);
+
+    REQUIRE(image.has_value());
+    REQUIRE(image->width == 4);
+    REQUIRE(image->height == 4);
+    REQUIRE(image->format == ImageFormat::BC1_UNorm);
+    REQUIRE(image->mipmaps.size() == 2);
+    REQUIRE(image->mipmaps[1].data() == file.data() + data_offset + 8);
+
+    // A 1x1 image has no room for a second mipmap.
+    write_u32(12, 9); // VK_FORMAT_R8_UNORM
+    write_u32(20, 1);
+    write_u32(24, 1);
+    REQUIRE_THROWS_AS(cer::ktx2::load(file), std::runtime_error);
+
+    write_u32(12, 133);
+    write_u32(20, 4);
+    write_u32(24, 4);
+    REQUIRE(cer::ktx2::load(file).has_value());
+
+    // Truncated level data is an error, while other files aren't KTX2 files at all.
+    write_u64(header_size + index_size + 8, 4);
+    REQUIRE_THROWS_AS(cer::ktx2::load(file), std::runtime_error);
+
+    file[0] = std::byte{0};
+    REQUIRE(!cer::ktx2::load(file).has_value());
+}
@@ -0,0 +1,135 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "WavTestHelper.hpp"
+#include "audio/AudioDevice.hpp"
+#include "audio/Filter.hpp"
+#include "audio/SoundImpl.hpp"
+#include <algorithm>
+#include <array>
+#include <cerlib/List.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <snitch/snitch.hpp>
+#include <stdexcept>
+
+namespace
+{
+constexpr size_t sample_rate = 44100;
+constexpr size_t channels    = 2;
+
+struct Tap
+{
+    size_t offset;
+    float  gain;
+};
+
+// Gains that 16-bit samples represent exactly.
+constexpr auto taps = std::array{
+    Tap{0, 0.5f},
+    Tap{700, 0.25f},
+    Tap{1500, -0.25f},
+};
+
+// A 16-bit mono WAV file that holds an impulse response made of the taps.
+auto make_impulse_response() -> cer::List<std::byte>
+{
+    auto samples = cer::List<int16_t>(1600);
+
+    for (const auto& tap : taps)
+    {
+        samples[tap.offset] = int16_t(tap.gain * 32768.0f);
+    }
+
+    return make_wav_data(uint32_t(sample_rate), 1, samples);
+}
+} // namespace
+
+TEST_CASE("Convolution filter", "[audio]")
+{
+    auto device = cer::AudioDevice{cer::EngineFlags{},
+                                   sample_rate,
+                                   1024,
+                                   channels,
+                                   cer::AudioBackend::NullDriver};
+
+    const auto wav_data = make_impulse_response();
+    const auto sound    = cer::Sound{new cer::details::SoundImpl{device, wav_data}};
+
+    auto filter = cer::ConvolutionFilter{sound, 512};
+
+    REQUIRE(filter.partition_size() == 512);
+    REQUIRE(filter.partition_count() == 4);
+
+    constexpr auto frame_count = size_t(6000);
+
+    // Deterministic noise, with a different signal in each channel.
+    auto input = cer::List<float>(frame_count * channels);
+
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = std::sin(float(i) * 12.9898f) * 0.5f;
+    }
+
+    // Filter in chunks that match the partition size, and in chunks that don't.
+    for (const auto chunk_size : {size_t(512), size_t(300)})
+    {
+        auto instance = filter.create_instance();
+        auto output   = cer::List<float>(input.size());
+        auto chunk    = cer::List<float>(chunk_size * channels);
+
+        for (size_t first = 0; first < frame_count; first += chunk_size)
+        {
+            const auto count = std::min(chunk_size, frame_count - first);
+
+            for (size_t ch = 0; ch < channels; ++ch)
+            {
+                std::memcpy(chunk.data() + (ch * chunk_size),
+                            input.data() + (ch * frame_count) + first,
+                            count * sizeof(float));
+            }
+
+            instance->filter(cer::FilterArgs{
+                .buffer      = chunk.data(),
+                .samples     = count,
+                .buffer_size = chunk_size,
+                .channels    = channels,
+                .sample_rate = float(sample_rate),
+            });
+
+            for (size_t ch = 0; ch < channels; ++ch)
+            {
+                std::memcpy(output.data() + (ch * frame_count) + first,
+                            chunk.data() + (ch * chunk_size),
+                            count * sizeof(float));
+            }
+        }
+
+        // The output lags by one partition.
+        for (size_t ch = 0; ch < channels; ++ch)
+        {
+            for (size_t i = 0; i < frame_count; ++i)
+            {
+                auto expected = 0.0f;
+
+                for (const auto& tap : taps)
+                {
+                    if (i >= 512 + tap.offset)
+                    {
+                        expected += input[(ch * frame_count) + i - 512 - tap.offset] * tap.gain;
+                    }
+                }
+
+                REQUIRE(std::abs(output[(ch * frame_count) + i] - expected) < 1.0e-4f);
+            }
+        }
+    }
+
+    SECTION("Invalid arguments")
+    {
+        REQUIRE_THROWS_AS((cer::ConvolutionFilter{cer::Sound{}}), std::invalid_argument);
+        REQUIRE_THROWS_AS((cer::ConvolutionFilter{sound, 500}), std::invalid_argument);
+    }
+}
@@ -0,0 +1,150 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <cerlib/BlendState.hpp>
+#include <cerlib/DrawList.hpp>
+#include <cerlib/Drawing.hpp>
+#include <snitch/snitch.hpp>
+#include <thread>
+
+// Recording doesn't touch the graphics device, so these tests run without a game.
+
+TEST_CASE("DrawList", "[graphics]")
+{
+    SECTION("Recording")
+    {
+        auto list = cer::DrawList::create();
+        REQUIRE(list.command_count() == 0);
+        REQUIRE_FALSE(list.is_recording());
+
+        list.begin_recording();
+        REQUIRE(list.is_recording());
+
+        cer::set_blend_state(cer::additive);
+        cer::fill_rectangle({0, 0, 10, 10}, cer::red);
+        cer::fill_rectangle({10, 10, 10, 10}, cer::green);
+        cer::set_transformation(cer::Matrix{});
+
+        list.end_recording();
+
+        REQUIRE_FALSE(list.is_recording());
+        REQUIRE(list.command_count() == 4);
+
+        // Recording again starts from scratch.
+        list.begin_recording();
+        cer::fill_rectangle({0, 0, 10, 10}, cer::red);
+        list.end_recording();
+
+        REQUIRE(list.command_count() == 1);
+
+        list.clear();
+        REQUIRE(list.command_count() == 0);
+    }
+
+    SECTION("State queries while recording")
+    {
+        auto list = cer::DrawList::create();
+        list.begin_recording();
+
+        REQUIRE_FALSE(cer::current_canvas());
+        REQUIRE(cer::current_canvas_size() == cer::Vector2{});
+        REQUIRE(cer::frame_stats().draw_calls == 0);
+
+        list.end_recording();
+    }
+
+    SECTION("Nested recording")
+    {
+        auto outer = cer::DrawList::create();
+        auto inner = cer::DrawList::create();
+
+        outer.begin_recording();
+        cer::fill_rectangle({0, 0, 10, 10});
+
+        inner.begin_recording();
+        cer::fill_rectangle({0, 0, 10, 10});
+        cer::fill_rectangle({0, 0, 10, 10});
+
+        // Only the most recent list may be ended.
+        REQUIRE_THROWS_AS(outer.end_recording(), std::logic_error);
+
+        // A list can't be drawn or cleared while it records.
+        REQUIRE_THROWS_AS(cer::draw_list(inner), std::logic_error);
+        REQUIRE_THROWS_AS(inner.clear(), std::logic_error);
+
+        inner.end_recording();
+
+        cer::draw_list(inner);
+        outer.end_recording();
+
+        REQUIRE(inner.command_count() == 2);
+        REQUIRE(outer.command_count() == 2);
+    }
+
+    SECTION("Invalid recording")
+    {
+        auto list = cer::DrawList::create();
+
+        REQUIRE_THROWS_AS(list.end_recording(), std::logic_error);
+
+        list.begin_recording();
+        REQUIRE_THROWS_AS(list.begin_recording(), std::logic_error);
+        list.end_recording();
+    }
+
+    SECTION("Recording a list into itself")
+    {
+        auto first  = cer::DrawList::create();
+        auto second = cer::DrawList::create();
+        auto third  = cer::DrawList::create();
+
+        first.begin_recording();
+        cer::fill_rectangle({0, 0, 10, 10});
+        first.end_recording();
+
+        second.begin_recording();
+        cer::draw_list(first);
+        second.end_recording();
+
+        third.begin_recording();
+        cer::draw_list(second);
+        third.end_recording();
+
+        // The first list would draw itself through the third and second list.
+        first.begin_recording();
+        REQUIRE_THROWS_AS(cer::draw_list(third), std::logic_error);
+        REQUIRE_THROWS_AS(cer::draw_list(first), std::logic_error);
+        first.end_recording();
+
+        REQUIRE(first.command_count() == 0);
+
+        // Drawing the same list more than once is fine.
+        second.begin_recording();
+        cer::draw_list(first);
+        cer::draw_list(first);
+        second.end_recording();
+
+        REQUIRE(second.command_count() == 2);
+    }
+
+    SECTION("Recording on another thread")
+    {
+        auto list = cer::DrawList::create();
+
+        auto thread = std::thread{[&list] {
+            list.begin_recording();
+
+            for (int i = 0; i < 100; ++i)
+            {
+                cer::fill_rectangle({float(i), 0, 1, 1});
+            }
+
+            list.end_recording();
+        }};
+
+        thread.join();
+
+        REQUIRE(list.command_count() == 100);
+    }
+}
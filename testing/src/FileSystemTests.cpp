@@ -0,0 +1,77 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "contentmanagement/FileSystem.hpp"
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <snitch/snitch.hpp>
+
+namespace
+{
+auto write_test_file(const std::filesystem::path& path, size_t size) -> cer::List<std::byte>
+{
+    auto contents = cer::List<std::byte>(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        contents[i] = std::byte((i * 7) + (i >> 8));
+    }
+
+    auto ofs = std::ofstream{path, std::ios::binary};
+    ofs.write(reinterpret_cast<const char*>(contents.data()), std::streamsize(size));
+
+    return contents;
+}
+} // namespace
+
+TEST_CASE("Asset data loading", "[content]")
+{
+    const auto directory = std::filesystem::temp_directory_path();
+
+    // Small files are read into a buffer, large ones may be memory-mapped. Both must look
+    // the same.
+    for (const auto size : std::array{size_t(0), size_t(1000), size_t(1024 * 1024) + 17})
+    {
+        CAPTURE(size);
+
+        const auto path     = directory / "cerlib_asset_data.bin";
+        const auto contents = write_test_file(path, size);
+
+        auto data = cer::filesystem::load_asset_data(path.string());
+
+        REQUIRE(data.size == size);
+        REQUIRE(std::ranges::equal(data.as_span(), contents));
+
+        // The data outlives the file.
+        std::filesystem::remove(path);
+
+        const auto copy = data.data;
+        data            = {};
+
+        REQUIRE((size == 0 || copy[size - 1] == contents[size - 1]));
+    }
+
+    SECTION("Detaching data from its file")
+    {
+        constexpr auto size = size_t(1024 * 1024);
+
+        const auto path     = directory / "cerlib_detached_asset_data.bin";
+        const auto contents = write_test_file(path, size);
+
+        const auto data =
+            cer::filesystem::detach_asset_data(cer::filesystem::load_asset_data(path.string()));
+
+        // Truncating the file in place must not affect the data.
+        write_test_file(path, 0);
+        std::filesystem::remove(path);
+
+        REQUIRE(data.size == size);
+        REQUIRE(std::ranges::equal(data.as_span(), contents));
+    }
+
+    REQUIRE_THROWS_AS(cer::filesystem::load_asset_data(
+                          (directory / "cerlib_file_that_does_not_exist.bin").string()),
+                      std::runtime_error);
+}
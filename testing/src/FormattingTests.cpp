@@ -79,5 +79,7 @@ TEST_CASE("Formatting", "[misc]")
         REQUIRE(cer_fmt::format("{}", ImageFormat::R8G8B8A8_UNorm) == "R8G8B8A8_UNorm");
         REQUIRE(cer_fmt::format("{}", ImageFormat::R8G8B8A8_Srgb) == "R8G8B8A8_Srgb");
         REQUIRE(cer_fmt::format("{}", ImageFormat::R32G32B32A32_Float) == "R32G32B32A32_Float");
+        REQUIRE(cer_fmt::format("{}", ImageFormat::BC1_UNorm) == "BC1_UNorm");
+        REQUIRE(cer_fmt::format("{}", ImageFormat::ETC2_RGBA8_Srgb) == "ETC2_RGBA8_Srgb");
     }
 }
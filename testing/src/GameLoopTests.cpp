@@ -0,0 +1,169 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "game/GameLoop.hpp"
+#include <cmath>
+#include <snitch/snitch.hpp>
+
+using cer::GameLoopOptions;
+using cer::details::GameLoop;
+
+static auto is_close(double lhs, double rhs) -> bool
+{
+    return std::abs(lhs - rhs) < 1.0e-9;
+}
+
+TEST_CASE("GameLoop", "[game]")
+{
+    SECTION("Variable update rate")
+    {
+        auto loop = GameLoop{};
+
+        REQUIRE(loop.begin_frame(10.0) == 1);
+        REQUIRE(loop.next_update_time().elapsed_time == 0.0);
+
+        REQUIRE(loop.begin_frame(10.25) == 1);
+        const auto& time = loop.next_update_time();
+        REQUIRE(is_close(time.elapsed_time, 0.25));
+        REQUIRE(is_close(time.total_time, 0.25));
+        REQUIRE(time.interpolation_alpha == 0.0);
+    }
+
+    SECTION("Fixed update rate")
+    {
+        auto loop = GameLoop{};
+        loop.set_options(GameLoopOptions{
+            .fixed_update_rate = 4.0,
+            .max_update_steps  = 8,
+            .target_fps        = {},
+        });
+
+        REQUIRE(loop.begin_frame(0.0) == 0);
+
+        // 0.625s at 4 Hz = 2 steps with half a step left over.
+        REQUIRE(loop.begin_frame(0.625) == 2);
+        REQUIRE(is_close(loop.game_time().interpolation_alpha, 0.5));
+        REQUIRE(is_close(loop.next_update_time().elapsed_time, 0.25));
+        REQUIRE(is_close(loop.next_update_time().total_time, 0.5));
+
+        // The leftover half step completes a step in the next frame.
+        REQUIRE(loop.begin_frame(0.75) == 1);
+        REQUIRE(is_close(loop.game_time().interpolation_alpha, 0.0));
+
+        // A frame that is shorter than a step doesn't update at all.
+        REQUIRE(loop.begin_frame(0.8125) == 0);
+        REQUIRE(is_close(loop.game_time().interpolation_alpha, 0.25));
+    }
+
+    SECTION("Max update steps")
+    {
+        auto loop = GameLoop{};
+        loop.set_options(GameLoopOptions{
+            .fixed_update_rate = 4.0,
+            .max_update_steps  = 3,
+            .target_fps        = {},
+        });
+
+        REQUIRE(loop.begin_frame(0.0) == 0);
+
+        // A 5.125s stall is capped to three steps and the rest is dropped.
+        REQUIRE(loop.begin_frame(5.125) == 3);
+        REQUIRE(is_close(loop.game_time().interpolation_alpha, 0.5));
+
+        // The dropped time is not caught up later.
+        REQUIRE(loop.begin_frame(5.25) == 1);
+    }
+
+    SECTION("Invalid options")
+    {
+        auto loop = GameLoop{};
+
+        auto options              = GameLoopOptions{};
+        options.fixed_update_rate = 0.0;
+        REQUIRE_THROWS_AS(loop.set_options(options), std::invalid_argument);
+
+        options                  = GameLoopOptions{};
+        options.max_update_steps = 0;
+        REQUIRE_THROWS_AS(loop.set_options(options), std::invalid_argument);
+
+        options            = GameLoopOptions{};
+        options.target_fps = -1.0;
+        REQUIRE_THROWS_AS(loop.set_options(options), std::invalid_argument);
+
+        // Invalid options must not be applied.
+        REQUIRE(loop.options() == GameLoopOptions{});
+    }
+
+    SECTION("Pipelining requires atomic reference counting")
+    {
+        auto loop = GameLoop{};
+
+        auto options      = GameLoopOptions{};
+        options.pipelined = true;
+
+#ifdef CERLIB_ATOMIC_REFCOUNTING
+        loop.set_options(options);
+        REQUIRE(loop.options().pipelined);
+#else
+        REQUIRE_THROWS_AS(loop.set_options(options), std::invalid_argument);
+#endif
+    }
+
+    SECTION("Frame pacing")
+    {
+        auto       now         = 0.0;
+        auto       total_slept = 0.0;
+        auto       clock_reads = 0;
+        const auto clock       = [&] {
+            ++clock_reads;
+            now += 0.0001; // Reading the clock takes a bit of time.
+            return now;
+        };
+        const auto sleep = [&](double duration) {
+            total_slept += duration;
+            now += duration;
+        };
+
+        auto loop = GameLoop{};
+        loop.set_options(GameLoopOptions{
+            .fixed_update_rate = {},
+            .max_update_steps  = 8,
+            .target_fps        = 50.0,
+        });
+
+        // The first frame anchors the schedule.
+        loop.pace_frame(clock, sleep);
+        const auto start = now;
+        REQUIRE(total_slept == 0.0);
+
+        // Simulate a frame that took 5ms of work; the rest of the 20ms frame is
+        // mostly slept, and the last part spun.
+        now += 0.005;
+        loop.pace_frame(clock, sleep);
+        REQUIRE(now >= start + 0.02);
+        REQUIRE(now < start + 0.02 + 0.001);
+        REQUIRE(total_slept > 0.0);
+        REQUIRE(total_slept < 0.02 - 0.005 - GameLoop::spin_duration + 0.001);
+        REQUIRE(clock_reads > 3);
+
+        // A frame that is more than a frame late re-anchors instead of catching up.
+        total_slept = 0.0;
+        now += 0.1;
+        loop.pace_frame(clock, sleep);
+        REQUIRE(total_slept == 0.0);
+    }
+
+    SECTION("No frame pacing by default")
+    {
+        auto       loop  = GameLoop{};
+        auto       calls = 0;
+        const auto clock = [&] {
+            ++calls;
+            return 0.0;
+        };
+
+        loop.pace_frame(clock, [&](double) { ++calls; });
+        REQUIRE(calls == 0);
+    }
+}
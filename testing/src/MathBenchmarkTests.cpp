@@ -0,0 +1,191 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <cerlib/Matrix.hpp>
+#include <cerlib/OStreamCompat.hpp>
+#include <cerlib/Rectangle.hpp>
+#include <cerlib/Vector2.hpp>
+#include <cerlib/Vector3.hpp>
+#include <cerlib/Vector4.hpp>
+#include <chrono>
+#include <cstdio>
+#include <snitch/snitch.hpp>
+#include <vector>
+
+// The hot math operations are defined inline in the headers, which also makes them
+// usable in constant expressions.
+static_assert(cer::dot(cer::Vector2{1, 2}, cer::Vector2{3, 4}) == 11.0f);
+static_assert(cer::Vector3{1, 2, 3} * 2.0f == cer::Vector3{2, 4, 6});
+static_assert(cer::lerp(cer::Vector4{0}, cer::Vector4{2}, 0.5f) == cer::Vector4{1});
+static_assert(cer::Rectangle{0, 0, 10, 10}.contains(cer::Vector2{5, 5}));
+static_assert((cer::translate({1, 2}) * cer::scale({2, 2})).m41 == 2.0f);
+
+namespace
+{
+constexpr size_t element_count = 4096;
+constexpr size_t repetitions   = 256;
+
+// Read on every repetition so that the compiler can't hoist the measured work out of
+// the benchmark loop.
+volatile float s_scale = 1.0f;
+
+// Runs func repetitions times and prints the average time per element.
+template <typename Func>
+auto run_benchmark(const char* name, Func&& func)
+{
+    using clock = std::chrono::steady_clock;
+
+    // Warm up caches once before measuring.
+    auto result = func(s_scale);
+
+    const auto start = clock::now();
+
+    for (size_t i = 0; i < repetitions; ++i)
+    {
+        result += func(s_scale);
+    }
+
+    const auto elapsed = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+    std::printf("%-32s %8.3f ns/element\n",
+                name,
+                elapsed / double(repetitions * element_count));
+
+    return result;
+}
+
+auto make_vectors() -> std::vector<cer::Vector2>
+{
+    auto vectors = std::vector<cer::Vector2>(element_count);
+
+    for (size_t i = 0; i < element_count; ++i)
+    {
+        vectors[i] = {float(i % 97), float(i % 31) - 15.0f};
+    }
+
+    return vectors;
+}
+} // namespace
+
+TEST_CASE("Math benchmarks", "[.benchmark]")
+{
+    const auto vectors = make_vectors();
+
+    SECTION("Vector2 arithmetic")
+    {
+        const auto result = run_benchmark("Vector2 arithmetic", [&](float scale) {
+            auto sum = cer::Vector2{};
+
+            for (const auto& v : vectors)
+            {
+                sum += (v * scale) - (v / 4.0f) + cer::Vector2{1.0f, -1.0f};
+            }
+
+            return sum.x + sum.y;
+        });
+
+        REQUIRE(result != 0.0f);
+    }
+
+    SECTION("Vector2 dot and lerp")
+    {
+        const auto result = run_benchmark("Vector2 dot and lerp", [&](float scale) {
+            auto sum = 0.0f;
+
+            for (size_t i = 1; i < vectors.size(); ++i)
+            {
+                const auto mid = cer::lerp(vectors[i - 1], vectors[i], scale * 0.5f);
+                sum += cer::dot(mid, vectors[i]);
+            }
+
+            return sum;
+        });
+
+        REQUIRE(result != 0.0f);
+    }
+
+    SECTION("Vector4 arithmetic")
+    {
+        const auto result = run_benchmark("Vector4 arithmetic", [&](float scale) {
+            auto sum = cer::Vector4{};
+
+            for (const auto& v : vectors)
+            {
+                const auto v4 = cer::Vector4{v.x, v.y, v.y, v.x} * scale;
+                sum += cer::clamp(v4 * 0.5f, cer::Vector4{-4.0f}, cer::Vector4{40.0f});
+            }
+
+            return sum.x + sum.y + sum.z + sum.w;
+        });
+
+        REQUIRE(result != 0.0f);
+    }
+
+    SECTION("Matrix multiply")
+    {
+        const auto result = run_benchmark("Matrix multiply", [&](float scale) {
+            auto matrix = cer::Matrix{1.0f};
+
+            for (const auto& v : vectors)
+            {
+                matrix = matrix * cer::translate(v * (scale * 0.001f));
+            }
+
+            return matrix.m41 + matrix.m42;
+        });
+
+        REQUIRE(result != 0.0f);
+    }
+
+    SECTION("Point transform")
+    {
+        auto transformed = std::vector<cer::Vector2>(vectors.size());
+
+        const auto scalar_result = run_benchmark("Point transform (scalar)", [&](float scale) {
+            const auto matrix = cer::rotate(0.5f) * cer::translate({scale, 2.0f});
+
+            for (size_t i = 0; i < vectors.size(); ++i)
+            {
+                transformed[i] = cer::transform_point(vectors[i], matrix);
+            }
+
+            return transformed.back().x;
+        });
+
+        const auto batch_result = run_benchmark("Point transform (batch)", [&](float scale) {
+            const auto matrix = cer::rotate(0.5f) * cer::translate({scale, 2.0f});
+            cer::transform_points(vectors, matrix, transformed);
+            return transformed.back().x;
+        });
+
+        REQUIRE(scalar_result == batch_result);
+    }
+
+    SECTION("Rectangle tests")
+    {
+        const auto result = run_benchmark("Rectangle tests", [&](float scale) {
+            const auto area  = cer::Rectangle{10.0f, -5.0f, 40.0f, 20.0f};
+            auto       count = 0.0f;
+
+            for (const auto& v : vectors)
+            {
+                const auto rect = cer::Rectangle{v * scale, {8.0f, 8.0f}};
+
+                if (area.contains(v))
+                {
+                    count += 1.0f;
+                }
+
+                if (area.intersects(rect.inflated(1.0f)))
+                {
+                    count += 1.0f;
+                }
+            }
+
+            return count;
+        });
+
+        REQUIRE(result != 0.0f);
+    }
+}
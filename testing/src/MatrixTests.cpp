@@ -3,10 +3,13 @@
 // For conditions of distribution and use, see copyright notice in LICENSE.
 
 #include <algorithm>
+#include <array>
 #include <cerlib/Math.hpp>
 #include <cerlib/Matrix.hpp>
 #include <cerlib/OStreamCompat.hpp>
+#include <cerlib/Rectangle.hpp>
 #include <cerlib/Vector4.hpp>
+#include <ranges>
 #include <snitch/snitch.hpp>
 
 using cer::Matrix;
@@ -72,5 +75,129 @@ TEST_CASE("Matrix", "[math]")
         // 0 * a = 0 && a * 0 = 0:
         REQUIRE(Matrix{0.0f} * a == Matrix{0.0f});
         REQUIRE(a * Matrix{0.0f} == Matrix{0.0f});
+
+        // Matches the scalar reference:
+        const auto lhs = Matrix{1, -2, 3, 4, 5, 6, -7, 8, 9, 10, 11, 12, 13, 14, -15, 16};
+        const auto rhs = Matrix{0.5f, 2, 0, 1, -1, 3, 2, 0, 4, 0, 1, -2, 1, 1, 1, 1};
+        auto       expected = Matrix{0.0f};
+
+        for (size_t row = 0; row < 4; ++row)
+        {
+            for (size_t col = 0; col < 4; ++col)
+            {
+                auto sum = 0.0f;
+
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    sum += lhs.data()[(row * 4) + k] * rhs.data()[(k * 4) + col];
+                }
+
+                expected.begin()[(row * 4) + col] = sum;
+            }
+        }
+
+        REQUIRE(lhs * rhs == expected);
+    }
+
+    SECTION("inverse")
+    {
+        REQUIRE(*cer::inverse(Matrix{}) == Matrix{});
+        REQUIRE_FALSE(cer::inverse(Matrix{0.0f}).has_value());
+        REQUIRE_FALSE(cer::inverse(cer::scale({1, 0})).has_value());
+        REQUIRE(*cer::inverse(cer::translate({3, -4})) == cer::translate({-3, 4}));
+        REQUIRE(*cer::inverse(cer::scale({2, 4})) == cer::scale({0.5f, 0.25f}));
+
+        const auto rad = cer::radians(30.0f);
+        REQUIRE(are_equal_within(*cer::inverse(cer::rotate(rad)), cer::rotate(-rad), 0.000001f));
+
+        const auto m = Matrix{2, 0, 1, 0, 1, 3, 0, 1, 0, 1, 4, 0, 1, 0, 0, 2};
+        const auto m_inv = cer::inverse(m);
+
+        REQUIRE(m_inv.has_value());
+        REQUIRE(are_equal_within(m * *m_inv, Matrix{}, 0.00001f));
+        REQUIRE(are_equal_within(*m_inv * m, Matrix{}, 0.00001f));
+    }
+
+    SECTION("transform_point")
+    {
+        REQUIRE(cer::transform_point({1, 2}, Matrix{}) == cer::Vector2{1, 2});
+        REQUIRE(cer::transform_point({1, 2}, cer::translate({3, 4})) == cer::Vector2{4, 6});
+        REQUIRE(cer::transform_point({1, 2}, cer::scale({2, 3})) == cer::Vector2{2, 6});
+        REQUIRE(cer::transform_point({1, 2}, cer::scale({2, 3}) * cer::translate({1, 1})) ==
+                cer::Vector2{3, 7});
+    }
+
+    SECTION("transform_points")
+    {
+        const auto matrix = cer::scale({2, -1}) * cer::rotate(cer::radians(60.0f)) *
+                            cer::translate({10, 20});
+
+        auto points = cer::List<cer::Vector2>{};
+
+        for (int i = 0; i < 7; ++i)
+        {
+            points.push_back({float(i) * 1.5f, float(3 - i)});
+        }
+
+        auto transformed = cer::List<cer::Vector2>(points.size());
+        cer::transform_points(points, matrix, transformed);
+
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            REQUIRE(transformed[i] == cer::transform_point(points[i], matrix));
+        }
+
+        // In place:
+        cer::transform_points(points, matrix, points);
+        REQUIRE(points == transformed);
+
+        // Empty input:
+        cer::transform_points({}, matrix, {});
+
+        auto too_small = cer::List<cer::Vector2>(points.size() - 1);
+        REQUIRE_THROWS_AS(cer::transform_points(points, matrix, too_small),
+                          std::invalid_argument);
+    }
+
+    SECTION("transform_rects")
+    {
+        const auto rects = std::array{
+            cer::Rectangle{0, 0, 10, 20},
+            cer::Rectangle{-5, 3, 2, 1},
+        };
+
+        auto transformed = std::array<cer::Rectangle, 2>{};
+
+        cer::transform_rects(rects, cer::translate({1, 2}) * cer::scale({2, 3}), transformed);
+        REQUIRE(transformed[0] == cer::Rectangle{2, 6, 20, 60});
+        REQUIRE(transformed[1] == cer::Rectangle{-8, 15, 4, 3});
+
+        // A rotation by 90 degrees swaps the extents.
+        const auto rotation = cer::rotate(cer::radians(90.0f));
+        cer::transform_rects(rects, rotation, transformed);
+
+        for (size_t i = 0; i < rects.size(); ++i)
+        {
+            const auto& rect = rects[i];
+
+            const auto corners = std::array{
+                cer::transform_point(rect.top_left(), rotation),
+                cer::transform_point(rect.top_right(), rotation),
+                cer::transform_point(rect.bottom_left(), rotation),
+                cer::transform_point(rect.bottom_right(), rotation),
+            };
+
+            const auto [min_x, max_x] = std::ranges::minmax(
+                corners | std::views::transform([](cer::Vector2 v) { return v.x; }));
+            const auto [min_y, max_y] = std::ranges::minmax(
+                corners | std::views::transform([](cer::Vector2 v) { return v.y; }));
+
+            REQUIRE(transformed[i] == cer::Rectangle{min_x, min_y, max_x - min_x, max_y - min_y});
+            REQUIRE(cer::equal_within(transformed[i].width, rect.height, 0.00001f));
+            REQUIRE(cer::equal_within(transformed[i].height, rect.width, 0.00001f));
+        }
+
+        auto too_small = std::array<cer::Rectangle, 1>{};
+        REQUIRE_THROWS_AS(cer::transform_rects(rects, Matrix{}, too_small), std::invalid_argument);
     }
 }
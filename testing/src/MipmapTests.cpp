@@ -0,0 +1,97 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "graphics/Mipmaps.hpp"
+#include <array>
+#include <cerlib/List.hpp>
+#include <cstring>
+#include <snitch/snitch.hpp>
+
+using cer::ImageFormat;
+
+TEST_CASE("Mipmap generation", "[graphics]")
+{
+    SECTION("Mipmap count and extents")
+    {
+        REQUIRE(cer::details::full_mipmap_count(1, 1) == 1);
+        REQUIRE(cer::details::full_mipmap_count(256, 256) == 9);
+        REQUIRE(cer::details::full_mipmap_count(300, 17) == 9);
+        REQUIRE(cer::details::mipmap_extent(300, 3) == 37);
+        REQUIRE(cer::details::mipmap_extent(17, 8) == 1);
+    }
+
+    SECTION("Box filter")
+    {
+        // clang-format off
+        constexpr auto pixels = std::array<uint8_t, 4 * 2>{
+            0,   100,
+            200, 60,
+            8,   8,
+            16,  16,
+        };
+        // clang-format on
+
+        const auto mipmaps = cer::details::generate_mipmaps(2, 4, ImageFormat::R8_UNorm, &pixels);
+
+        REQUIRE(mipmaps.size() == 2);
+        REQUIRE(mipmaps[0].size() == 2);
+        REQUIRE(mipmaps[1].size() == 1);
+
+        REQUIRE(uint8_t(mipmaps[0][0]) == 90);
+        REQUIRE(uint8_t(mipmaps[0][1]) == 12);
+        REQUIRE(uint8_t(mipmaps[1][0]) == 51);
+    }
+
+    SECTION("Odd extents fold into the last pixel")
+    {
+        constexpr auto pixels = std::array<uint8_t, 3>{30, 60, 90};
+
+        const auto mipmaps = cer::details::generate_mipmaps(3, 1, ImageFormat::R8_UNorm, &pixels);
+
+        REQUIRE(mipmaps.size() == 1);
+        REQUIRE(mipmaps[0].size() == 1);
+        REQUIRE(uint8_t(mipmaps[0][0]) == 60);
+    }
+
+    SECTION("Transparent pixels don't bleed their color")
+    {
+        // An opaque red pixel next to a transparent green one.
+        constexpr auto pixels = std::array<uint8_t, 8>{255, 0, 0, 255, 0, 255, 0, 0};
+
+        const auto mipmaps =
+            cer::details::generate_mipmaps(2, 1, ImageFormat::R8G8B8A8_UNorm, &pixels);
+
+        REQUIRE(mipmaps.size() == 1);
+        REQUIRE(uint8_t(mipmaps[0][0]) == 255);
+        REQUIRE(uint8_t(mipmaps[0][1]) == 0);
+        REQUIRE(uint8_t(mipmaps[0][2]) == 0);
+        REQUIRE(uint8_t(mipmaps[0][3]) == 128);
+    }
+
+    SECTION("sRGB images are averaged in linear space")
+    {
+        constexpr auto pixels = std::array<uint8_t, 8>{0, 0, 0, 255, 255, 255, 255, 255};
+
+        const auto mipmaps =
+            cer::details::generate_mipmaps(2, 1, ImageFormat::R8G8B8A8_Srgb, &pixels);
+
+        // Half of the linear intensity is 188 in sRGB, not 128.
+        REQUIRE(uint8_t(mipmaps[0][0]) == 188);
+        REQUIRE(uint8_t(mipmaps[0][3]) == 255);
+    }
+
+    SECTION("Float images")
+    {
+        constexpr auto pixels = std::array{1.0f, 2.0f, 3.0f, 1.0f, 3.0f, 4.0f, 5.0f, 1.0f};
+
+        const auto mipmaps =
+            cer::details::generate_mipmaps(2, 1, ImageFormat::R32G32B32A32_Float, &pixels);
+
+        auto result = std::array<float, 4>{};
+        REQUIRE(mipmaps[0].size() == sizeof(result));
+        std::memcpy(result.data(), mipmaps[0].data(), sizeof(result));
+
+        REQUIRE(result == std::array{2.0f, 3.0f, 4.0f, 1.0f});
+    }
+}
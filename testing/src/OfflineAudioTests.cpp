@@ -0,0 +1,302 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "WavTestHelper.hpp"
+#include "audio/AudioDevice.hpp"
+#include "audio/Noise.hpp"
+#include "audio/Wav.hpp"
+#include <algorithm>
+#include <cerlib/List.hpp>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <snitch/snitch.hpp>
+
+using cer::AudioBackend;
+using cer::AudioDevice;
+using cer::EngineFlags;
+
+static constexpr size_t sample_rate = 44100;
+static constexpr size_t buffer_size = 1024;
+static constexpr size_t channels    = 2;
+
+// A 16-bit stereo WAV file of a low sine wave, with the same signal in both channels.
+static auto make_sine_wav(uint32_t wav_sample_rate, uint32_t frame_count) -> cer::List<std::byte>
+{
+    auto samples = cer::List<int16_t>(size_t(frame_count) * 2);
+
+    for (uint32_t i = 0; i < frame_count; ++i)
+    {
+        const auto t     = double(i) / double(wav_sample_rate);
+        const auto value = int16_t(16000.0 * std::sin(t * 50.0 * 2.0 * 3.14159265358979));
+
+        samples[size_t(i) * 2]     = value;
+        samples[size_t(i) * 2 + 1] = value;
+    }
+
+    return make_wav_data(wav_sample_rate, 2, samples);
+}
+
+TEST_CASE("Offline audio", "[audio]")
+{
+    auto device = AudioDevice{EngineFlags{},
+                              sample_rate,
+                              buffer_size,
+                              channels,
+                              AudioBackend::NullDriver};
+
+    REQUIRE(device.backend() == AudioBackend::NullDriver);
+    REQUIRE(device.backend_sample_rate() == sample_rate);
+    REQUIRE(device.backend_channels() == channels);
+
+    SECTION("Silence")
+    {
+        auto buffer = cer::List<float>(sample_rate * channels, 1.0f);
+        device.render_offline(buffer);
+
+        REQUIRE(std::ranges::all_of(buffer, [](float f) { return f == 0.0f; }));
+
+        const auto stats = device.mixer_stats();
+        REQUIRE(stats.mixed_frames == sample_rate);
+        REQUIRE(stats.mixed_voice_frames == 0);
+    }
+
+    SECTION("Voices")
+    {
+        auto noise = cer::Noise{};
+        device.play(noise, 0.5f);
+        device.play(noise, 0.5f);
+
+        // Not a multiple of the buffer size, to cover the partial last chunk.
+        auto buffer = cer::List<float>(2500 * channels);
+        device.render_offline(buffer);
+
+        REQUIRE(std::ranges::any_of(buffer, [](float f) { return f != 0.0f; }));
+
+        const auto stats = device.mixer_stats();
+        REQUIRE(stats.mixed_frames == 2500);
+        REQUIRE(stats.mixed_voice_frames == 2 * 2500);
+        REQUIRE(stats.mix_duration > 0.0);
+        REQUIRE(stats.voice_frames_per_second > 0.0);
+    }
+
+    SECTION("Render to file")
+    {
+        const auto path = std::filesystem::temp_directory_path() / "cerlib_offline_audio.wav";
+
+        device.render_offline_to_file(path.string(), 3000);
+
+        // 32-bit float samples plus the RIFF header.
+        REQUIRE(std::filesystem::file_size(path) >= 3000 * channels * sizeof(float));
+        REQUIRE(device.mixer_stats().mixed_frames == 3000);
+
+        std::filesystem::remove(path);
+    }
+
+    SECTION("Parallel mixing")
+    {
+        constexpr auto voice_count = size_t(32);
+
+        auto noise           = cer::Noise{};
+        auto serial_device   = AudioDevice{EngineFlags{},
+                                         sample_rate,
+                                         buffer_size,
+                                         channels,
+                                         AudioBackend::NullDriver};
+        auto serial_buffer   = cer::List<float>(4096 * channels);
+        auto parallel_buffer = cer::List<float>(4096 * channels);
+
+        serial_device.set_mix_worker_count(0);
+        device.set_mix_worker_count(3);
+
+        for (auto* d : {&serial_device, &device})
+        {
+            d->set_max_active_voice_count(voice_count);
+
+            for (size_t i = 0; i < voice_count; ++i)
+            {
+                d->play(noise, 0.05f, (float(i) / float(voice_count)) - 0.5f);
+            }
+        }
+
+        serial_device.render_offline(serial_buffer);
+        device.render_offline(parallel_buffer);
+
+        // Only the summation order differs.
+        for (size_t i = 0; i < serial_buffer.size(); ++i)
+        {
+            REQUIRE(std::abs(serial_buffer[i] - parallel_buffer[i]) < 1.0e-5f);
+        }
+
+        REQUIRE(serial_device.mixer_stats().mix_thread_count == 1);
+        REQUIRE(device.mixer_stats().mix_thread_count == 4);
+        REQUIRE(device.mixer_stats().mixed_voice_frames == voice_count * 4096);
+    }
+
+    SECTION("Commands")
+    {
+        auto noise  = cer::Noise{};
+        auto buffer = cer::List<float>(1024 * channels);
+
+        // Handles are valid right away, before the mixer has seen the play command.
+        const auto first  = device.play(noise, 0.25f);
+        const auto second = device.play(noise, 0.25f);
+
+        REQUIRE(first != second);
+        REQUIRE(device.is_valid_voice_handle(first));
+        REQUIRE(device.voice_count() == 2);
+
+        device.set_volume(first, 0.75f);
+        device.set_pause(second, true);
+
+        REQUIRE(device.volume(first) == 0.75f);
+        REQUIRE(device.pause(second));
+
+        device.fade_volume(first, 0.0f, 1.0);
+        device.stop(second);
+        device.render_offline(buffer);
+
+        REQUIRE(device.volume(first) < 0.75f);
+        REQUIRE_FALSE(device.is_valid_voice_handle(second));
+        REQUIRE(device.voice_count() == 1);
+
+        // A freed voice is reused by the next play.
+        const auto third = device.play(noise);
+        REQUIRE((third & 0xfff) == (second & 0xfff));
+        REQUIRE(device.is_valid_voice_handle(third));
+    }
+
+    SECTION("Instance pooling")
+    {
+        constexpr auto voice_count = size_t(16);
+
+        auto echo   = cer::EchoFilter{};
+        auto noise  = cer::Noise{};
+        auto buffer = cer::List<float>(1024 * channels);
+
+        noise.set_filter(0, &echo);
+
+        for (size_t round = 0; round < 10; ++round)
+        {
+            for (size_t i = 0; i < voice_count; ++i)
+            {
+                device.play(noise);
+            }
+
+            device.render_offline(buffer);
+            device.stop_all_sounds();
+        }
+
+        // Only the first round allocates, later rounds reuse the freed instances.
+        REQUIRE(noise.instance_pool->allocated_block_count() == voice_count);
+        REQUIRE(noise.instance_pool->free_block_count() == voice_count);
+        REQUIRE(echo.instance_pool->allocated_block_count() == voice_count);
+        REQUIRE(echo.instance_pool->free_block_count() == voice_count);
+    }
+
+    SECTION("Load options")
+    {
+        const auto wav_data = make_sine_wav(32000, 32000);
+
+        auto plain     = cer::Wav{wav_data};
+        auto prepared  = cer::Wav{wav_data,
+                                 cer::SoundLoadOptions{
+                                     .resample_to_device_rate = true,
+                                     .sample_format           = cer::SoundSampleFormat::Int16,
+                                     .downmix_to_mono         = true,
+                                 },
+                                 float(sample_rate)};
+        auto int16_wav = cer::Wav{wav_data,
+                                  cer::SoundLoadOptions{
+                                      .sample_format = cer::SoundSampleFormat::Int16,
+                                  }};
+
+        REQUIRE(prepared.base_sample_rate == float(sample_rate));
+        REQUIRE(prepared.channel_count == 1);
+        REQUIRE(std::abs(prepared.length_time() - plain.length_time()) < 0.001);
+        REQUIRE(int16_wav.sample_data_size() * 2 == plain.sample_data_size());
+
+        auto prepared_device = AudioDevice{EngineFlags{},
+                                           sample_rate,
+                                           buffer_size,
+                                           channels,
+                                           AudioBackend::NullDriver};
+
+        // Stays within the first block of source samples that the mixer resamples the plain
+        // sound from. At every block boundary it drops the fractional source position, so the
+        // plain sound gradually runs ahead of the prepared one after that.
+        auto plain_buffer    = cer::List<float>(640 * channels);
+        auto prepared_buffer = cer::List<float>(640 * channels);
+
+        device.play(plain);
+        prepared_device.play(prepared);
+
+        device.render_offline(plain_buffer);
+        prepared_device.render_offline(prepared_buffer);
+
+        // What remains is the mixer's interpolation delay of the plain sound, which is two
+        // source samples instead of two device samples.
+        for (size_t i = 0; i < plain_buffer.size(); ++i)
+        {
+            REQUIRE(std::abs(plain_buffer[i] - prepared_buffer[i]) < 0.005f);
+        }
+
+        device.stop_all_sounds();
+        prepared_device.stop_all_sounds();
+    }
+
+    SECTION("ADPCM samples")
+    {
+        // Not a multiple of the ADPCM block size.
+        const auto wav_data = make_sine_wav(32000, 10000);
+
+        auto plain = cer::Wav{wav_data};
+        auto adpcm = cer::Wav{wav_data,
+                              cer::SoundLoadOptions{
+                                  .sample_format = cer::SoundSampleFormat::Adpcm,
+                              }};
+
+        REQUIRE(adpcm.sample_data_size() * 7 < plain.sample_data_size());
+        REQUIRE(adpcm.length_time() == plain.length_time());
+
+        auto plain_instance = plain.create_instance();
+        auto adpcm_instance = adpcm.create_instance();
+
+        plain_instance->init(plain, 0);
+        adpcm_instance->init(adpcm, 0);
+
+        // Odd read sizes, so that most reads start and end inside a block.
+        constexpr auto read_size = size_t(300);
+
+        auto plain_samples = cer::List<float>(read_size * 2);
+        auto adpcm_samples = cer::List<float>(read_size * 2);
+        auto total_read    = size_t(0);
+
+        while (!adpcm_instance->has_ended())
+        {
+            const auto count = adpcm_instance->audio(adpcm_samples.data(), read_size, read_size);
+
+            REQUIRE(plain_instance->audio(plain_samples.data(), read_size, read_size) == count);
+
+            for (size_t i = 0; i < read_size * 2; ++i)
+            {
+                if (i % read_size < count)
+                {
+                    REQUIRE(std::abs(plain_samples[i] - adpcm_samples[i]) < 0.01f);
+                }
+            }
+
+            total_read += count;
+        }
+
+        REQUIRE(total_read == 10000);
+        REQUIRE(plain_instance->has_ended());
+    }
+
+    SECTION("Invalid destination size")
+    {
+        auto buffer = cer::List<float>(3);
+        REQUIRE_THROWS_AS(device.render_offline(buffer), std::invalid_argument);
+    }
+}
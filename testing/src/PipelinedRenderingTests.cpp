@@ -0,0 +1,187 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <array>
+#include <cerlib/Drawing.hpp>
+#include <cerlib/Font.hpp>
+#include <cerlib/Game.hpp>
+#include <cerlib/Image.hpp>
+#include <cerlib/OStreamCompat.hpp>
+#include <cerlib/Text.hpp>
+#include <snitch/snitch.hpp>
+
+using namespace cer;
+
+// Records a frame on the worker thread, then turns pipelining off again and compares the
+// replayed result with the same drawing done directly on the main thread.
+class PipelinedGame final : public Game
+{
+  public:
+    PipelinedGame()
+        : m_window("Pipelined Test Window", 0, {}, {}, 300, 300, false)
+    {
+    }
+
+    void load_content() override
+    {
+        m_logo = Image(cer_fmt::format("{}/cerlib-logo300.png", TEST_ASSETS_DIR));
+
+        m_recorded_canvas  = Image{64, 64, ImageFormat::R8G8B8A8_UNorm, m_window};
+        m_reference_canvas = Image{64, 64, ImageFormat::R8G8B8A8_UNorm, m_window};
+        m_recorded_canvas.set_canvas_clear_color(black);
+        m_reference_canvas.set_canvas_clear_color(black);
+
+        const auto pixel = std::array<uint8_t, 4>{255, 0, 255, 255};
+        m_released_image = Image{1, 1, ImageFormat::R8G8B8A8_UNorm, pixel.data()};
+
+        m_readback = read_canvas_data_async(m_recorded_canvas, 0, 0, 8, 8);
+
+        auto options      = loop_options();
+        options.pipelined = true;
+        set_loop_options(options);
+    }
+
+    bool update([[maybe_unused]] const GameTime& time) override
+    {
+        ++m_frame;
+
+        if (m_frame == 1)
+        {
+            // The worker must leave the canvas pool to the render thread.
+            REQUIRE_THROWS_AS(acquire_canvas(8, 8, ImageFormat::R8G8B8A8_UNorm, m_window),
+                              std::logic_error);
+            REQUIRE_THROWS_AS(trim_canvas_pool(), std::logic_error);
+            REQUIRE_THROWS_AS(set_canvas_pool_max_idle_frames(1), std::logic_error);
+
+            // The same goes for readbacks, which are destroyed by the render thread once
+            // they're released here.
+            REQUIRE_THROWS_AS(m_readback.is_ready(), std::logic_error);
+            REQUIRE_THROWS_AS(m_readback.read(), std::logic_error);
+            m_readback = {};
+        }
+        else if (m_frame == 2)
+        {
+            // The image is still referenced by the frame that was recorded in the previous
+            // tick, so the last reference is released by the main thread after rendering.
+            // Releasing it here on the worker must not destroy it prematurely.
+            m_released_image = {};
+
+            auto options      = loop_options();
+            options.pipelined = false;
+            set_loop_options(options);
+        }
+
+        return !m_have_executed_tests;
+    }
+
+    void draw([[maybe_unused]] const Window& window) override
+    {
+        if (m_frame == 1)
+        {
+            // Runs on the worker and is replayed on the main thread in the next tick.
+            draw_scene(m_recorded_canvas);
+        }
+        else if (m_frame == 3)
+        {
+            // Pipelining was turned off, so this runs on the main thread.
+            draw_scene(m_reference_canvas);
+
+            const auto recorded  = read_canvas_data(m_recorded_canvas, 0, 0, 64, 64);
+            const auto reference = read_canvas_data(m_reference_canvas, 0, 0, 64, 64);
+
+            REQUIRE(recorded == reference);
+
+            // The scene must have been drawn at all.
+            set_canvas(m_reference_canvas);
+            set_canvas({});
+
+            REQUIRE(read_canvas_data(m_reference_canvas, 0, 0, 64, 64) != recorded);
+
+            m_have_executed_tests = true;
+        }
+    }
+
+  private:
+    void draw_scene(const Image& canvas)
+    {
+        set_canvas(canvas);
+        draw_sprite(m_logo, {-20, -30});
+        fill_rectangle({10, 10, 20, 20}, red);
+
+        if (m_released_image)
+        {
+            draw_sprite({
+                .image    = m_released_image,
+                .dst_rect = {40, 40, 16, 16},
+            });
+        }
+        else
+        {
+            fill_rectangle({40, 40, 16, 16}, Color{1.0f, 0.0f, 1.0f, 1.0f});
+        }
+
+        set_canvas({});
+    }
+
+    Window         m_window;
+    Image          m_logo;
+    Image          m_recorded_canvas;
+    Image          m_reference_canvas;
+    Image          m_released_image;
+    CanvasReadback m_readback;
+    uint32_t       m_frame{};
+    bool           m_have_executed_tests{};
+};
+
+// Ends the game while the last reference to a retained text is held by a recorded frame.
+// The text's GPU data must be destroyed while the graphics device still exists.
+class RecordedTextGame final : public Game
+{
+  public:
+    RecordedTextGame()
+        : m_window("Pipelined Text Test Window", 0, {}, {}, 300, 300, false)
+    {
+    }
+
+    void load_content() override
+    {
+        m_text = Text{"Recorded", Font::built_in(), 16};
+        m_text.set_retained(true);
+
+        auto options      = loop_options();
+        options.pipelined = true;
+        set_loop_options(options);
+    }
+
+    bool update([[maybe_unused]] const GameTime& time) override
+    {
+        ++m_frame;
+        return m_frame < 3;
+    }
+
+    void draw([[maybe_unused]] const Window& window) override
+    {
+        if (m_text)
+        {
+            draw_text(m_text, {10, 10}, white);
+        }
+
+        // The first frame was replayed in the meantime, which created the text's GPU data.
+        if (m_frame == 2)
+        {
+            m_text = {};
+        }
+    }
+
+  private:
+    Window   m_window;
+    Text     m_text;
+    uint32_t m_frame{};
+};
+
+TEST_CASE("PipelinedRenderingTests", "[drawing]")
+{
+    REQUIRE(run_game<PipelinedGame>() == 0);
+    REQUIRE(run_game<RecordedTextGame>() == 0);
+}
@@ -0,0 +1,97 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "audio/Resampler.hpp"
+#include <array>
+#include <cerlib/List.hpp>
+#include <cmath>
+#include <snitch/snitch.hpp>
+
+using cer::Resampler;
+using cer::sample_granularity;
+using cer::s_fixpoint_frac_bits;
+using cer::s_fixpoint_frac_mul;
+
+TEST_CASE("Resampler kernels", "[audio]")
+{
+    auto prev_src = cer::List<float>(sample_granularity);
+    auto src      = cer::List<float>(sample_granularity);
+
+    for (size_t i = 0; i < sample_granularity; ++i)
+    {
+        prev_src[i] = std::sin(float(i) * 0.37f);
+        src[i]      = std::cos(float(i) * 0.11f) * 0.8f;
+    }
+
+    const auto& scalar = cer::details::scalar_resample_kernels();
+
+    REQUIRE(cer::details::supported_resample_kernels().size() >= 1);
+
+    // Unit step, slower and faster playback, and start positions inside the history.
+    constexpr auto steps   = std::array{1.0, 0.5, 0.91875, 1.37, 2.9};
+    constexpr auto offsets = std::array{0.0, 0.25, 1.5, 2.75, 3.0, 17.125};
+
+    for (const auto& kernels : cer::details::supported_resample_kernels())
+    {
+        for (const auto resampler : {Resampler::Point, Resampler::Linear, Resampler::CatmullRom})
+        {
+            for (const auto step : steps)
+            {
+                for (const auto offset : offsets)
+                {
+                    const auto step_fixed = size_t(step * s_fixpoint_frac_mul);
+                    const auto src_offset = size_t(offset * s_fixpoint_frac_mul);
+
+                    // As many samples as possible without reading past the end of src.
+                    const auto count =
+                        ((sample_granularity << s_fixpoint_frac_bits) - 1 - src_offset) /
+                            step_fixed +
+                        1;
+
+                    auto expected = cer::List<float>(count);
+                    auto actual   = cer::List<float>(count);
+
+                    scalar.get(resampler)(
+                        src.data(), prev_src.data(), expected.data(), src_offset, count, step_fixed);
+
+                    kernels.get(resampler)(
+                        src.data(), prev_src.data(), actual.data(), src_offset, count, step_fixed);
+
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        CAPTURE(kernels.name, step, offset, i);
+                        REQUIRE(std::abs(actual[i] - expected[i]) < 1.0e-5f);
+                    }
+                }
+            }
+        }
+    }
+
+    // The copying kernels must match the scalar ones at a step of 1.0, from any position.
+    const auto& unit_step = cer::details::unit_step_resample_kernels();
+
+    for (const auto resampler : {Resampler::Point, Resampler::Linear, Resampler::CatmullRom})
+    {
+        for (const auto offset : offsets)
+        {
+            const auto src_offset = size_t(offset * s_fixpoint_frac_mul);
+            const auto count      = sample_granularity - size_t(offset);
+
+            auto expected = cer::List<float>(count);
+            auto actual   = cer::List<float>(count);
+
+            scalar.get(resampler)(
+                src.data(), prev_src.data(), expected.data(), src_offset, count, s_fixpoint_frac_mul);
+
+            unit_step.get(resampler)(
+                src.data(), prev_src.data(), actual.data(), src_offset, count, s_fixpoint_frac_mul);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                CAPTURE(offset, i);
+                REQUIRE(std::abs(actual[i] - expected[i]) < 1.0e-5f);
+            }
+        }
+    }
+}
@@ -3,10 +3,19 @@
 // For conditions of distribution and use, see copyright notice in LICENSE.
 
 #include "RenderingTestHelper.hpp"
+#include "graphics/CanvasPool.hpp"
+#include "graphics/GraphicsDevice.hpp"
+#include "graphics/ImageImpl.hpp"
+#include "graphics/ShaderImpl.hpp"
+#include <array>
 #include <cerlib/Drawing.hpp>
+#include <cerlib/Font.hpp>
 #include <cerlib/Game.hpp>
 #include <cerlib/OStreamCompat.hpp>
 #include <cerlib/Shader.hpp>
+#include <cerlib/Text.hpp>
+#include <chrono>
+#include <cstdio>
 #include <snitch/snitch.hpp>
 
 using namespace cer;
@@ -50,6 +59,301 @@ class MockGame final : public Game
             });
         }
 
+        SECTION("sprites of different images share a draw call")
+        {
+            const auto pixels = std::array<uint8_t, 16>{
+                255, 0, 0, 255, 0, 255, 0, 255, 0, 0, 255, 255, 255, 255, 255, 255,
+            };
+
+            const auto small_image = Image{2, 2, ImageFormat::R8G8B8A8_UNorm, pixels.data()};
+            const auto canvas      = Image{64, 64, ImageFormat::R8G8B8A8_UNorm, m_window};
+
+            const auto draw_alternating_sprites = [&] {
+                for (int i = 0; i < 8; ++i)
+                {
+                    draw_sprite(m_logo, {0, 0});
+                    draw_sprite(small_image, {10, 10});
+                }
+            };
+
+            set_canvas(canvas);
+            const auto draw_calls = frame_stats().draw_calls;
+            draw_alternating_sprites();
+            set_canvas({});
+
+            REQUIRE(frame_stats().draw_calls == draw_calls + 1);
+
+            // A sprite shader samples a single image, so each image change needs a draw call.
+            set_canvas(canvas);
+            set_sprite_shader(m_grayscale_shader);
+            const auto draw_calls_with_shader = frame_stats().draw_calls;
+            draw_alternating_sprites();
+            set_canvas({});
+            set_sprite_shader({});
+
+            REQUIRE(frame_stats().draw_calls == draw_calls_with_shader + 16);
+        }
+
+        SECTION("reading canvas data asynchronously")
+        {
+            const auto canvas = Image{64, 32, ImageFormat::R8G8B8A8_UNorm, m_window};
+
+            set_canvas(canvas);
+            draw_sprite(m_logo, {-10, -20});
+            set_canvas({});
+
+            const auto readback = read_canvas_data_async(canvas, 8, 4, 40, 20);
+
+            REQUIRE(readback.width() == 40);
+            REQUIRE(readback.height() == 20);
+            REQUIRE(readback.size_in_bytes() == 40 * 20 * 4);
+
+            // Drawing to the canvas again must not affect the pending data.
+            set_canvas(canvas);
+            draw_sprite(m_logo, {0, 0});
+            set_canvas({});
+
+            const auto data = readback.read();
+
+            REQUIRE(readback.is_ready());
+
+            set_canvas(canvas);
+            draw_sprite(m_logo, {-10, -20});
+            set_canvas({});
+
+            REQUIRE(read_canvas_data(canvas, 8, 4, 40, 20) == data);
+        }
+
+        SECTION("acquiring pooled canvases")
+        {
+            const auto stats = frame_stats();
+
+            constexpr auto format = ImageFormat::R8G8B8A8_UNorm;
+
+            auto        canvas      = acquire_canvas(32, 32, format, m_window);
+            const auto* canvas_impl = canvas.impl();
+
+            // The canvas is still in use, so it must not be handed out again.
+            const auto other_canvas = acquire_canvas(32, 32, format, m_window);
+
+            REQUIRE(other_canvas != canvas);
+
+            canvas = {};
+            canvas = acquire_canvas(32, 32, format, m_window);
+
+            REQUIRE(canvas.impl() == canvas_impl);
+
+            const auto smaller_canvas = acquire_canvas(16, 32, format, m_window);
+
+            REQUIRE(smaller_canvas.width() == 16);
+            REQUIRE(frame_stats().canvas_pool_hits == stats.canvas_pool_hits + 1);
+            REQUIRE(frame_stats().canvas_pool_misses == stats.canvas_pool_misses + 3);
+
+            canvas = {};
+            trim_canvas_pool();
+            canvas = acquire_canvas(32, 32, format, m_window);
+
+            REQUIRE(frame_stats().canvas_pool_misses == stats.canvas_pool_misses + 4);
+        }
+
+        SECTION("expiring pooled canvases")
+        {
+            constexpr auto format = ImageFormat::R8G8B8A8_UNorm;
+
+            auto pool  = details::CanvasPool{};
+            auto stats = FrameStats{};
+
+            pool.set_max_idle_frames(2);
+
+            const auto used_canvas = pool.acquire(16, 16, format, m_window, stats);
+            std::ignore            = pool.acquire(16, 16, format, m_window, stats);
+
+            REQUIRE(pool.canvas_count() == 2);
+
+            // The free canvas was last used in frame 0, and is destroyed once more than two
+            // frames have passed since then.
+            pool.next_frame();
+            pool.next_frame();
+            pool.next_frame();
+
+            REQUIRE(pool.canvas_count() == 2);
+
+            pool.next_frame();
+
+            REQUIRE(pool.canvas_count() == 1);
+
+            // Canvases that are in use never expire.
+            for (int i = 0; i < 10; ++i)
+            {
+                pool.next_frame();
+            }
+
+            REQUIRE(pool.canvas_count() == 1);
+
+            // Closing a window removes its canvases from the pool, even those in use.
+            pool.remove_canvases_of(m_window.impl());
+
+            REQUIRE(pool.canvas_count() == 0);
+            REQUIRE(used_canvas.width() == 16);
+        }
+
+        SECTION("replacing the contents of reloaded assets")
+        {
+            auto canvas = Image{4, 4, ImageFormat::R8G8B8A8_UNorm, m_window};
+            canvas.set_canvas_clear_color(black);
+
+            const auto draw_and_read_pixel = [&](const Image& image) {
+                set_canvas(canvas);
+                draw_sprite({.image = image, .dst_rect = {0, 0, 4, 4}});
+                set_canvas({});
+
+                const auto data = read_canvas_data(canvas, 0, 0, 1, 1);
+
+                return std::array{uint8_t(data[0]), uint8_t(data[1]), uint8_t(data[2])};
+            };
+
+            const auto red_pixels = std::array<uint8_t, 16>{
+                255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255,
+            };
+
+            auto       image  = Image{2, 2, ImageFormat::R8G8B8A8_UNorm, red_pixels.data()};
+            const auto handle = image;
+
+            auto& image_impl = static_cast<details::ImageImpl&>(*image.impl());
+            auto& device     = image_impl.parent_device();
+
+            REQUIRE(draw_and_read_pixel(handle) == std::array<uint8_t, 3>{255, 0, 0});
+
+            // The same extent updates the existing texture.
+            const auto blue_pixels = std::array<uint8_t, 16>{
+                0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255,
+            };
+
+            device.replace_image_contents(image_impl,
+                                          2,
+                                          2,
+                                          ImageFormat::R8G8B8A8_UNorm,
+                                          std::array<const void*, 1>{blue_pixels.data()});
+
+            REQUIRE(draw_and_read_pixel(handle) == std::array<uint8_t, 3>{0, 0, 255});
+
+            // A different extent recreates the texture.
+            const auto green_pixels = std::array<uint8_t, 16>{
+                0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+            };
+
+            device.replace_image_contents(image_impl,
+                                          4,
+                                          1,
+                                          ImageFormat::R8G8B8A8_UNorm,
+                                          std::array<const void*, 1>{green_pixels.data()});
+
+            REQUIRE(handle.width() == 4);
+            REQUIRE(handle.height() == 1);
+            REQUIRE(draw_and_read_pixel(handle) == std::array<uint8_t, 3>{0, 255, 0});
+
+            // A shader keeps the values of parameters that the new code still declares.
+            auto shader = Shader{"ReloadedShader",
+                                 "float intensity = 1.0;\n"
+                                 "Vector4 main() { return Vector4(intensity, 0.0, 0.0, 1.0); }"};
+
+            const auto shader_handle = shader;
+            shader.set_value("intensity", 0.0f);
+
+            const auto new_shader =
+                Shader{"ReloadedShader",
+                       "float intensity = 1.0;\n"
+                       "Vector4 main() { return Vector4(0.0, 0.0, 1.0 - intensity, 1.0); }"};
+
+            static_cast<details::ShaderImpl&>(*shader.impl())
+                .take_contents_of(static_cast<details::ShaderImpl&>(*new_shader.impl()));
+
+            REQUIRE(shader_handle.float_value("intensity") == 0.0f);
+
+            set_sprite_shader(shader_handle);
+            const auto shaded_pixel = draw_and_read_pixel(handle);
+            set_sprite_shader({});
+
+            REQUIRE(shaded_pixel == std::array<uint8_t, 3>{0, 0, 255});
+        }
+
+        SECTION("drawing retained text")
+        {
+            auto canvas = Image{128, 64, ImageFormat::R8G8B8A8_UNorm, m_window};
+            canvas.set_canvas_clear_color(black);
+
+            auto text = Text{"Retained", Font::built_in(), 24};
+
+            const auto render = [&](const Color& color) {
+                set_canvas(canvas);
+                draw_text(text, {4, 4}, color);
+                set_canvas({});
+
+                return read_canvas_data(canvas, 0, 0, canvas.width(), canvas.height());
+            };
+
+            const auto expected_red  = render(red);
+            const auto expected_blue = render(blue);
+
+            text.set_retained(true);
+
+            const auto stats = frame_stats();
+
+            REQUIRE(render(red) == expected_red);
+            REQUIRE(render(blue) == expected_blue);
+
+            // Changing the color must not rebuild the vertex data.
+            REQUIRE(frame_stats().retained_text_draws == stats.retained_text_draws + 2);
+            REQUIRE(frame_stats().retained_text_updates == stats.retained_text_updates + 1);
+        }
+
+        SECTION("caching shaped strings")
+        {
+            const auto canvas = Image{64, 64, ImageFormat::R8G8B8A8_UNorm, m_window};
+            const auto font   = Font::built_in();
+
+            const auto stats = frame_stats();
+
+            const auto require_draw = [&](std::string_view text, uint32_t hits, uint32_t misses) {
+                draw_string(text, font, 16, {});
+
+                REQUIRE(frame_stats().text_cache_hits == stats.text_cache_hits + hits);
+                REQUIRE(frame_stats().text_cache_misses == stats.text_cache_misses + misses);
+            };
+
+            set_canvas(canvas);
+
+            // Start with an empty cache that holds two strings.
+            set_text_cache_capacity(0);
+            set_text_cache_capacity(2);
+
+            require_draw("a", 0, 1);
+            require_draw("b", 0, 2);
+            require_draw("a", 1, 2);
+
+            // "b" is the least recently used string, so it's evicted instead of "a".
+            require_draw("c", 1, 3);
+            require_draw("a", 2, 3);
+            require_draw("b", 2, 4);
+
+            // The same string with a different size is a different entry.
+            draw_string("a", font, 24, {});
+            REQUIRE(frame_stats().text_cache_misses == stats.text_cache_misses + 5);
+
+            // Shrinking the cache keeps the most recently used strings.
+            set_text_cache_capacity(1);
+            require_draw("b", 2, 6);
+            require_draw("b", 3, 6);
+
+            // Without a capacity, nothing is cached.
+            set_text_cache_capacity(0);
+            require_draw("b", 3, 7);
+            require_draw("b", 3, 8);
+
+            set_text_cache_capacity(256);
+            set_canvas({});
+        }
+
         m_have_executed_tests = true;
     }
 
@@ -65,3 +369,67 @@ TEST_CASE("SpriteRenderingTests", "[drawing]")
 {
     std::ignore = cer::run_game<MockGame>();
 }
+
+// Images register themselves with the device, which must not get slower the more images
+// are alive.
+class ImageCreationGame final : public Game
+{
+  public:
+    ImageCreationGame()
+        : m_window("Image Creation Benchmark Window", 0, {}, {}, 300, 300, false)
+    {
+    }
+
+    bool update([[maybe_unused]] const GameTime& time) override
+    {
+        constexpr auto image_count = size_t(100'000);
+
+        const auto pixel = std::array<uint8_t, 4>{255, 255, 255, 255};
+
+        using clock = std::chrono::steady_clock;
+
+        auto images = List<Image>{};
+        images.reserve(image_count);
+
+        const auto create_start = clock::now();
+
+        for (size_t i = 0; i < image_count; ++i)
+        {
+            images.emplace_back(1, 1, ImageFormat::R8G8B8A8_UNorm, pixel.data());
+        }
+
+        const auto destroy_start = clock::now();
+
+        // Destroy every other image first, so that images are neither destroyed in the
+        // order they were created in nor in reverse.
+        for (size_t i = 0; i < image_count; i += 2)
+        {
+            images[i] = {};
+        }
+
+        images.clear();
+
+        const auto end = clock::now();
+
+        const auto us_per_image = [](clock::duration elapsed) {
+            return std::chrono::duration<double, std::micro>(elapsed).count() /
+                   double(image_count);
+        };
+
+        std::printf("%-32s %8.3f us/image\n",
+                    "create image",
+                    us_per_image(destroy_start - create_start));
+
+        std::printf("%-32s %8.3f us/image\n", "destroy image", us_per_image(end - destroy_start));
+
+        return false;
+    }
+
+  private:
+    Window m_window;
+};
+
+TEST_CASE("Image creation", "[.benchmark]")
+{
+    REQUIRE(run_game<ImageCreationGame>() == 0);
+}
@@ -0,0 +1,43 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include "WavTestHelper.hpp"
+
+#include <cstring>
+
+auto make_wav_data(uint32_t sample_rate, uint16_t channel_count, std::span<const int16_t> samples)
+    -> cer::List<std::byte>
+{
+    const auto data_size   = uint32_t(samples.size_bytes());
+    const auto block_align = uint16_t(channel_count * sizeof(int16_t));
+
+    auto data = cer::List<std::byte>(44 + data_size);
+    auto pos  = data.data();
+
+    const auto write = [&pos](const void* value, size_t size) {
+        std::memcpy(pos, value, size);
+        pos += size;
+    };
+
+    const auto write_value = [&write](const auto& value) {
+        write(&value, sizeof(value));
+    };
+
+    write("RIFF", 4);
+    write_value(uint32_t(36 + data_size));
+    write("WAVE", 4);
+    write("fmt ", 4);
+    write_value(uint32_t(16));
+    write_value(uint16_t(1)); // PCM
+    write_value(channel_count);
+    write_value(sample_rate);
+    write_value(uint32_t(sample_rate * block_align));
+    write_value(block_align);
+    write_value(uint16_t(16));
+    write("data", 4);
+    write_value(data_size);
+    write(samples.data(), samples.size_bytes());
+
+    return data;
+}
@@ -0,0 +1,15 @@
+// Copyright (C) 2023-2024 Cemalettin Dervis
+// This file is part of cerlib.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <cerlib/List.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Creates the contents of a 16-bit PCM WAV file. Samples of multiple channels are
+// interleaved.
+auto make_wav_data(uint32_t sample_rate, uint16_t channel_count, std::span<const int16_t> samples)
+    -> cer::List<std::byte>;